@@ -87,6 +87,22 @@ struct DecodeProcessingParams
     CODECHAL_SCALING_MODE m_scalingMode;
 };
 
+//!
+//! \struct CodechalDecodeBitstreamSegment
+//! \brief  Bitstream data outside of m_dataBuffer, copied into the picture bitstream before decoding.
+//!
+struct CodechalDecodeBitstreamSegment
+{
+    //! \brief Resource containing the segment data
+    PMOS_RESOURCE           m_resource = nullptr;
+    //! \brief Offset of the segment data in m_resource
+    uint32_t                m_offset = 0;
+    //! \brief Size of the segment data
+    uint32_t                m_size = 0;
+    //! \brief Offset of the segment in the picture bitstream
+    uint32_t                m_destOffset = 0;
+};
+
 //!
 //! \struct CodechalDecodeParams
 //! \brief  Parameters passed in via Execute() to perform decoding.
@@ -127,6 +143,10 @@ struct CodechalDecodeParams
     uint32_t                m_dataSize = 0;
     //! \brief Offset of the data contained in presDataBuffer
     uint32_t                m_dataOffset = 0;
+    //! \brief Segments of the picture bitstream which follow the data in m_dataBuffer, m_dataSize covers all of them
+    CodechalDecodeBitstreamSegment *m_bitstreamSegments = nullptr;
+    //! \brief Number of entries in m_bitstreamSegments
+    uint32_t                m_numBitstreamSegments = 0;
     //! \brief [VLD mode] Number of slices to be decoded
     uint32_t                m_numSlices = 0;
     //! \brief [IT mode] Number of MBs to be decoded
@@ -360,6 +360,8 @@ private:
 
     //!
     //! \brief  Merges two contiguous blocks into one.
+    //! \details The merged block is not added back to the free list, the caller is
+    //!          expected to add it once all merges for it are done.
     //! \param  [in,out] blockCombined
     //!         Block into which \a blockRelease will be merged in to, this block is the output of the merge
     //! \param  [in] blockRelease
@@ -440,7 +442,7 @@ private:
     bool m_lockHeapsOnAllocate = false;             //!< All heaps allocated with the keep locked flag.
     
     //! \brief Persistent storage for the sorted sizes used during AcquireSpace()
-    std::list<SortedSizePair> m_sortedSizes;
+    std::vector<SortedSizePair> m_sortedSizes;
     //! \brief TrackerProducer
     FrameTrackerProducer *m_trackerProducer = nullptr;
     //! \bried Whether trackerProducer is set
@@ -949,6 +949,9 @@ typedef struct _RENDERHAL_STATE_HEAP
     uint8_t                 *pKernelLoadMap;                                     // Kernel load map
     uint32_t                dwAccessCounter;                                    // Incremented when a kernel is loaded/used, for dynamic allocation
     int32_t                 iKernelUsedForDump;                                 // The kernel size to be dumped in oca buffer.
+    uint32_t                dwKernelLoadHits;                                   // Kernel loads served by a resident kernel
+    uint32_t                dwKernelLoadMisses;                                 // Kernel loads that copied the kernel into ISH
+    uint32_t                dwKernelEvictions;                                  // Resident kernels unloaded to make room
 
     // Kernel Spill Area
     uint32_t                dwScratchSpaceSize;                                 // Size of the Scratch Area
@@ -959,6 +962,9 @@ typedef struct _RENDERHAL_STATE_HEAP
 
     // Arrays created dynamically
     PRENDERHAL_KRN_ALLOCATION   pKernelAllocation;                              // Kernel allocation table (or linked list)
+    int32_t                     *piKernelHashBucket;                            // First kernel allocation of each KUID/KCID hash bucket (-1 if empty)
+    int32_t                     *piKernelHashNext;                              // Next kernel allocation in the same hash bucket (-1 if last)
+    uint32_t                    dwKernelHashMask;                               // Number of hash buckets - 1
 
     // Dynamic Kernel States
     PMHW_MEMORY_POOL               pKernelAllocMemPool;                         // Kernel states memory pool (mallocs)
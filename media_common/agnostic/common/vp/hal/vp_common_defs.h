@@ -1033,6 +1033,7 @@ struct VPHAL_RENDER_PARAMS
     bool bUseVEHdrSfc       = false;  // use SFC for to perform CSC/Scaling/RGBSwap of HDR streaming; if false, use composite render.
     bool bNonFirstFrame     = false;  // first frame or not: first frame false, otherwise true considering zeromemory parameters.
     bool bOptimizeCpuTiming = false;  //!< Optimize Cpu Timing
+    bool bMultiOutput       = false;  //!< One output of a 1:N process, all outputs share the same source
 
     VPHAL_RENDER_PARAMS() : uSrcCount(0),
                             pSrc(),
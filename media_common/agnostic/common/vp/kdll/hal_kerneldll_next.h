@@ -82,6 +82,10 @@
 
 #define DL_CHROMASITING_DISABLE -1  // Chromasiting is disabled
 
+#define DL_DISK_CACHE_ENV "VP_KDLL_CACHE_PATH"  // Directory of the persistent combined kernel cache (disabled if not set)
+#define DL_DISK_CACHE_PATH_LENGTH 256          // Max length of the persistent cache directory
+#define DL_DISK_CACHE_MAX_FILES 256            // Max number of cache files per component kernel binary
+
 #ifdef __cplusplus
 extern "C" {
 #endif  // __cplusplus
@@ -685,6 +689,11 @@ typedef struct tagKdll_State
     // Colorfill
     VPHAL_CSPACE colorfill_cspace;  // Selected colorfill Color Space by Kdll
 
+    // Persistent combined kernel cache
+    bool     bDiskCacheEnabled;                          // Combined kernels are loaded from/saved to disk
+    uint32_t dwDiskCacheSignature;                       // Signature of component kernels and rules
+    char     szDiskCachePath[DL_DISK_CACHE_PATH_LENGTH];  // Cache directory
+
     // Start kernel search
     void (*pfnStartKernelSearch)(PKdll_State pState,
         PKdll_SearchState                    pSearchState,
@@ -923,6 +932,14 @@ KernelDll_AllocateAdditionalCacheEntries(Kdll_KernelCache *pCache);
 void KernelDll_ReleaseHashEntry(Kdll_KernelHashTable *pHashTable, uint16_t entry);
 void KernelDll_ReleaseCacheEntry(Kdll_KernelCache *pCache, Kdll_CacheEntry  *pEntry);
 
+// Load kernel from the persistent cache into cache and hash table
+Kdll_CacheEntry *
+KernelDll_LoadCombinedKernel(Kdll_State       *pState,
+                             Kdll_SearchState *pSearchState,
+                             Kdll_FilterEntry *pFilter,
+                             int               iFilterSize,
+                             uint32_t          dwHash);
+
 //---------------------------------------------------------------------------------------
 // KernelDll_SetupFunctionPointers_Ext - Setup Extension Function pointers
 //
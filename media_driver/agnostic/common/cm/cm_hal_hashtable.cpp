@@ -21,240 +21,206 @@
 */
 //!
 //! \file      cm_hal_hashtable.cpp  
-//! \brief         This modules implements a simple coalesced hash table used 
+//! \brief         This modules implements an open addressing hash table used 
 //!                for kernel search in dynamic state heap based CmHal. 
 //!                It exposes hash table initialization, destruction,     
 //!                registration, unregistration and search functions used to 
-//!                speed up kernel search. The hash table size is currently 
-//!                limited to 65535 (MAX uint16_t-1), and 2 keys may be used
+//!                speed up kernel search. 2 keys may be used
 //!                iKUID (Kernel Unique Identifier - int32_t) and 
 //!                CacheID (Arbitrary Kernel Cache ID - int32_t).
-//!                Given the dynamic nature of the ISH and kernel allocation,
-//!                the hash table is allowed to grow dynamically as needed.  
+//!                Entries are placed by a 64-bit hash of iKUID with linear
+//!                probing, so that searches with a negative CacheID (any
+//!                cache ID) stay in one probe sequence. The table doubles
+//!                when 3/4 full and has no fixed size limit.
 //!
 
 #include "cm_hal_hashtable.h"
 
 MOS_STATUS CmHashTable::Init()
 {
-    MOS_STATUS               eStatus = MOS_STATUS_SUCCESS;
     PCM_HAL_HASH_TABLE_ENTRY pHashEntry = nullptr;
 
-    pHashEntry = (PCM_HAL_HASH_TABLE_ENTRY)MOS_AllocMemory(CM_HAL_HASHTABLE_INITIAL * sizeof(CM_HAL_HASH_TABLE_ENTRY));
+    pHashEntry = (PCM_HAL_HASH_TABLE_ENTRY)MOS_AllocAndZeroMemory(CM_HAL_HASHTABLE_INITIAL * sizeof(CM_HAL_HASH_TABLE_ENTRY));
     if (!pHashEntry)
     {
-        eStatus = MOS_STATUS_NO_SPACE;
-        return eStatus;
+        return MOS_STATUS_NO_SPACE;
     }
 
-
     m_hashTable.pHashEntries = pHashEntry;
-    m_hashTable.wSize = CM_HAL_HASHTABLE_INITIAL;
-    m_hashTable.wFree = 1; // First free element = 1 (0 is reserved for nullptr; 0xffff could be used instead, but 0 makes it cleaner/easier to read/understand)
-    for (int i = 0; i < CM_HAL_HASHTABLE_INITIAL - 1; i++, pHashEntry++)
-    {
-        pHashEntry->UniqID = -1;
-        pHashEntry->CacheID = -1;
-        pHashEntry->wNext = i + 1;
-        pHashEntry->pData = nullptr;
-    }
-    pHashEntry--;
-    pHashEntry->wNext = 0;
+    m_hashTable.dwSize       = CM_HAL_HASHTABLE_INITIAL;
+    m_hashTable.dwCount      = 0;
 
-    return eStatus;
+    return MOS_STATUS_SUCCESS;
 }
 
 void CmHashTable::Free()
 {
     if (m_hashTable.pHashEntries) MOS_FreeMemory(m_hashTable.pHashEntries);
+    m_hashTable.pHashEntries = nullptr;
+    m_hashTable.dwSize       = 0;
+    m_hashTable.dwCount      = 0;
 }
 
-uint16_t CmHashTable::SimpleHash(int32_t value)
+uint64_t CmHashTable::Hash(int32_t UniqID)
 {
-    uint16_t wHash = ((value >> 16) ^ value) & 0xFFFF;
-    wHash = ((wHash >> 8) ^ wHash) & 0xFF;
-    return wHash;
+    // 64-bit finalizer (splitmix64), spreads consecutive IDs over the table
+    uint64_t qwHash = (uint64_t)(uint32_t)UniqID;
+    qwHash = (qwHash ^ (qwHash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    qwHash = (qwHash ^ (qwHash >> 27)) * 0x94d049bb133111ebULL;
+    qwHash = qwHash ^ (qwHash >> 31);
+
+    // 0 marks an empty slot
+    return qwHash ? qwHash : 1;
 }
 
-MOS_STATUS CmHashTable::Extend()
+uint32_t CmHashTable::FindSlot(int32_t UniqID, int32_t CacheID)
 {
-    uint16_t                    wEntry;
-    PCM_HAL_HASH_TABLE_ENTRY    pEntry;
-    int32_t                     iPrevSize, iNewSize;
-    MOS_STATUS                  hr = MOS_STATUS_UNKNOWN;
+    uint32_t                 dwMask = m_hashTable.dwSize - 1;
+    uint64_t                 qwHash = Hash(UniqID);
+    PCM_HAL_HASH_TABLE_ENTRY pEntry;
 
-    if (m_hashTable.wSize >= CM_HAL_HASHTABLE_MAX)
+    if (m_hashTable.pHashEntries == nullptr)
     {
-        goto finish;
+        return m_hashTable.dwSize;
     }
 
-    iPrevSize = m_hashTable.wSize * sizeof(CM_HAL_HASH_TABLE_ENTRY);
-    iNewSize = iPrevSize + CM_HAL_HASHTABLE_INCREMENT * sizeof(CM_HAL_HASH_TABLE_ENTRY);
-    pEntry = (PCM_HAL_HASH_TABLE_ENTRY)MOS_AllocMemory(iNewSize);
-    if (!pEntry)
+    // Table is never full, so the probe always reaches an empty slot
+    for (uint32_t dwSlot = (uint32_t)qwHash & dwMask; ; dwSlot = (dwSlot + 1) & dwMask)
     {
-        hr = MOS_STATUS_NO_SPACE;
-        goto finish;
+        pEntry = m_hashTable.pHashEntries + dwSlot;
+        if (pEntry->qwHash == 0)
+        {
+            break;
+        }
+
+        if (pEntry->qwHash == qwHash &&
+            pEntry->UniqID == UniqID &&
+            (CacheID < 0 || pEntry->CacheID == CacheID))
+        {
+            return dwSlot;
+        }
     }
 
-    // Transfer the hash entries to larger table, free old (smaller) table
-    MOS_SecureMemcpy(pEntry, iPrevSize, m_hashTable.pHashEntries, iPrevSize);
-    MOS_FreeMemory(m_hashTable.pHashEntries);
-    m_hashTable.pHashEntries = pEntry;
+    return m_hashTable.dwSize;
+}
 
-    // Initialize entries
-    wEntry = m_hashTable.wSize + 1;
-    pEntry += m_hashTable.wSize;
-    for (int i = CM_HAL_HASHTABLE_INCREMENT; i > 0; i--, wEntry++, pEntry++)
+MOS_STATUS CmHashTable::Extend()
+{
+    PCM_HAL_HASH_TABLE_ENTRY    pOldEntries = m_hashTable.pHashEntries;
+    PCM_HAL_HASH_TABLE_ENTRY    pNewEntries;
+    uint32_t                    dwOldSize = m_hashTable.dwSize;
+    uint32_t                    dwNewSize, dwMask, dwSlot;
+
+    if (dwOldSize >= (1u << 30))
+    {
+        return MOS_STATUS_NO_SPACE;
+    }
+
+    dwNewSize = dwOldSize ? (dwOldSize << 1) : CM_HAL_HASHTABLE_INITIAL;
+    pNewEntries = (PCM_HAL_HASH_TABLE_ENTRY)MOS_AllocAndZeroMemory(dwNewSize * sizeof(CM_HAL_HASH_TABLE_ENTRY));
+    if (!pNewEntries)
     {
-        pEntry->UniqID = -1;
-        pEntry->CacheID = -1;
-        pEntry->wNext = wEntry;
-        pEntry->pData = nullptr;
+        return MOS_STATUS_NO_SPACE;
     }
-    pEntry--;
 
-    // Update free list - new array is appended at the beginning of the free list, avoiding the need to traverse it.
-    pEntry->wNext = m_hashTable.wFree;               // Last entry of newly created entries points to first pre-existing free entry
-    m_hashTable.wFree = m_hashTable.wSize;               // Free list points to newly created array, which points to pre-existing array
-    m_hashTable.wSize += CM_HAL_HASHTABLE_INCREMENT; // Update size of the hash table
+    // Rehash the entries into the larger table using the saved hash values
+    dwMask = dwNewSize - 1;
+    for (uint32_t i = 0; i < dwOldSize; i++)
+    {
+        if (pOldEntries[i].qwHash == 0)
+        {
+            continue;
+        }
+
+        for (dwSlot = (uint32_t)pOldEntries[i].qwHash & dwMask;
+             pNewEntries[dwSlot].qwHash != 0;
+             dwSlot = (dwSlot + 1) & dwMask);
+        pNewEntries[dwSlot] = pOldEntries[i];
+    }
 
-    hr = MOS_STATUS_SUCCESS;
+    if (pOldEntries) MOS_FreeMemory(pOldEntries);
+    m_hashTable.pHashEntries = pNewEntries;
+    m_hashTable.dwSize       = dwNewSize;
 
-finish:
-    return hr;
+    return MOS_STATUS_SUCCESS;
 }
+
 MOS_STATUS CmHashTable::Register(int32_t UniqID, int32_t CacheID, void  *pData)
 {
-    uint16_t                    wHash;
-    uint16_t                    wEntry;
     PCM_HAL_HASH_TABLE_ENTRY    pEntry;
-    MOS_STATUS                  hr = MOS_STATUS_UNKNOWN;
-
-    wHash = SimpleHash(UniqID);
-
-    // Get new entry
-    wEntry = m_hashTable.wFree;
+    uint64_t                    qwHash;
+    uint32_t                    dwMask, dwSlot;
+    MOS_STATUS                  hr;
 
-    // Extend hash table, get new free entry
-    if (wEntry == 0)
+    // Keep load factor at or below 3/4 so probe sequences stay short
+    if ((m_hashTable.dwCount + 1) * 4 > m_hashTable.dwSize * 3)
     {
         hr = Extend();
         if (hr != MOS_STATUS_SUCCESS)
-            goto finish;
-        wEntry = m_hashTable.wFree;
+        {
+            return hr;
+        }
     }
 
-    // Remove entry from free list
-    pEntry = m_hashTable.pHashEntries + wEntry;
-    m_hashTable.wFree = pEntry->wNext;
+    qwHash = Hash(UniqID);
+    dwMask = m_hashTable.dwSize - 1;
+    for (dwSlot = (uint32_t)qwHash & dwMask;
+         m_hashTable.pHashEntries[dwSlot].qwHash != 0;
+         dwSlot = (dwSlot + 1) & dwMask);
 
-    // Link hash entry
-    pEntry->UniqID = UniqID;                   // save unique id
-    pEntry->CacheID = CacheID;                  // save unique id
-    pEntry->pData = pData;                    // save pointer to data
-    pEntry->wNext = m_hashTable.wHead[wHash]; // points to next entry in same bucket
-    m_hashTable.wHead[wHash] = wEntry;          // move entry to head of the bucket
+    pEntry = m_hashTable.pHashEntries + dwSlot;
+    pEntry->qwHash  = qwHash;
+    pEntry->UniqID  = UniqID;                   // save unique id
+    pEntry->CacheID = CacheID;                  // save cache id
+    pEntry->pData   = pData;                    // save pointer to data
+    m_hashTable.dwCount++;
 
-    hr = MOS_STATUS_SUCCESS;
-
-finish:
-    return hr;
+    return MOS_STATUS_SUCCESS;
 }
 
 void* CmHashTable::Search(int32_t UniqID, int32_t CacheID, uint16_t &wSearchIndex)
 {
-    PCM_HAL_HASH_TABLE_ENTRY    pEntry = nullptr;
-    void                        *pData = nullptr;
-    bool                        bFound;
+    // Lookups always complete in one probe sequence, nothing to resume
+    wSearchIndex = 0;
 
-    // Get first entry, or continue previous search
-    if (wSearchIndex == 0 ||
-        wSearchIndex >= m_hashTable.wSize)
+    uint32_t dwSlot = FindSlot(UniqID, CacheID);
+    if (dwSlot >= m_hashTable.dwSize)
     {
-        uint16_t wHash = SimpleHash(UniqID);
-        wSearchIndex = m_hashTable.wHead[wHash];
+        return nullptr;
     }
 
-    if (CacheID >= 0)
-    {
-        // Search for UniqID/CacheID
-        for (bFound = false; (wSearchIndex > 0) && (!bFound); wSearchIndex = pEntry->wNext)
-        {
-            pEntry = m_hashTable.pHashEntries + wSearchIndex;
-            bFound = (pEntry->UniqID == UniqID) && (pEntry->CacheID == CacheID);
-        }
-    }
-    else
-    {
-        // Search for UniqID (don't care about CacheID)
-        for (bFound = false; (wSearchIndex > 0) && (!bFound); wSearchIndex = pEntry->wNext)
-        {
-            pEntry = m_hashTable.pHashEntries + wSearchIndex;
-            bFound = (pEntry->UniqID == UniqID);
-        }
-    }
-
-    // Retrieve user data
-    if (bFound)
-    {
-        pData = pEntry->pData;
-    }
-
-    return pData;
+    return m_hashTable.pHashEntries[dwSlot].pData;
 }
 
 void* CmHashTable::Unregister(int32_t UniqID, int32_t CacheID)
 {
-    uint16_t                    wHash;
-    uint16_t                    wEntry = 0;
-    uint16_t                    wSearchIndex;
-    PCM_HAL_HASH_TABLE_ENTRY    pEntry, pPrevEntry;
-    void                        *pData = nullptr;
-
-
-    wHash = SimpleHash(UniqID);
-
-    // Search for UniqID/CacheID (hashing should significantly speedup this search)
-    pEntry = pPrevEntry = nullptr;
-    wSearchIndex = m_hashTable.wHead[wHash];
-    bool bFound;
+    PCM_HAL_HASH_TABLE_ENTRY    pEntries = m_hashTable.pHashEntries;
+    uint32_t                    dwMask = m_hashTable.dwSize - 1;
+    uint32_t                    dwHole, dwSlot, dwHome;
+    void                        *pData;
 
-    if (CacheID >= 0)
+    dwHole = FindSlot(UniqID, CacheID);
+    if (dwHole >= m_hashTable.dwSize)
     {
-        // Search for UniqID/CacheID
-        for (bFound = false; (wSearchIndex > 0) && (!bFound); wSearchIndex = pEntry->wNext)
-        {
-            wEntry = wSearchIndex;
-            pEntry = m_hashTable.pHashEntries + wSearchIndex;
-            bFound = (pEntry->UniqID == UniqID) && (pEntry->CacheID == CacheID);
-        }
+        return nullptr;
     }
-    else
+
+    pData = pEntries[dwHole].pData;
+
+    // Backward shift deletion: move later entries of the probe sequence
+    // into the hole unless that would place them before their home slot.
+    for (dwSlot = (dwHole + 1) & dwMask; pEntries[dwSlot].qwHash != 0; dwSlot = (dwSlot + 1) & dwMask)
     {
-        // Search for UniqID (don't care about CacheID)
-        for (bFound = false; (wSearchIndex > 0) && (!bFound); wSearchIndex = pEntry->wNext)
+        dwHome = (uint32_t)pEntries[dwSlot].qwHash & dwMask;
+        if (((dwSlot - dwHome) & dwMask) >= ((dwSlot - dwHole) & dwMask))
         {
-            wEntry = wSearchIndex;
-            pEntry = m_hashTable.pHashEntries + wSearchIndex;
-            bFound = (pEntry->UniqID == UniqID);
+            pEntries[dwHole] = pEntries[dwSlot];
+            dwHole = dwSlot;
         }
     }
 
-    // Entry found
-    if (wEntry > 0)
-    {
-        // Detach from hash list
-        if (pPrevEntry)
-            pPrevEntry->wNext = pEntry->wNext;
-        else
-            m_hashTable.wHead[wHash] = pEntry->wNext;
-
-        // Move hash entry to free list
-        pEntry->wNext = m_hashTable.wFree;
-        m_hashTable.wFree = wEntry;
-        pData = pEntry->pData;
-    }
+    MOS_ZeroMemory(&pEntries[dwHole], sizeof(CM_HAL_HASH_TABLE_ENTRY));
+    m_hashTable.dwCount--;
 
     return pData;
 }
@@ -29,27 +29,22 @@
 #include "mos_os.h"
 #include "stdint.h"
 
-#define CM_HAL_HASHTABLE_INITIAL   128
-#define CM_HAL_HASHTABLE_INCREMENT 64
-#define CM_HAL_HASHTABLE_MAX       2048
+#define CM_HAL_HASHTABLE_INITIAL   128    // Initial number of slots, must be a power of 2
 
 typedef struct _CM_HAL_HASH_TABLE_ENTRY
 {
-    int32_t UniqID;
-    int32_t CacheID;
-    uint16_t wNext;
-    void    *pData;
+    uint64_t qwHash;    // 64-bit hash of UniqID, 0 if the slot is empty
+    int32_t  UniqID;
+    int32_t  CacheID;
+    void     *pData;
 } CM_HAL_HASH_TABLE_ENTRY, *PCM_HAL_HASH_TABLE_ENTRY;
 
-typedef struct _CM_HAL_COALESCED_HASH_TABLE
+typedef struct _CM_HAL_OPEN_HASH_TABLE
 {
-    uint16_t                    wHead[256];         // Head of bucket list, 0 if empty
-    uint16_t                    wFree;              // Head of the free hash table list, 0 if not present
-    uint16_t                    wSize;              // Size of the hash table currently allocated
-    CM_HAL_HASH_TABLE_ENTRY *pHashEntries;       // Dynamically expanding coalescing hash table
-} CM_HAL_COALESCED_HASH_TABLE, *PCM_HAL_COALESCED_HASH_TABLE;
-
-typedef struct _CM_HAL_COALESCED_HASH_TABLE *PCM_HAL_COALESCED_HASH_TABLE;
+    uint32_t                dwSize;             // Number of slots allocated, always a power of 2
+    uint32_t                dwCount;            // Number of slots in use
+    CM_HAL_HASH_TABLE_ENTRY *pHashEntries;      // Linear probing table, doubled when 3/4 full
+} CM_HAL_OPEN_HASH_TABLE, *PCM_HAL_OPEN_HASH_TABLE;
 
 class CmHashTable
 {
@@ -59,11 +54,13 @@ public:
     MOS_STATUS Register(int32_t UniqID, int32_t CacheID, void  *pData);
     void*      Search(int32_t UniqID, int32_t CacheID, uint16_t &wSearchIndex);
     void*      Unregister(int32_t UniqID, int32_t CacheID);
+    uint32_t   GetCount() { return m_hashTable.dwCount; }
 
 private:
-    uint16_t   SimpleHash(int32_t value);
+    uint64_t   Hash(int32_t UniqID);
+    uint32_t   FindSlot(int32_t UniqID, int32_t CacheID);
     MOS_STATUS Extend();
-    CM_HAL_COALESCED_HASH_TABLE m_hashTable;
+    CM_HAL_OPEN_HASH_TABLE m_hashTable;
 };
 
 #endif // __CM_HAL_HASHTABLE_H__
@@ -0,0 +1,129 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file      cm_mem_avx2_impl.cpp
+//! \brief     Contains CM memory function implementations
+//!
+
+#include "cm_mem.h"
+#include "cm_mem_avx2_impl.h"
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+typedef __m256i HEXWORD;  // 256-bits,   32-bytes
+
+void FastMemCopy_AVX2_stream(
+    void* dst,
+    const void* src,
+    const size_t hexWords )
+{
+    CM_ASSERT( IsAligned( dst, sizeof(HEXWORD) ) );
+
+    const size_t hexWordsPerCacheline = sizeof(DHWORD) / sizeof(HEXWORD);
+
+    // Prefetch the src data
+    Prefetch( (uint8_t*)src );
+    Prefetch( (uint8_t*)src + sizeof(DHWORD) );
+
+    __m256i* dst256i = (__m256i*)dst;
+    const __m256i* src256i = (const __m256i*)src;
+
+    size_t count = hexWords;
+
+    // Copies a cacheline per loop iteration
+    while( count >= hexWordsPerCacheline )
+    {
+        Prefetch( (const uint8_t*)src256i + 2 * sizeof(DHWORD) );
+
+        count -= hexWordsPerCacheline;
+
+        const __m256i ymm0 = _mm256_loadu_si256( src256i );
+        const __m256i ymm1 = _mm256_loadu_si256( src256i + 1 );
+        _mm256_stream_si256( dst256i, ymm0 );
+        _mm256_stream_si256( dst256i + 1, ymm1 );
+
+        src256i += hexWordsPerCacheline;
+        dst256i += hexWordsPerCacheline;
+    }
+
+    // Copy HEXWORD if not cacheline multiple
+    while( count-- )
+    {
+        _mm256_stream_si256( dst256i++, _mm256_loadu_si256( src256i++ ) );
+    }
+
+    // Make the non-temporal stores globally visible before returning
+    _mm_sfence();
+}
+
+void CmFastMemCopy_AVX2( void* dst, const void* src, const size_t bytes )
+{
+    // Cache pointers to memory
+    uint8_t *cacheDst = (uint8_t*)dst;
+    uint8_t *cacheSrc = (uint8_t*)src;
+
+    size_t count = bytes;
+
+    if( count >= CM_CPU_FASTCOPY_THRESHOLD )
+    {
+        // The destination pointer should be 256-bit aligned
+        const size_t hexWordAlignBytes =
+            GetAlignmentOffset( cacheDst, sizeof(HEXWORD) );
+
+        if( hexWordAlignBytes )
+        {
+            MOS_SecureMemcpy( cacheDst, hexWordAlignBytes, cacheSrc, hexWordAlignBytes );
+
+            cacheDst += hexWordAlignBytes;
+            cacheSrc += hexWordAlignBytes;
+            count -= hexWordAlignBytes;
+        }
+
+        // Get the number of HEXWORDs to be copied
+        const size_t hexWords = count / sizeof(HEXWORD);
+
+        if( hexWords )
+        {
+            FastMemCopy_AVX2_stream( cacheDst, cacheSrc, hexWords );
+
+            cacheDst += hexWords * sizeof(HEXWORD);
+            cacheSrc += hexWords * sizeof(HEXWORD);
+            count -= hexWords * sizeof(HEXWORD);
+        }
+    }
+
+    // Copy remaining uint8_t(s)
+    if( count )
+    {
+        MOS_SecureMemcpy( cacheDst, count, cacheSrc, count );
+    }
+}
+
+void CmFastMemCopyWC_AVX2( void* dst, const void* src, const size_t bytes )
+{
+    // Write-combined destinations take the same aligned streaming store path
+    CmFastMemCopy_AVX2( dst, src, bytes );
+}
+
+#endif // __AVX2__
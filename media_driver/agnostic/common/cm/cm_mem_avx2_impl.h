@@ -0,0 +1,73 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file      cm_mem_avx2_impl.h
+//! \brief     Contains CM memory function definitions
+//!
+#pragma once
+
+/*****************************************************************************\
+Function:
+    FastMemCopy_AVX2_stream
+
+Description:
+    Memory copy function using Advanced Vector Extensions 2 with non-temporal
+    stores, so the destination does not pollute the cache
+
+Input:
+    dst - 32-byte aligned pointer to destination buffer
+    src - pointer to source buffer
+    hexWords - number of 32-byte blocks to copy
+\*****************************************************************************/
+void FastMemCopy_AVX2_stream(
+    void* dst,
+    const void* src,
+    const size_t hexWords );
+
+/*****************************************************************************\
+Function:
+    CmFastMemCopy
+
+Description:
+    AVX2 Memory Copy function for large amounts of data
+
+Input:
+    dst - pointer to destination buffer
+    src - pointer to source buffer
+    bytes - number of bytes to copy
+\*****************************************************************************/
+void CmFastMemCopy_AVX2( void* dst, const void* src, const size_t bytes );
+
+/*****************************************************************************\
+Function:
+    CmFastMemCopyWC
+
+Description:
+    AVX2 Memory Copy function for large amounts of data into write-combined
+    memory
+
+Input:
+    dst - pointer to write-combined destination buffer
+    src - pointer to source buffer
+    bytes - number of bytes to copy
+\*****************************************************************************/
+void CmFastMemCopyWC_AVX2( void* dst, const void* src, const size_t bytes );
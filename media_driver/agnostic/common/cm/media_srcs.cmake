@@ -90,6 +90,7 @@ set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/cm_log.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem_c_impl.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem_sse2_impl.h
+    ${CMAKE_CURRENT_LIST_DIR}/cm_mem_avx2_impl.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_mov_inst.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_perf.h
@@ -153,6 +154,10 @@ set(COMMON_PRIVATE_INCLUDE_DIRS_
 set(SOURCES_SSE2
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem_sse2_impl.cpp)
 
+set(SOURCES_AVX2
+    ${SOURCES_AVX2}
+    ${CMAKE_CURRENT_LIST_DIR}/cm_mem_avx2_impl.cpp)
+
 source_group(CM FILES ${TMP_SOURCES_} ${TMP_HEADERS_})
 
 media_add_curr_to_include_path()
\ No newline at end of file
@@ -6311,6 +6311,12 @@ MOS_STATUS CompositeState::RenderPhase(
         }
     }
 
+    if (!pKernelEntry)
+    {
+        // Try persistent kernel cache before searching and building the kernel
+        pKernelEntry = KernelDll_LoadCombinedKernel(pKernelDllState, &m_KernelSearch, pFilter, iFilterSize, dwKernelHash);
+    }
+
     if (!pKernelEntry || bKernelEntryUpdate)
     {
         Kdll_SearchState *pSearchState = &m_KernelSearch;
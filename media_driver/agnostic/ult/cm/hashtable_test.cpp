@@ -0,0 +1,123 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+#include "gtest/gtest.h"
+#include "cm_hal_hashtable.h"
+
+class HashTableTest: public testing::Test
+{
+public:
+    static const int32_t KERNEL_COUNT = 4096;  // Beyond the old 2048 entry limit
+    static const int32_t CACHE_COUNT = 4;
+
+    HashTableTest(): m_table() {}
+
+    void SetUp() override { ASSERT_EQ(MOS_STATUS_SUCCESS, m_table.Init()); }
+
+    void TearDown() override { m_table.Free(); }
+
+    static void *Data(int32_t uniq_id, int32_t cache_id)
+    {
+        return reinterpret_cast<void*>(
+            static_cast<uintptr_t>(uniq_id*CACHE_COUNT + cache_id + 1));
+    }
+
+    void RegisterAll()
+    {
+        for (int32_t i = 0; i < KERNEL_COUNT; ++i)
+        {
+            for (int32_t c = 0; c < CACHE_COUNT; ++c)
+            {
+                ASSERT_EQ(MOS_STATUS_SUCCESS,
+                          m_table.Register(i, c, Data(i, c)));
+            }
+        }
+        ASSERT_EQ(static_cast<uint32_t>(KERNEL_COUNT*CACHE_COUNT),
+                  m_table.GetCount());
+    }//===========================================================
+
+protected:
+    CmHashTable m_table;
+};//======================
+
+TEST_F(HashTableTest, RegisterSearchUnregister)
+{
+    RegisterAll();
+
+    uint16_t search_index = 0;
+    for (int32_t i = 0; i < KERNEL_COUNT; ++i)
+    {
+        for (int32_t c = 0; c < CACHE_COUNT; ++c)
+        {
+            EXPECT_EQ(Data(i, c), m_table.Search(i, c, search_index));
+        }
+        EXPECT_NE(nullptr, m_table.Search(i, -1, search_index));
+    }
+    EXPECT_EQ(nullptr, m_table.Search(KERNEL_COUNT, 0, search_index));
+    EXPECT_EQ(nullptr, m_table.Search(0, CACHE_COUNT, search_index));
+
+    // Remove every other cache ID, the rest must still be reachable.
+    for (int32_t i = 0; i < KERNEL_COUNT; ++i)
+    {
+        for (int32_t c = 0; c < CACHE_COUNT; c += 2)
+        {
+            EXPECT_EQ(Data(i, c), m_table.Unregister(i, c));
+        }
+    }
+    for (int32_t i = 0; i < KERNEL_COUNT; ++i)
+    {
+        for (int32_t c = 0; c < CACHE_COUNT; ++c)
+        {
+            void *expected = (c % 2) ? Data(i, c) : nullptr;
+            EXPECT_EQ(expected, m_table.Search(i, c, search_index));
+        }
+    }
+    EXPECT_EQ(static_cast<uint32_t>(KERNEL_COUNT*CACHE_COUNT/2),
+              m_table.GetCount());
+}//========================================================
+
+// Timing only, run with --gtest_also_run_disabled_tests
+TEST_F(HashTableTest, DISABLED_LookupBenchmark)
+{
+    RegisterAll();
+
+    const int32_t rounds = 64;
+    uint16_t search_index = 0;
+    uint32_t found = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int32_t r = 0; r < rounds; ++r)
+    {
+        for (int32_t i = 0; i < KERNEL_COUNT; ++i)
+        {
+            found += (m_table.Search(i, r % CACHE_COUNT, search_index)
+                      != nullptr);
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    EXPECT_EQ(static_cast<uint32_t>(rounds*KERNEL_COUNT), found);
+
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    RecordProperty("NsPerLookup", static_cast<int>(ns/(rounds*KERNEL_COUNT)));
+}//==========================================================
@@ -0,0 +1,162 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "cm_mem.h"
+#include "cm_mem_c_impl.h"
+#include "cm_mem_sse2_impl.h"
+#include "cm_mem_avx2_impl.h"
+#include "cm_mem_os_c_impl.h"
+#include "cm_mem_os_sse4_impl.h"
+#include "cm_mem_os_avx2_impl.h"
+
+typedef void (*CopyFunction)(void *dst, const void *src, const size_t bytes);
+
+struct CopyImpl
+{
+    const char *name;
+    CopyFunction copy;
+    CPU_INSTRUCTION_LEVEL level;
+};
+
+static const size_t GUARD = 64;  // Untouched bytes around each destination
+static const uint8_t FILL = 0xcd;
+
+class MemCopyTest: public testing::Test
+{
+public:
+    static std::vector<CopyImpl> Implementations()
+    {
+        std::vector<CopyImpl> impls = {
+            {"CmFastMemCopy_C",          CmFastMemCopy_C,          CPU_INSTRUCTION_LEVEL_UNKNOWN},
+            {"CmFastMemCopyWC_C",        CmFastMemCopyWC_C,        CPU_INSTRUCTION_LEVEL_UNKNOWN},
+            {"CmFastMemCopyFromWC_C",    CmFastMemCopyFromWC_C,    CPU_INSTRUCTION_LEVEL_UNKNOWN},
+            {"CmFastMemCopy_SSE2",       CmFastMemCopy_SSE2,       CPU_INSTRUCTION_LEVEL_SSE2},
+            {"CmFastMemCopyWC_SSE2",     CmFastMemCopyWC_SSE2,     CPU_INSTRUCTION_LEVEL_SSE2},
+            {"CmFastMemCopyFromWC_SSE4", CmFastMemCopyFromWC_SSE4, CPU_INSTRUCTION_LEVEL_SSE4_1},
+            {"CmFastMemCopy_AVX2",       CmFastMemCopy_AVX2,       CPU_INSTRUCTION_LEVEL_AVX2},
+            {"CmFastMemCopyWC_AVX2",     CmFastMemCopyWC_AVX2,     CPU_INSTRUCTION_LEVEL_AVX2},
+            {"CmFastMemCopyFromWC_AVX2", CmFastMemCopyFromWC_AVX2, CPU_INSTRUCTION_LEVEL_AVX2},
+            {"CmFastMemCopy",            CmFastMemCopy,            CPU_INSTRUCTION_LEVEL_UNKNOWN},
+            {"CmFastMemCopyWC",          CmFastMemCopyWC,          CPU_INSTRUCTION_LEVEL_UNKNOWN},
+        };
+
+        std::vector<CopyImpl> supported;
+        for (const CopyImpl &impl : impls)
+        {
+            if (impl.level <= GetCpuInstructionLevel())
+            {
+                supported.push_back(impl);
+            }
+        }
+        return supported;
+    }
+
+    // Copies |bytes| between the given misalignments and checks the result
+    // and the guard bytes around the destination.
+    static void CheckCopy(const CopyImpl &impl,
+                          size_t bytes,
+                          size_t src_offset,
+                          size_t dst_offset)
+    {
+        std::vector<uint8_t> src(bytes + 2*GUARD);
+        std::vector<uint8_t> dst(bytes + 2*GUARD, FILL);
+        for (size_t i = 0; i < src.size(); ++i)
+        {
+            src[i] = static_cast<uint8_t>(i*131 + (i >> 8));
+        }
+
+        uint8_t *src_data = static_cast<uint8_t*>(
+            Align(src.data(), sizeof(DHWORD))) + src_offset;
+        uint8_t *dst_data = static_cast<uint8_t*>(
+            Align(dst.data(), sizeof(DHWORD))) + dst_offset;
+        impl.copy(dst_data, src_data, bytes);
+
+        ASSERT_EQ(0, memcmp(dst_data, src_data, bytes))
+            << impl.name << " bytes=" << bytes << " src_offset=" << src_offset
+            << " dst_offset=" << dst_offset;
+        for (uint8_t *p = dst.data(); p < dst_data; ++p)
+        {
+            ASSERT_EQ(FILL, *p) << impl.name << " wrote before destination";
+        }
+        for (uint8_t *p = dst_data + bytes; p < dst.data() + dst.size(); ++p)
+        {
+            ASSERT_EQ(FILL, *p) << impl.name << " wrote past destination";
+        }
+    }
+};//=========================================================
+
+TEST_F(MemCopyTest, BitExact)
+{
+    const size_t sizes[] = {0, 1, 15, 16, 31, 32, 63, 64, 1023, 1024, 1025,
+                            4096 + 17, 65536 + 33};
+    const size_t offsets[] = {0, 1, 8, 16, 31};
+
+    for (const CopyImpl &impl : Implementations())
+    {
+        for (size_t bytes : sizes)
+        {
+            for (size_t src_offset : offsets)
+            {
+                for (size_t dst_offset : offsets)
+                {
+                    CheckCopy(impl, bytes, src_offset, dst_offset);
+                    if (HasFatalFailure())
+                    {
+                        return;
+                    }
+                }
+            }
+        }
+    }
+}//==========================================================
+
+// Timing only, run with --gtest_also_run_disabled_tests
+TEST_F(MemCopyTest, DISABLED_CopyBenchmark)
+{
+    const size_t bytes = 8 << 20;  // An 8-bit 4K frame is roughly 8MB
+    const int32_t rounds = 16;
+    std::vector<uint8_t> src(bytes + sizeof(DHWORD), 1);
+    std::vector<uint8_t> dst(bytes + sizeof(DHWORD));
+    uint8_t *src_data = static_cast<uint8_t*>(Align(src.data(), sizeof(DHWORD)));
+    uint8_t *dst_data = static_cast<uint8_t*>(Align(dst.data(), sizeof(DHWORD)));
+
+    for (const CopyImpl &impl : Implementations())
+    {
+        impl.copy(dst_data, src_data, bytes);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int32_t r = 0; r < rounds; ++r)
+        {
+            impl.copy(dst_data, src_data, bytes);
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        EXPECT_EQ(0, memcmp(dst_data, src_data, bytes)) << impl.name;
+
+        double s = std::chrono::duration<double>(end - start).count();
+        RecordProperty(std::string(impl.name) + "_MBps", static_cast<int>(rounds*bytes/s/1e6));
+    }
+}//==========================================================
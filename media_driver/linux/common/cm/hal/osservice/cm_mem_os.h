@@ -107,6 +107,36 @@ inline bool TestSSE4_1( void )
     return success;
 }
 
+/*****************************************************************************\
+Inline Function:
+    TestAVX2
+
+Description:
+    Returns true if the CPU supports AVX2 and the OS saves the YMM state
+\*****************************************************************************/
+inline bool TestAVX2( void )
+{
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+
+    // OSXSAVE and AVX must be reported before XGETBV can be used
+    if( !__get_cpuid(1, &eax, &ebx, &ecx, &edx) ||
+        (ecx & (BIT(27) | BIT(28))) != (BIT(27) | BIT(28)) )
+    {
+        return false;
+    }
+
+    // XCR0 must have both the SSE and AVX state enabled
+    unsigned int xcr0 = 0, xcr0Hi = 0;
+    __asm__ __volatile__("xgetbv" : "=a"(xcr0), "=d"(xcr0Hi) : "c"(0));
+    if( (xcr0 & 0x6) != 0x6 || __get_cpuid_max(0, nullptr) < 7 )
+    {
+        return false;
+    }
+
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return (ebx & BIT(5)) != 0;
+}
+
 /*****************************************************************************\
 Inline Function:
     GetCPUID
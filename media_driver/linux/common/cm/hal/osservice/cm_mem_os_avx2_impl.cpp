@@ -0,0 +1,96 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file      cm_mem_os_avx2_impl.cpp
+//! \brief     Contains CM memory function implementations
+//!
+
+#include "cm_mem_os_avx2_impl.h"
+
+#if defined(__AVX2__)
+
+#include "cm_mem.h"
+#include <immintrin.h>
+
+void CmFastMemCopyFromWC_AVX2( void* dst, const void* src, const size_t bytes )
+{
+    // Cache pointers to memory
+    uint8_t *tempDst = (uint8_t*)dst;
+    uint8_t *tempSrc = (uint8_t*)src;
+
+    size_t count = bytes;
+
+    if( count >= CM_CPU_FASTCOPY_THRESHOLD )
+    {
+        //Streaming Load must be 32-byte aligned but should
+        //be 64-byte aligned for optimal performance
+        const size_t doubleHexWordAlignBytes =
+            GetAlignmentOffset( tempSrc, sizeof(DHWORD) );
+
+        // Copy portion of the source memory that is not aligned
+        if( doubleHexWordAlignBytes )
+        {
+            CmSafeMemCopy( tempDst, tempSrc, doubleHexWordAlignBytes );
+
+            tempDst += doubleHexWordAlignBytes;
+            tempSrc += doubleHexWordAlignBytes;
+            count -= doubleHexWordAlignBytes;
+        }
+
+        CM_ASSERT( IsAligned( tempSrc, sizeof(DHWORD) ) == true );
+
+        // Get the number of bytes to be copied (rounded down to nearets DHWORD)
+        const size_t doubleHexWordsToCopy = count / sizeof(DHWORD);
+
+        if( doubleHexWordsToCopy )
+        {
+            __m256i* mmSrc = (__m256i*)(tempSrc);
+            __m256i* mmDst = reinterpret_cast<__m256i*>(tempDst);
+
+            // Sync the WC memory data before issuing the VMOVNTDQA instruction.
+            _mm_mfence();
+
+            for( size_t i=0; i<doubleHexWordsToCopy; i++ )
+            {
+                const __m256i ymm0 = _mm256_stream_load_si256(mmSrc);
+                const __m256i ymm1 = _mm256_stream_load_si256(mmSrc + 1);
+                mmSrc += 2;
+
+                _mm256_storeu_si256(mmDst, ymm0);
+                _mm256_storeu_si256(mmDst + 1, ymm1);
+                mmDst += 2;
+            }
+
+            tempDst += doubleHexWordsToCopy * sizeof(DHWORD);
+            tempSrc += doubleHexWordsToCopy * sizeof(DHWORD);
+            count -= doubleHexWordsToCopy * sizeof(DHWORD);
+        }
+    }
+
+    // Copy remaining uint8_t(s)
+    if( count )
+    {
+        CmSafeMemCopy( tempDst, tempSrc, count );
+    }
+}
+
+#endif // __AVX2__
@@ -30,6 +30,7 @@
 
 #include "mos_cmdbufmgr.h"
 #include "media_libva_caps.h"
+#include "media_image_scratch.h"
 
 //!
 //! \struct DDI_MEDIA_CONTEXT
@@ -101,6 +102,9 @@ struct DDI_MEDIA_CONTEXT
     MEDIA_MUTEX_T       CmMutex        = {};
     MEDIA_MUTEX_T       MfeMutex       = {};
 
+    // Scratch buffer reused by vaGetImage to hold the deswizzled surface
+    MediaImageScratch   ImageScratch;
+
     // GT system Info
     MEDIA_SYSTEM_INFO  *pGtSystemInfo           = nullptr;
 
@@ -1439,32 +1439,15 @@ static VAStatus DdiMedia_HeapDestroy(
 {
     DDI_CHK_NULL(mediaCtx, "nullptr ctx", VA_STATUS_ERROR_INVALID_CONTEXT);
     // destroy heaps
-    MOS_FreeMemory(mediaCtx->pSurfaceHeap->pHeapBase);
-    MOS_FreeMemory(mediaCtx->pSurfaceHeap);
-
-    MOS_FreeMemory(mediaCtx->pBufferHeap->pHeapBase);
-    MOS_FreeMemory(mediaCtx->pBufferHeap);
-
-    MOS_FreeMemory(mediaCtx->pImageHeap->pHeapBase);
-    MOS_FreeMemory(mediaCtx->pImageHeap);
-
-    MOS_FreeMemory(mediaCtx->pDecoderCtxHeap->pHeapBase);
-    MOS_FreeMemory(mediaCtx->pDecoderCtxHeap);
-
-    MOS_FreeMemory(mediaCtx->pEncoderCtxHeap->pHeapBase);
-    MOS_FreeMemory(mediaCtx->pEncoderCtxHeap);
-
-    MOS_FreeMemory(mediaCtx->pVpCtxHeap->pHeapBase);
-    MOS_FreeMemory(mediaCtx->pVpCtxHeap);
-
-    MOS_FreeMemory(mediaCtx->pProtCtxHeap->pHeapBase);
-    MOS_FreeMemory(mediaCtx->pProtCtxHeap);
-
-    MOS_FreeMemory(mediaCtx->pCmCtxHeap->pHeapBase);
-    MOS_FreeMemory(mediaCtx->pCmCtxHeap);
-
-    MOS_FreeMemory(mediaCtx->pMfeCtxHeap->pHeapBase);
-    MOS_FreeMemory(mediaCtx->pMfeCtxHeap);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pSurfaceHeap);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pBufferHeap);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pImageHeap);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pDecoderCtxHeap);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pEncoderCtxHeap);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pVpCtxHeap);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pProtCtxHeap);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pCmCtxHeap);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pMfeCtxHeap);
     // destroy the mutexs
     DdiMediaUtil_DestroyMutex(&mediaCtx->SurfaceMutex);
     DdiMediaUtil_DestroyMutex(&mediaCtx->BufferMutex);
@@ -133,6 +133,7 @@ typedef struct _DDI_CODEC_BITSTREAM_BUFFER_INFO
     PDDI_MEDIA_BUFFER   pMappedGPUBuffer; // the GPU mapping for this buffer.
     bool                bIsUseExtBuf;
     uint8_t            *pSliceBuf;
+    PDDI_MEDIA_BUFFER   pSliceBufObj; // GPU buffer behind pSliceBuf when slice data is passed down as a bitstream segment.
 } DDI_CODEC_BITSTREAM_BUFFER_INFO;
 
 typedef struct _DDI_CODEC_BUFFER_PARAM_H264
@@ -1631,23 +1631,23 @@ PDDI_MEDIA_SURFACE_HEAP_ELEMENT DdiMediaUtil_AllocPMediaSurfaceFromHeap(PDDI_MED
 
     if (nullptr == surfaceHeap->pFirstFreeHeapElement)
     {
-        void *newHeapBase = MOS_ReallocMemory(surfaceHeap->pHeapBase, (surfaceHeap->uiAllocatedHeapElements + DDI_MEDIA_HEAP_INCREMENTAL_SIZE) * sizeof(DDI_MEDIA_SURFACE_HEAP_ELEMENT));
+        uint32_t incrementalSize = 0;
+        void *newHeapBase = MediaLibvaCommonNext::GrowHeap(surfaceHeap, incrementalSize);
 
         if (nullptr == newHeapBase)
         {
-            DDI_ASSERTMESSAGE("DDI: realloc failed.");
+            DDI_ASSERTMESSAGE("DDI: heap growth failed.");
             return nullptr;
         }
-        surfaceHeap->pHeapBase                    = newHeapBase;
         PDDI_MEDIA_SURFACE_HEAP_ELEMENT surfaceHeapBase  = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)surfaceHeap->pHeapBase;
         surfaceHeap->pFirstFreeHeapElement        = (void*)(&surfaceHeapBase[surfaceHeap->uiAllocatedHeapElements]);
-        for (int32_t i = 0; i < (DDI_MEDIA_HEAP_INCREMENTAL_SIZE); i++)
+        for (uint32_t i = 0; i < incrementalSize; i++)
         {
             mediaSurfaceHeapElmt                  = &surfaceHeapBase[surfaceHeap->uiAllocatedHeapElements + i];
-            mediaSurfaceHeapElmt->pNextFree       = (i == (DDI_MEDIA_HEAP_INCREMENTAL_SIZE - 1))? nullptr : &surfaceHeapBase[surfaceHeap->uiAllocatedHeapElements + i + 1];
+            mediaSurfaceHeapElmt->pNextFree       = (i == (incrementalSize - 1))? nullptr : &surfaceHeapBase[surfaceHeap->uiAllocatedHeapElements + i + 1];
             mediaSurfaceHeapElmt->uiVaSurfaceID   = surfaceHeap->uiAllocatedHeapElements + i;
         }
-        surfaceHeap->uiAllocatedHeapElements     += DDI_MEDIA_HEAP_INCREMENTAL_SIZE;
+        MediaLibvaCommonNext::SetHeapSize(surfaceHeap, surfaceHeap->uiAllocatedHeapElements + incrementalSize);
     }
 
     mediaSurfaceHeapElmt                          = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)surfaceHeap->pFirstFreeHeapElement;
@@ -1681,22 +1681,22 @@ PDDI_MEDIA_BUFFER_HEAP_ELEMENT DdiMediaUtil_AllocPMediaBufferFromHeap(PDDI_MEDIA
     PDDI_MEDIA_BUFFER_HEAP_ELEMENT  mediaBufferHeapElmt = nullptr;
     if (nullptr == bufferHeap->pFirstFreeHeapElement)
     {
-        void *newHeapBase = MOS_ReallocMemory(bufferHeap->pHeapBase, (bufferHeap->uiAllocatedHeapElements + DDI_MEDIA_HEAP_INCREMENTAL_SIZE) * sizeof(DDI_MEDIA_BUFFER_HEAP_ELEMENT));
+        uint32_t incrementalSize = 0;
+        void *newHeapBase = MediaLibvaCommonNext::GrowHeap(bufferHeap, incrementalSize);
         if (nullptr == newHeapBase)
         {
-            DDI_ASSERTMESSAGE("DDI: realloc failed.");
+            DDI_ASSERTMESSAGE("DDI: heap growth failed.");
             return nullptr;
         }
-        bufferHeap->pHeapBase                                 = newHeapBase;
         PDDI_MEDIA_BUFFER_HEAP_ELEMENT mediaBufferHeapBase    = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)bufferHeap->pHeapBase;
         bufferHeap->pFirstFreeHeapElement     = (void*)(&mediaBufferHeapBase[bufferHeap->uiAllocatedHeapElements]);
-        for (int32_t i = 0; i < (DDI_MEDIA_HEAP_INCREMENTAL_SIZE); i++)
+        for (uint32_t i = 0; i < incrementalSize; i++)
         {
             mediaBufferHeapElmt               = &mediaBufferHeapBase[bufferHeap->uiAllocatedHeapElements + i];
-            mediaBufferHeapElmt->pNextFree    = (i == (DDI_MEDIA_HEAP_INCREMENTAL_SIZE - 1))? nullptr : &mediaBufferHeapBase[bufferHeap->uiAllocatedHeapElements + i + 1];
+            mediaBufferHeapElmt->pNextFree    = (i == (incrementalSize - 1))? nullptr : &mediaBufferHeapBase[bufferHeap->uiAllocatedHeapElements + i + 1];
             mediaBufferHeapElmt->uiVaBufferID = bufferHeap->uiAllocatedHeapElements + i;
         }
-        bufferHeap->uiAllocatedHeapElements  += DDI_MEDIA_HEAP_INCREMENTAL_SIZE;
+        MediaLibvaCommonNext::SetHeapSize(bufferHeap, bufferHeap->uiAllocatedHeapElements + incrementalSize);
     }
 
     mediaBufferHeapElmt                       = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)bufferHeap->pFirstFreeHeapElement;
@@ -1727,23 +1727,23 @@ PDDI_MEDIA_IMAGE_HEAP_ELEMENT DdiMediaUtil_AllocPVAImageFromHeap(PDDI_MEDIA_HEAP
 
     if (nullptr == imageHeap->pFirstFreeHeapElement)
     {
-        void *newHeapBase = MOS_ReallocMemory(imageHeap->pHeapBase, (imageHeap->uiAllocatedHeapElements + DDI_MEDIA_HEAP_INCREMENTAL_SIZE) * sizeof(DDI_MEDIA_IMAGE_HEAP_ELEMENT));
+        uint32_t incrementalSize = 0;
+        void *newHeapBase = MediaLibvaCommonNext::GrowHeap(imageHeap, incrementalSize);
 
         if (nullptr == newHeapBase)
         {
-            DDI_ASSERTMESSAGE("DDI: realloc failed.");
+            DDI_ASSERTMESSAGE("DDI: heap growth failed.");
             return nullptr;
         }
-        imageHeap->pHeapBase                           = newHeapBase;
         PDDI_MEDIA_IMAGE_HEAP_ELEMENT vaimageHeapBase  = (PDDI_MEDIA_IMAGE_HEAP_ELEMENT)imageHeap->pHeapBase;
         imageHeap->pFirstFreeHeapElement               = (void*)(&vaimageHeapBase[imageHeap->uiAllocatedHeapElements]);
-        for (int32_t i = 0; i < (DDI_MEDIA_HEAP_INCREMENTAL_SIZE); i++)
+        for (uint32_t i = 0; i < incrementalSize; i++)
         {
             vaimageHeapElmt                   = &vaimageHeapBase[imageHeap->uiAllocatedHeapElements + i];
-            vaimageHeapElmt->pNextFree        = (i == (DDI_MEDIA_HEAP_INCREMENTAL_SIZE - 1))? nullptr : &vaimageHeapBase[imageHeap->uiAllocatedHeapElements + i + 1];
+            vaimageHeapElmt->pNextFree        = (i == (incrementalSize - 1))? nullptr : &vaimageHeapBase[imageHeap->uiAllocatedHeapElements + i + 1];
             vaimageHeapElmt->uiVaImageID      = imageHeap->uiAllocatedHeapElements + i;
         }
-        imageHeap->uiAllocatedHeapElements   += DDI_MEDIA_HEAP_INCREMENTAL_SIZE;
+        MediaLibvaCommonNext::SetHeapSize(imageHeap, imageHeap->uiAllocatedHeapElements + incrementalSize);
 
     }
 
@@ -1778,24 +1778,24 @@ PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT DdiMediaUtil_AllocPVAContextFromHeap(PDDI_MEDI
 
     if (nullptr == vaContextHeap->pFirstFreeHeapElement)
     {
-        void *newHeapBase = MOS_ReallocMemory(vaContextHeap->pHeapBase, (vaContextHeap->uiAllocatedHeapElements + DDI_MEDIA_HEAP_INCREMENTAL_SIZE) * sizeof(DDI_MEDIA_VACONTEXT_HEAP_ELEMENT));
+        uint32_t incrementalSize = 0;
+        void *newHeapBase = MediaLibvaCommonNext::GrowHeap(vaContextHeap, incrementalSize);
 
         if (nullptr == newHeapBase)
         {
-            DDI_ASSERTMESSAGE("DDI: realloc failed.");
+            DDI_ASSERTMESSAGE("DDI: heap growth failed.");
             return nullptr;
         }
-        vaContextHeap->pHeapBase                            = newHeapBase;
         PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT vacontextHeapBase = (PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT)vaContextHeap->pHeapBase;
         vaContextHeap->pFirstFreeHeapElement        = (void*)(&(vacontextHeapBase[vaContextHeap->uiAllocatedHeapElements]));
-        for (int32_t i = 0; i < (DDI_MEDIA_HEAP_INCREMENTAL_SIZE); i++)
+        for (uint32_t i = 0; i < incrementalSize; i++)
         {
             vacontextHeapElmt                       = &vacontextHeapBase[vaContextHeap->uiAllocatedHeapElements + i];
-            vacontextHeapElmt->pNextFree            = (i == (DDI_MEDIA_HEAP_INCREMENTAL_SIZE - 1))? nullptr : &vacontextHeapBase[vaContextHeap->uiAllocatedHeapElements + i + 1];
+            vacontextHeapElmt->pNextFree            = (i == (incrementalSize - 1))? nullptr : &vacontextHeapBase[vaContextHeap->uiAllocatedHeapElements + i + 1];
             vacontextHeapElmt->uiVaContextID        = vaContextHeap->uiAllocatedHeapElements + i;
             vacontextHeapElmt->pVaContext           = nullptr;
         }
-        vaContextHeap->uiAllocatedHeapElements     += DDI_MEDIA_HEAP_INCREMENTAL_SIZE;
+        MediaLibvaCommonNext::SetHeapSize(vaContextHeap, vaContextHeap->uiAllocatedHeapElements + incrementalSize);
     }
 
     vacontextHeapElmt                               = (PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT)vaContextHeap->pFirstFreeHeapElement;
@@ -106,6 +106,9 @@
                  (devid) == PCI_CHIP_E7221_G || \
                  (devid) == PCI_CHIP_I915_GM)
 
+/* Default reuse cache budget, overridden in MB by MEDIA_BO_CACHE_MAX_SIZE */
+#define BO_CACHE_DEFAULT_MAX_SIZE     (512ull * 1024 * 1024)
+
 struct mos_gem_bo_bucket {
     drmMMListHead head;
     unsigned long size;
@@ -133,6 +136,15 @@ struct mos_bufmgr_gem {
     int num_buckets;
     time_t time;
 
+    /** Bytes held by the reuse cache, and its budget (0 means unbounded) */
+    uint64_t cache_size;
+    uint64_t cache_max_size;
+
+    /** Reuse cache statistics */
+    uint64_t cache_hits;
+    uint64_t cache_misses;
+    uint64_t cache_evictions;
+
     drmMMListHead managers;
 
     drmMMListHead named;
@@ -802,6 +814,15 @@ mos_gem_bo_madvise(struct mos_linux_bo *bo, int madv)
          madv);
 }
 
+/* take a cached BO out of its bucket */
+static void
+mos_gem_bo_cache_remove(struct mos_bufmgr_gem *bufmgr_gem,
+                    struct mos_bo_gem *bo_gem)
+{
+    DRMLISTDEL(&bo_gem->head);
+    bufmgr_gem->cache_size -= bo_gem->bo.size;
+}
+
 /* drop the oldest entries that have been purged by the kernel */
 static void
 mos_gem_bo_cache_purge_bucket(struct mos_bufmgr_gem *bufmgr_gem,
@@ -816,11 +837,47 @@ mos_gem_bo_cache_purge_bucket(struct mos_bufmgr_gem *bufmgr_gem,
             (bufmgr_gem, bo_gem, I915_MADV_DONTNEED))
             break;
 
-        DRMLISTDEL(&bo_gem->head);
+        mos_gem_bo_cache_remove(bufmgr_gem, bo_gem);
         mos_gem_bo_free(&bo_gem->bo);
     }
 }
 
+/* free the least recently cached BOs until the cache fits in its budget */
+static void
+mos_gem_bo_cache_evict(struct mos_bufmgr_gem *bufmgr_gem)
+{
+    int i;
+
+    if (bufmgr_gem->cache_max_size == 0)
+        return;
+
+    while (bufmgr_gem->cache_size > bufmgr_gem->cache_max_size) {
+        struct mos_bo_gem *oldest = nullptr;
+
+        /* each bucket is ordered by free time, so its head is its oldest BO */
+        for (i = 0; i < bufmgr_gem->num_buckets; i++) {
+            struct mos_gem_bo_bucket *bucket =
+                &bufmgr_gem->cache_bucket[i];
+            struct mos_bo_gem *bo_gem;
+
+            if (DRMLISTEMPTY(&bucket->head))
+                continue;
+
+            bo_gem = DRMLISTENTRY(struct mos_bo_gem,
+                          bucket->head.next, head);
+            if (oldest == nullptr || bo_gem->free_time < oldest->free_time)
+                oldest = bo_gem;
+        }
+
+        if (oldest == nullptr)
+            break;
+
+        mos_gem_bo_cache_remove(bufmgr_gem, oldest);
+        mos_gem_bo_free(&oldest->bo);
+        bufmgr_gem->cache_evictions++;
+    }
+}
+
 static enum mos_memory_zone
 mos_gem_bo_memzone_for_address(uint64_t address)
 {
@@ -905,6 +962,23 @@ mos_gem_bo_alloc_internal(struct mos_bufmgr *bufmgr,
     {
         pthread_mutex_lock(&bufmgr_gem->lock);
 
+        /* Same reuse cache policy as the i915 bufmgr, mock BOs are never busy */
+        if (bucket != nullptr && !DRMLISTEMPTY(&bucket->head)) {
+            bo_gem = DRMLISTENTRY(struct mos_bo_gem,
+                          for_render ? bucket->head.prev : bucket->head.next, head);
+            mos_gem_bo_cache_remove(bufmgr_gem, bo_gem);
+            bufmgr_gem->cache_hits++;
+
+            bo_gem->bo.align = alignment;
+            bo_gem->name = name;
+            atomic_set(&bo_gem->refcount, 1);
+            pthread_mutex_unlock(&bufmgr_gem->lock);
+
+            return &bo_gem->bo;
+        }
+        if (bucket != nullptr)
+            bufmgr_gem->cache_misses++;
+
         bo_gem = (struct mos_bo_gem *)calloc(1, sizeof(*bo_gem));
         if (!bo_gem)
             return nullptr;
@@ -913,6 +987,8 @@ mos_gem_bo_alloc_internal(struct mos_bufmgr *bufmgr,
         bo_gem->bo.handle = -1;
         bo_gem->bo.bufmgr = bufmgr;
         bo_gem->bo.align = alignment;
+        bo_gem->name = name;
+        bo_gem->reusable = true;
 #ifdef __cplusplus
             bo_gem->bo.virt = malloc(bo_size);
             bo_gem->mem_virtual = bo_gem->bo.virt;
@@ -939,7 +1015,7 @@ retry:
              */
             bo_gem = DRMLISTENTRY(struct mos_bo_gem,
                           bucket->head.prev, head);
-            DRMLISTDEL(&bo_gem->head);
+            mos_gem_bo_cache_remove(bufmgr_gem, bo_gem);
             alloc_from_cache = true;
             bo_gem->bo.align = alignment;
         } else {
@@ -955,7 +1031,7 @@ retry:
                           bucket->head.next, head);
             if (!mos_gem_bo_busy(&bo_gem->bo)) {
                 alloc_from_cache = true;
-                DRMLISTDEL(&bo_gem->head);
+                mos_gem_bo_cache_remove(bufmgr_gem, bo_gem);
             }
         }
 
@@ -976,6 +1052,11 @@ retry:
             }
         }
     }
+
+    if (alloc_from_cache)
+        bufmgr_gem->cache_hits++;
+    else if (bucket != nullptr)
+        bufmgr_gem->cache_misses++;
     pthread_mutex_unlock(&bufmgr_gem->lock);
 
     if (!alloc_from_cache) {
@@ -1455,7 +1536,7 @@ mos_gem_cleanup_bo_cache(struct mos_bufmgr_gem *bufmgr_gem, time_t time)
             if (time - bo_gem->free_time <= 1)
                 break;
 
-            DRMLISTDEL(&bo_gem->head);
+            mos_gem_bo_cache_remove(bufmgr_gem, bo_gem);
 
             mos_gem_bo_free(&bo_gem->bo);
         }
@@ -1507,7 +1588,18 @@ mos_gem_bo_unreference_final(struct mos_linux_bo *bo, time_t time)
         bo_gem->softpin_target_size = 0;
     }
     if(GetDrmMode()){
-        mos_gem_bo_free(bo);
+        bucket = mos_gem_bo_bucket_for_size(bufmgr_gem, bo->size);
+        if (bufmgr_gem->bo_reuse && bo_gem->reusable && bucket != nullptr) {
+            bo_gem->free_time = time;
+            bo_gem->name = nullptr;
+
+            DRMLISTADDTAIL(&bo_gem->head, &bucket->head);
+            bufmgr_gem->cache_size += bo->size;
+
+            mos_gem_bo_cache_evict(bufmgr_gem);
+        } else {
+            mos_gem_bo_free(bo);
+        }
         return;
     }
 
@@ -1531,6 +1623,9 @@ mos_gem_bo_unreference_final(struct mos_linux_bo *bo, time_t time)
         bo_gem->validate_index = -1;
 
         DRMLISTADDTAIL(&bo_gem->head, &bucket->head);
+        bufmgr_gem->cache_size += bo->size;
+
+        mos_gem_bo_cache_evict(bufmgr_gem);
     } else {
         mos_gem_bo_free(bo);
     }
@@ -2187,7 +2282,7 @@ mos_bufmgr_gem_destroy(struct mos_bufmgr *bufmgr)
         while (!DRMLISTEMPTY(&bucket->head)) {
             bo_gem = DRMLISTENTRY(struct mos_bo_gem,
                           bucket->head.next, head);
-            DRMLISTDEL(&bo_gem->head);
+            mos_gem_bo_cache_remove(bufmgr_gem, bo_gem);
 
             mos_gem_bo_free(&bo_gem->bo);
         }
@@ -3222,6 +3317,32 @@ mos_bufmgr_gem_enable_reuse(struct mos_bufmgr *bufmgr)
     bufmgr_gem->bo_reuse = true;
 }
 
+/**
+ * Reports buffer object reuse cache statistics.
+ *
+ * Any of the output pointers may be nullptr.
+ */
+void
+mos_bufmgr_gem_get_bo_cache_stats(struct mos_bufmgr *bufmgr,
+                    uint64_t *hits,
+                    uint64_t *misses,
+                    uint64_t *evictions,
+                    uint64_t *cached_bytes)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *) bufmgr;
+
+    pthread_mutex_lock(&bufmgr_gem->lock);
+    if (hits)
+        *hits = bufmgr_gem->cache_hits;
+    if (misses)
+        *misses = bufmgr_gem->cache_misses;
+    if (evictions)
+        *evictions = bufmgr_gem->cache_evictions;
+    if (cached_bytes)
+        *cached_bytes = bufmgr_gem->cache_size;
+    pthread_mutex_unlock(&bufmgr_gem->lock);
+}
+
 /**
  * Enable use of fenced reloc type.
  *
@@ -3959,6 +4080,7 @@ mos_bufmgr_gem_init(int fd, int batch_size)
     drm_i915_getparam_t gp;
     int ret, tmp;
     bool exec2 = false;
+    char *cache_max_size_env;
 
     pthread_mutex_lock(&bufmgr_list_mutex);
 
@@ -4104,6 +4226,12 @@ mos_bufmgr_gem_init(int fd, int batch_size)
     DRMINITLISTHEAD(&bufmgr_gem->named);
     init_cache_buckets(bufmgr_gem);
 
+    /* Reuse cache budget, MEDIA_BO_CACHE_MAX_SIZE=0 removes the limit */
+    bufmgr_gem->cache_max_size = BO_CACHE_DEFAULT_MAX_SIZE;
+    cache_max_size_env = getenv("MEDIA_BO_CACHE_MAX_SIZE");
+    if (cache_max_size_env != nullptr)
+        bufmgr_gem->cache_max_size = strtoull(cache_max_size_env, nullptr, 0) * 1024 * 1024;
+
     DRMLISTADD(&bufmgr_gem->managers, &bufmgr_list);
     bufmgr_gem->use_softpin = false;
     mos_vma_heap_init(&bufmgr_gem->vma_heap[MEMZONE_SYS], MEMZONE_SYS_START, MEMZONE_SYS_SIZE);
@@ -0,0 +1,493 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+#include "decode_hevc_slice_header_parser.h"
+
+using namespace decode;
+
+//!
+//! \brief  Writes slice_segment_header() syntax the way an encoder would,
+//!         so the parser output can be checked against known syntax values.
+//!
+class HevcBitWriter
+{
+public:
+    void PutBits(uint32_t value, uint32_t numBits)
+    {
+        for (uint32_t i = numBits; i > 0; i--)
+        {
+            if ((m_numBits & 7) == 0)
+            {
+                m_rbsp.push_back(0);
+            }
+            m_rbsp.back() |= ((value >> (i - 1)) & 1) << (7 - (m_numBits & 7));
+            m_numBits++;
+        }
+    }
+
+    void PutUe(uint32_t value)
+    {
+        uint32_t codeNum = value + 1;
+        uint32_t len     = 0;
+        while ((codeNum >> len) > 1)
+        {
+            len++;
+        }
+        PutBits(0, len);
+        PutBits(codeNum, len + 1);
+    }
+
+    void PutSe(int32_t value)
+    {
+        PutUe(value > 0 ? 2 * value - 1 : -2 * value);
+    }
+
+    // nal_unit_header() with nuh_layer_id 0 and TemporalId 0
+    void PutNalHeader(uint8_t nalUnitType)
+    {
+        PutBits(0, 1);
+        PutBits(nalUnitType, 6);
+        PutBits(0, 6);
+        PutBits(1, 3);
+    }
+
+    // byte_alignment(), returns RBSP size of the slice header
+    uint32_t EndHeader()
+    {
+        PutBits(1, 1);
+        while (m_numBits & 7)
+        {
+            PutBits(0, 1);
+        }
+        return (uint32_t)m_rbsp.size();
+    }
+
+    void PutBytes(const std::vector<uint8_t> &bytes)
+    {
+        for (auto b : bytes)
+        {
+            PutBits(b, 8);
+        }
+    }
+
+    //!
+    //! \brief  Append the NAL unit with emulation prevention bytes inserted
+    //! \param  [in, out] bitstream
+    //!         Byte stream the start code and NAL unit are appended to
+    //! \param  [out] epbRbspPos
+    //!         RBSP offsets of the bytes each emulation prevention byte was inserted before
+    //!
+    void AppendTo(std::vector<uint8_t> &bitstream, std::vector<uint32_t> &epbRbspPos) const
+    {
+        bitstream.insert(bitstream.end(), {0, 0, 1});
+
+        uint32_t zeros = 0;
+        for (uint32_t i = 0; i < m_rbsp.size(); i++)
+        {
+            if (zeros >= 2 && m_rbsp[i] <= 3)
+            {
+                bitstream.push_back(3);
+                epbRbspPos.push_back(i);
+                zeros = 0;
+            }
+            zeros = (m_rbsp[i] == 0) ? zeros + 1 : 0;
+            bitstream.push_back(m_rbsp[i]);
+        }
+    }
+
+protected:
+    std::vector<uint8_t> m_rbsp;
+    uint32_t             m_numBits = 0;
+};
+
+class HevcSliceHeaderParserTest : public testing::Test
+{
+protected:
+    enum
+    {
+        nalTrailR = 1,
+        sliceB    = 0,
+        sliceP    = 1,
+        sliceI    = 2,
+    };
+
+    void SetUp() override
+    {
+        // 1920x1080, 8x8 min CB, 64x64 CTB: 30x17 CTBs, 9 bit slice_segment_address
+        MOS_ZeroMemory(&m_picParams, sizeof(m_picParams));
+        m_picParams.PicWidthInMinCbsY                        = 240;
+        m_picParams.PicHeightInMinCbsY                       = 135;
+        m_picParams.log2_diff_max_min_luma_coding_block_size = 3;
+        m_picParams.chroma_format_idc                        = 1;
+        m_picParams.log2_max_pic_order_cnt_lsb_minus4        = 4;
+        m_picParams.num_short_term_ref_pic_sets              = 1;
+        m_picParams.num_ref_idx_l0_default_active_minus1     = 1;
+        m_picParams.num_ref_idx_l1_default_active_minus1     = 0;
+
+        // StCurrBefore {0, 1}, StCurrAfter {2}, no long term
+        memset(m_picParams.RefPicSetStCurrBefore, 0xff, sizeof(m_picParams.RefPicSetStCurrBefore));
+        memset(m_picParams.RefPicSetStCurrAfter, 0xff, sizeof(m_picParams.RefPicSetStCurrAfter));
+        memset(m_picParams.RefPicSetLtCurr, 0xff, sizeof(m_picParams.RefPicSetLtCurr));
+        m_picParams.RefPicSetStCurrBefore[0] = 0;
+        m_picParams.RefPicSetStCurrBefore[1] = 1;
+        m_picParams.RefPicSetStCurrAfter[0]  = 2;
+    }
+
+    // slice_segment_header() up to and including slice_type, for a trailing picture
+    void PutHeaderStart(HevcBitWriter &writer, uint8_t sliceType, uint32_t address = 0, bool dependent = false)
+    {
+        writer.PutNalHeader(nalTrailR);
+        writer.PutBits(address == 0, 1);  // first_slice_segment_in_pic_flag
+        writer.PutUe(0);                  // slice_pic_parameter_set_id
+        if (address != 0)
+        {
+            if (m_picParams.dependent_slice_segments_enabled_flag)
+            {
+                writer.PutBits(dependent, 1);
+            }
+            writer.PutBits(address, 9);
+        }
+        if (dependent)
+        {
+            return;
+        }
+        writer.PutBits(0, m_picParams.num_extra_slice_header_bits);
+        writer.PutUe(sliceType);
+        writer.PutBits(5, m_picParams.log2_max_pic_order_cnt_lsb_minus4 + 4);  // slice_pic_order_cnt_lsb
+        writer.PutBits(1, 1);                                                    // short_term_ref_pic_set_sps_flag
+    }
+
+    // slice_qp_delta and the rest of an I slice header
+    void PutHeaderEnd(HevcBitWriter &writer, int32_t qpDelta)
+    {
+        writer.PutSe(qpDelta);
+    }
+
+    void Append(const HevcBitWriter &writer, std::vector<uint8_t> &bitstream,
+        CODEC_HEVC_SLICE_PARAMS &slice, std::vector<uint32_t> *epbRbspPos = nullptr)
+    {
+        std::vector<uint32_t> epb;
+        MOS_ZeroMemory(&slice, sizeof(slice));
+        slice.slice_data_offset = (uint32_t)bitstream.size();
+        writer.AppendTo(bitstream, epb);
+        slice.slice_data_size = (uint32_t)bitstream.size() - slice.slice_data_offset;
+        if (epbRbspPos)
+        {
+            *epbRbspPos = epb;
+        }
+    }
+
+    static void ExpectRef(const CODEC_PICTURE &ref, uint8_t frameIdx)
+    {
+        EXPECT_EQ(ref.FrameIdx, frameIdx);
+        EXPECT_EQ(ref.PicEntry, frameIdx);
+        EXPECT_EQ(ref.PicFlags, PICTURE_FRAME);
+    }
+
+    static void ExpectInvalidRef(const CODEC_PICTURE &ref)
+    {
+        EXPECT_EQ(ref.FrameIdx, 0x7f);
+        EXPECT_EQ(ref.PicEntry, 0xff);
+        EXPECT_EQ(ref.PicFlags, PICTURE_INVALID);
+    }
+
+    CODEC_HEVC_PIC_PARAMS  m_picParams;
+    HevcSliceHeaderParser  m_parser;
+};
+
+TEST_F(HevcSliceHeaderParserTest, PredWeightTable)
+{
+    m_picParams.weighted_pred_flag = 1;
+
+    HevcBitWriter writer;
+    PutHeaderStart(writer, sliceP);
+    writer.PutBits(0, 1);  // num_ref_idx_active_override_flag, two refs from default
+
+    // pred_weight_table(): luma denom 6, chroma denom 5, weights on ref 0 only
+    writer.PutUe(6);
+    writer.PutSe(-1);
+    writer.PutBits(1, 1);  // luma_weight_l0_flag[0]
+    writer.PutBits(0, 1);  // luma_weight_l0_flag[1]
+    writer.PutBits(1, 1);  // chroma_weight_l0_flag[0]
+    writer.PutBits(0, 1);  // chroma_weight_l0_flag[1]
+    writer.PutSe(3);       // delta_luma_weight_l0[0]
+    writer.PutSe(-2);      // luma_offset_l0[0]
+    writer.PutSe(2);       // delta_chroma_weight_l0[0][0]
+    writer.PutSe(-5);      // delta_chroma_offset_l0[0][0]
+    writer.PutSe(-4);      // delta_chroma_weight_l0[0][1]
+    writer.PutSe(200);     // delta_chroma_offset_l0[0][1]
+
+    writer.PutUe(2);  // five_minus_max_num_merge_cand
+    PutHeaderEnd(writer, -3);
+    uint32_t headerSize = writer.EndHeader();
+    writer.PutBytes({0xa5, 0x5a, 0xc3});
+
+    std::vector<uint8_t>    bitstream;
+    CODEC_HEVC_SLICE_PARAMS slice;
+    Append(writer, bitstream, slice);
+
+    ASSERT_EQ(m_parser.ParseSlices(m_picParams, bitstream.data(), (uint32_t)bitstream.size(), &slice, 1), MOS_STATUS_SUCCESS);
+
+    EXPECT_EQ(slice.LongSliceFlags.fields.slice_type, sliceP);
+    EXPECT_EQ(slice.num_ref_idx_l0_active_minus1, 1);
+    EXPECT_EQ(slice.luma_log2_weight_denom, 6);
+    EXPECT_EQ((int8_t)slice.delta_chroma_log2_weight_denom, -1);
+
+    EXPECT_EQ(slice.delta_luma_weight_l0[0], 3);
+    EXPECT_EQ(slice.luma_offset_l0[0], -2);
+    EXPECT_EQ(slice.delta_chroma_weight_l0[0][0], 2);
+    EXPECT_EQ(slice.delta_chroma_weight_l0[0][1], -4);
+    // ChromaOffset = Clip3(-128, 127, 128 - ((128 * ChromaWeight) >> ChromaLog2WeightDenom) + delta_chroma_offset)
+    EXPECT_EQ(slice.ChromaOffsetL0[0][0], 128 - ((128 * (32 + 2)) >> 5) - 5);
+    EXPECT_EQ(slice.ChromaOffsetL0[0][1], 127);
+
+    // Flags off: weights stay at the default
+    EXPECT_EQ(slice.delta_luma_weight_l0[1], 0);
+    EXPECT_EQ(slice.luma_offset_l0[1], 0);
+    EXPECT_EQ(slice.delta_chroma_weight_l0[1][0], 0);
+    EXPECT_EQ(slice.ChromaOffsetL0[1][0], 0);
+
+    EXPECT_EQ(slice.five_minus_max_num_merge_cand, 2);
+    EXPECT_EQ(slice.slice_qp_delta, -3);
+    EXPECT_EQ(slice.collocated_ref_idx, 0xff);
+
+    ExpectRef(slice.RefPicList[0][0], 0);
+    ExpectRef(slice.RefPicList[0][1], 1);
+    ExpectInvalidRef(slice.RefPicList[0][2]);
+    ExpectInvalidRef(slice.RefPicList[1][0]);
+
+    EXPECT_EQ(slice.ByteOffsetToSliceData, headerSize);
+    EXPECT_EQ(slice.NumEmuPrevnBytesInSliceHdr, 0);
+    EXPECT_EQ(slice.LongSliceFlags.fields.LastSliceOfPic, 1);
+}
+
+TEST_F(HevcSliceHeaderParserTest, RefPicListModification)
+{
+    m_picParams.lists_modification_present_flag = 1;
+
+    HevcBitWriter writer;
+    PutHeaderStart(writer, sliceB);
+    writer.PutBits(1, 1);  // num_ref_idx_active_override_flag
+    writer.PutUe(2);       // num_ref_idx_l0_active_minus1
+    writer.PutUe(1);       // num_ref_idx_l1_active_minus1
+
+    // NumPicTotalCurr is 3, so list_entry is 2 bits
+    writer.PutBits(1, 1);  // ref_pic_list_modification_flag_l0
+    writer.PutBits(2, 2);
+    writer.PutBits(0, 2);
+    writer.PutBits(1, 2);
+    writer.PutBits(1, 1);  // ref_pic_list_modification_flag_l1
+    writer.PutBits(0, 2);
+    writer.PutBits(2, 2);
+
+    writer.PutBits(1, 1);  // mvd_l1_zero_flag
+    writer.PutUe(0);       // five_minus_max_num_merge_cand
+    PutHeaderEnd(writer, 4);
+    uint32_t headerSize = writer.EndHeader();
+    writer.PutBytes({0x80});
+
+    std::vector<uint8_t>    bitstream;
+    CODEC_HEVC_SLICE_PARAMS slice;
+    Append(writer, bitstream, slice);
+
+    ASSERT_EQ(m_parser.ParseSlices(m_picParams, bitstream.data(), (uint32_t)bitstream.size(), &slice, 1), MOS_STATUS_SUCCESS);
+
+    EXPECT_EQ(slice.LongSliceFlags.fields.slice_type, sliceB);
+    EXPECT_EQ(slice.LongSliceFlags.fields.mvd_l1_zero_flag, 1);
+    EXPECT_EQ(slice.num_ref_idx_l0_active_minus1, 2);
+    EXPECT_EQ(slice.num_ref_idx_l1_active_minus1, 1);
+    EXPECT_EQ(slice.slice_qp_delta, 4);
+
+    // RefPicListTemp0 is {0, 1, 2}, list_entry_l0 {2, 0, 1}
+    ExpectRef(slice.RefPicList[0][0], 2);
+    ExpectRef(slice.RefPicList[0][1], 0);
+    ExpectRef(slice.RefPicList[0][2], 1);
+    ExpectInvalidRef(slice.RefPicList[0][3]);
+
+    // RefPicListTemp1 is {2, 0, 1}, list_entry_l1 {0, 2}
+    ExpectRef(slice.RefPicList[1][0], 2);
+    ExpectRef(slice.RefPicList[1][1], 1);
+    ExpectInvalidRef(slice.RefPicList[1][2]);
+
+    EXPECT_EQ(slice.ByteOffsetToSliceData, headerSize);
+}
+
+TEST_F(HevcSliceHeaderParserTest, DefaultRefPicListsWrap)
+{
+    HevcBitWriter writer;
+    PutHeaderStart(writer, sliceB);
+    writer.PutBits(1, 1);  // num_ref_idx_active_override_flag
+    writer.PutUe(4);       // more refs than NumPicTotalCurr, the temp list repeats
+    writer.PutUe(0);
+    writer.PutBits(0, 1);  // mvd_l1_zero_flag
+    writer.PutUe(0);
+    PutHeaderEnd(writer, 0);
+    uint32_t headerSize = writer.EndHeader();
+    writer.PutBytes({0x80});
+
+    std::vector<uint8_t>    bitstream;
+    CODEC_HEVC_SLICE_PARAMS slice;
+    Append(writer, bitstream, slice);
+
+    ASSERT_EQ(m_parser.ParseSlices(m_picParams, bitstream.data(), (uint32_t)bitstream.size(), &slice, 1), MOS_STATUS_SUCCESS);
+
+    ExpectRef(slice.RefPicList[0][0], 0);
+    ExpectRef(slice.RefPicList[0][1], 1);
+    ExpectRef(slice.RefPicList[0][2], 2);
+    ExpectRef(slice.RefPicList[0][3], 0);
+    ExpectRef(slice.RefPicList[0][4], 1);
+    ExpectRef(slice.RefPicList[1][0], 2);
+    ExpectInvalidRef(slice.RefPicList[1][1]);
+
+    EXPECT_EQ(slice.ByteOffsetToSliceData, headerSize);
+}
+
+TEST_F(HevcSliceHeaderParserTest, EmulationPreventionBytes)
+{
+    m_picParams.slice_segment_header_extension_present_flag = 1;
+
+    HevcBitWriter writer;
+    PutHeaderStart(writer, sliceI);
+    PutHeaderEnd(writer, 0);
+    // Zero filled header extension, needs emulation prevention bytes
+    writer.PutUe(6);
+    writer.PutBytes({0, 0, 0, 0, 0, 0});
+    uint32_t headerSize = writer.EndHeader();
+    // Slice data with a start code emulation of its own, which is not part of the header
+    writer.PutBytes({0x55, 0, 0, 1, 0x55});
+
+    std::vector<uint8_t>    bitstream;
+    std::vector<uint32_t>   epbRbspPos;
+    CODEC_HEVC_SLICE_PARAMS slice;
+    Append(writer, bitstream, slice, &epbRbspPos);
+
+    uint32_t headerEpbs = 0;
+    for (auto pos : epbRbspPos)
+    {
+        headerEpbs += (pos < headerSize) ? 1 : 0;
+    }
+    ASSERT_GE(headerEpbs, 2u);
+    ASSERT_GT(epbRbspPos.size(), headerEpbs);
+
+    ASSERT_EQ(m_parser.ParseSlices(m_picParams, bitstream.data(), (uint32_t)bitstream.size(), &slice, 1), MOS_STATUS_SUCCESS);
+
+    EXPECT_EQ(slice.LongSliceFlags.fields.slice_type, sliceI);
+    EXPECT_EQ(slice.ByteOffsetToSliceData, headerSize);
+    EXPECT_EQ(slice.NumEmuPrevnBytesInSliceHdr, headerEpbs);
+    // slice_data() starts right after the escaped header in the NAL unit
+    EXPECT_EQ(bitstream[slice.slice_data_offset + slice.ByteOffsetToSliceData + slice.NumEmuPrevnBytesInSliceHdr], 0x55);
+    ExpectInvalidRef(slice.RefPicList[0][0]);
+    ExpectInvalidRef(slice.RefPicList[1][0]);
+}
+
+TEST_F(HevcSliceHeaderParserTest, MultipleSlices)
+{
+    m_picParams.dependent_slice_segments_enabled_flag = 1;
+
+    std::vector<uint8_t>    bitstream;
+    CODEC_HEVC_SLICE_PARAMS slices[3];
+    uint32_t                headerSize[3];
+
+    HevcBitWriter first;
+    PutHeaderStart(first, sliceI);
+    PutHeaderEnd(first, -2);
+    headerSize[0] = first.EndHeader();
+    first.PutBytes({0x11, 0x22});
+    Append(first, bitstream, slices[0]);
+
+    HevcBitWriter second;
+    PutHeaderStart(second, sliceP, 100);
+    second.PutBits(0, 1);  // num_ref_idx_active_override_flag
+    second.PutUe(1);       // five_minus_max_num_merge_cand
+    PutHeaderEnd(second, 5);
+    headerSize[1] = second.EndHeader();
+    second.PutBytes({0x33, 0x44, 0x55});
+    Append(second, bitstream, slices[1]);
+
+    HevcBitWriter third;
+    PutHeaderStart(third, sliceP, 200, true);
+    headerSize[2] = third.EndHeader();
+    third.PutBytes({0x66});
+    Append(third, bitstream, slices[2]);
+
+    uint32_t offsets[3] = {slices[0].slice_data_offset, slices[1].slice_data_offset, slices[2].slice_data_offset};
+    uint32_t sizes[3]   = {slices[0].slice_data_size, slices[1].slice_data_size, slices[2].slice_data_size};
+
+    ASSERT_EQ(m_parser.ParseSlices(m_picParams, bitstream.data(), (uint32_t)bitstream.size(), slices, 3), MOS_STATUS_SUCCESS);
+
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        // Long format offsets point past the start code prefix
+        EXPECT_EQ(slices[i].slice_data_offset, offsets[i] + 3);
+        EXPECT_EQ(slices[i].slice_data_size, sizes[i] - 3);
+        EXPECT_EQ(slices[i].ByteOffsetToSliceData, headerSize[i]);
+        EXPECT_EQ(slices[i].LongSliceFlags.fields.LastSliceOfPic, i == 2);
+    }
+
+    EXPECT_EQ(slices[0].slice_segment_address, 0u);
+    EXPECT_EQ(slices[0].LongSliceFlags.fields.slice_type, sliceI);
+    EXPECT_EQ(slices[0].slice_qp_delta, -2);
+
+    EXPECT_EQ(slices[1].slice_segment_address, 100u);
+    EXPECT_EQ(slices[1].LongSliceFlags.fields.slice_type, sliceP);
+    EXPECT_EQ(slices[1].LongSliceFlags.fields.dependent_slice_segment_flag, 0);
+    EXPECT_EQ(slices[1].five_minus_max_num_merge_cand, 1);
+    EXPECT_EQ(slices[1].slice_qp_delta, 5);
+    ExpectRef(slices[1].RefPicList[0][1], 1);
+
+    // Dependent segment takes its header from the preceding independent one
+    EXPECT_EQ(slices[2].slice_segment_address, 200u);
+    EXPECT_EQ(slices[2].LongSliceFlags.fields.dependent_slice_segment_flag, 1);
+    EXPECT_EQ(slices[2].LongSliceFlags.fields.slice_type, sliceP);
+    EXPECT_EQ(slices[2].five_minus_max_num_merge_cand, 1);
+    EXPECT_EQ(slices[2].slice_qp_delta, 5);
+    ExpectRef(slices[2].RefPicList[0][1], 1);
+}
+
+TEST_F(HevcSliceHeaderParserTest, ChoppedSliceKeepsShortFormatParams)
+{
+    std::vector<uint8_t>    bitstream;
+    CODEC_HEVC_SLICE_PARAMS slices[2];
+
+    HevcBitWriter first;
+    PutHeaderStart(first, sliceI);
+    PutHeaderEnd(first, 0);
+    first.EndHeader();
+    Append(first, bitstream, slices[0]);
+
+    // Partial slice data is left to HuC, which sees the whole slice
+    HevcBitWriter second;
+    PutHeaderStart(second, sliceI, 7);
+    PutHeaderEnd(second, 0);
+    second.EndHeader();
+    Append(second, bitstream, slices[1]);
+    slices[1].slice_chopping = 1;
+
+    CODEC_HEVC_SLICE_PARAMS saved[2];
+    memcpy(saved, slices, sizeof(saved));
+
+    EXPECT_EQ(m_parser.ParseSlices(m_picParams, bitstream.data(), (uint32_t)bitstream.size(), slices, 2), MOS_STATUS_UNIMPLEMENTED);
+    EXPECT_EQ(memcmp(saved, slices, sizeof(saved)), 0);
+}
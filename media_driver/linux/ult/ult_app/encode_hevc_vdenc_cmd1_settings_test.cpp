@@ -0,0 +1,179 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstring>
+#include "gtest/gtest.h"
+#include "encode_hevc_vdenc_const_settings.h"
+#include "codec_def_encode.h"
+#ifdef IGFX_XEHP_SDV_SUPPORTED
+#include "encode_hevc_vdenc_const_settings_xe_xpm_base.h"
+#endif
+#ifdef IGFX_MTL_SUPPORTED
+#include "encode_hevc_vdenc_const_settings_xe_lpm_plus_base.h"
+#endif
+
+using namespace encode;
+
+using VdencCmd1Par = mhw::vdbox::vdenc::_MHW_PAR_T(VDENC_CMD1);
+
+//!
+//! \brief  Runs the HEVC VDENC_CMD1 settings the way SETPAR did before the snapshot,
+//!         and through the snapshot, for the same frame parameters.
+//!         Platform classes append their own lambdas to the common ones, so each
+//!         of them is checked against the snapshot key too.
+//!
+template <typename ConstSettings>
+class HevcVdencCmd1SettingsTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_EQ(m_constSettings.PrepareConstSettings(), MOS_STATUS_SUCCESS);
+
+        m_encodeParams.pSeqParams   = &m_seqParams;
+        m_encodeParams.pPicParams   = &m_picParams;
+        m_encodeParams.pSliceParams = &m_sliceParams;
+        ASSERT_EQ(m_constSettings.Update(&m_encodeParams), MOS_STATUS_SUCCESS);
+
+        m_settings = static_cast<HevcVdencFeatureSettings *>(m_constSettings.GetConstSettings());
+        ASSERT_NE(m_settings, nullptr);
+        ASSERT_FALSE(m_settings->vdencCmd1Settings.empty());
+    }
+
+    // Returns true if the snapshot output is bitwise the same as running the lambda chain.
+    bool CheckFrame(const VdencCmd1Par &input, bool isLowDelay)
+    {
+        VdencCmd1Par expected;
+        VdencCmd1Par actual;
+        memcpy(&expected, &input, sizeof(VdencCmd1Par));
+        memcpy(&actual, &input, sizeof(VdencCmd1Par));
+
+        for (const auto &lambda : m_settings->vdencCmd1Settings)
+        {
+            EXPECT_EQ(lambda(expected, isLowDelay), MOS_STATUS_SUCCESS);
+        }
+
+        HevcVdencCmd1SettingsKey key(m_seqParams, m_picParams, m_sliceParams, isLowDelay);
+        EXPECT_EQ(m_settings->vdencCmd1Snapshot.Apply(m_settings->vdencCmd1Settings, key, actual, isLowDelay), MOS_STATUS_SUCCESS);
+
+        return memcmp(&expected, &actual, sizeof(VdencCmd1Par)) == 0;
+    }
+
+    ConstSettings                     m_constSettings;
+    HevcVdencFeatureSettings          *m_settings    = nullptr;
+    CODEC_HEVC_ENCODE_SEQUENCE_PARAMS m_seqParams    = {};
+    CODEC_HEVC_ENCODE_PICTURE_PARAMS  m_picParams    = {};
+    CODEC_HEVC_ENCODE_SLICE_PARAMS    m_sliceParams  = {};
+    EncoderParams                     m_encodeParams = {};
+};
+
+using HevcVdencConstSettingsTypes = testing::Types<
+    EncodeHevcVdencConstSettings
+#ifdef IGFX_XEHP_SDV_SUPPORTED
+    , EncodeHevcVdencConstSettingsXe_Xpm_Base
+#endif
+#ifdef IGFX_MTL_SUPPORTED
+    , EncodeHevcVdencConstSettingsXe_Lpm_Plus_Base
+#endif
+    >;
+TYPED_TEST_SUITE(HevcVdencCmd1SettingsTest, HevcVdencConstSettingsTypes);
+
+TYPED_TEST(HevcVdencCmd1SettingsTest, SnapshotMatchesLambdaChain)
+{
+    const uint8_t codingTypes[] = {I_TYPE, P_TYPE, B_TYPE};
+    const uint8_t gopRefDists[] = {1, 4, 8};
+    const char    qps[]         = {1, 10, 22, 37, 51};
+
+    // Fields left by other features before VDENC_CMD1 settings run
+    VdencCmd1Par inputs[2];
+    memset((void *)&inputs[0], 0, sizeof(VdencCmd1Par));
+    memset((void *)&inputs[1], 0x5a, sizeof(VdencCmd1Par));
+
+    uint32_t frames = 0;
+    for (uint32_t lowDelayMode = 0; lowDelayMode < 2; lowDelayMode++)
+    {
+        for (uint8_t gopRefDist : gopRefDists)
+        {
+            for (uint8_t codingType : codingTypes)
+            {
+                for (uint8_t level = 0; level <= 4; level++)
+                {
+                    for (char qp : qps)
+                    {
+                        for (uint8_t numRoi = 0; numRoi <= 2; numRoi += 2)
+                        {
+                            for (bool isLowDelay : {false, true})
+                            {
+                                this->m_seqParams.LowDelayMode       = lowDelayMode;
+                                this->m_seqParams.GopRefDist         = gopRefDist;
+                                this->m_picParams.CodingType         = codingType;
+                                this->m_picParams.HierarchLevelPlus1 = level;
+                                this->m_picParams.NumROI             = numRoi;
+                                // Slice QP is pic QP plus the slice delta
+                                this->m_picParams.QpY                = 26;
+                                this->m_sliceParams.slice_qp_delta   = qp - 26;
+
+                                for (const auto &input : inputs)
+                                {
+                                    // Second run of the same frame is served from the snapshot
+                                    EXPECT_TRUE(this->CheckFrame(input, isLowDelay)) << "frame " << frames;
+                                    EXPECT_TRUE(this->CheckFrame(input, isLowDelay)) << "frame " << frames;
+                                    frames++;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    EXPECT_EQ(frames, 2u * 3 * 3 * 5 * 5 * 2 * 2 * 2);
+}
+
+TYPED_TEST(HevcVdencCmd1SettingsTest, SameFrameSkipsLambdaChain)
+{
+    uint32_t chainRuns = 0;
+    this->m_settings->vdencCmd1Settings.push_back(
+        [&](VdencCmd1Par &par, bool isLowDelay) -> MOS_STATUS {
+            chainRuns++;
+            return MOS_STATUS_SUCCESS;
+        });
+
+    VdencCmd1Par par;
+    memset((void *)&par, 0, sizeof(VdencCmd1Par));
+    this->m_picParams.CodingType = P_TYPE;
+    this->m_picParams.QpY        = 30;
+    HevcVdencCmd1SettingsKey key(this->m_seqParams, this->m_picParams, this->m_sliceParams, false);
+
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        VdencCmd1Par output;
+        memcpy(&output, &par, sizeof(VdencCmd1Par));
+        ASSERT_EQ(this->m_settings->vdencCmd1Snapshot.Apply(this->m_settings->vdencCmd1Settings, key, output, false), MOS_STATUS_SUCCESS);
+    }
+    EXPECT_EQ(chainRuns, 1u);
+
+    this->m_picParams.QpY = 31;
+    HevcVdencCmd1SettingsKey newKey(this->m_seqParams, this->m_picParams, this->m_sliceParams, false);
+    ASSERT_EQ(this->m_settings->vdencCmd1Snapshot.Apply(this->m_settings->vdencCmd1Settings, newKey, par, false), MOS_STATUS_SUCCESS);
+    EXPECT_EQ(chainRuns, 2u);
+}
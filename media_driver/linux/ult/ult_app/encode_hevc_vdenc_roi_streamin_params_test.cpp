@@ -0,0 +1,167 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "encode_hevc_vdenc_roi_streamin_params.h"
+
+using namespace encode;
+
+//!
+//! \brief  Checks which frame parameter changes make HevcVdencRoi regenerate
+//!         the streamin data instead of reusing the one of last frame.
+//!
+class HevcVdencRoiStreaminParamsTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_seqParams.TargetUsage                       = 4;
+        m_seqParams.RateControlMethod                 = RATECONTROL_CQP;
+        m_seqParams.log2_min_coding_block_size_minus3 = 0;
+        m_picParams.QpY                               = 30;
+        m_sliceParams.slice_qp_delta                  = -2;
+
+        m_picParams.NumROI = 2;
+        m_picParams.ROI[0] = {0, 4, 0, 4, 2};
+        m_picParams.ROI[1] = {8, 16, 8, 16, -3};
+
+        m_dirtyRects[0]           = {2, 6, 2, 6, 0};
+        m_picParams.NumDirtyRects = 1;
+        m_picParams.pDirtyRect    = m_dirtyRects;
+
+        Save(true, true);
+    }
+
+    void Save(bool roiEnabled, bool dirtyRoiEnabled)
+    {
+        m_params.Save(m_width, m_height, m_height, m_seqParams, m_picParams, m_sliceParams, roiEnabled, dirtyRoiEnabled);
+    }
+
+    bool Matches(bool roiEnabled = true, bool dirtyRoiEnabled = true)
+    {
+        return m_params.Matches(m_width, m_height, m_height, m_seqParams, m_picParams, m_sliceParams, roiEnabled, dirtyRoiEnabled);
+    }
+
+    HevcVdencRoiStreaminParams        m_params;
+    uint32_t                          m_width         = 1920;
+    uint32_t                          m_height        = 1080;
+    CODEC_ROI                         m_dirtyRects[2] = {};
+    CODEC_HEVC_ENCODE_SEQUENCE_PARAMS m_seqParams     = {};
+    CODEC_HEVC_ENCODE_PICTURE_PARAMS  m_picParams     = {};
+    CODEC_HEVC_ENCODE_SLICE_PARAMS    m_sliceParams   = {};
+};
+
+TEST_F(HevcVdencRoiStreaminParamsTest, SameFrameMatches)
+{
+    EXPECT_TRUE(Matches());
+
+    // Only the region contents count, not where the caller keeps them
+    CODEC_ROI dirtyRects[1] = {m_dirtyRects[0]};
+    m_picParams.pDirtyRect  = dirtyRects;
+    EXPECT_TRUE(Matches());
+}
+
+TEST_F(HevcVdencRoiStreaminParamsTest, EachFrameParamInvalidates)
+{
+    m_width = 1280;
+    EXPECT_FALSE(Matches());
+    m_width = 1920;
+
+    m_height = 720;
+    EXPECT_FALSE(Matches());
+    m_height = 1080;
+
+    m_seqParams.TargetUsage = 7;
+    EXPECT_FALSE(Matches());
+    m_seqParams.TargetUsage = 4;
+
+    m_seqParams.RateControlMethod = RATECONTROL_VBR;
+    EXPECT_FALSE(Matches());
+    m_seqParams.RateControlMethod = RATECONTROL_CQP;
+
+    m_seqParams.log2_min_coding_block_size_minus3 = 1;
+    EXPECT_FALSE(Matches());
+    m_seqParams.log2_min_coding_block_size_minus3 = 0;
+
+    m_picParams.QpY = 31;
+    EXPECT_FALSE(Matches());
+    m_picParams.QpY = 30;
+
+    m_sliceParams.slice_qp_delta = 0;
+    EXPECT_FALSE(Matches());
+    m_sliceParams.slice_qp_delta = -2;
+
+    EXPECT_FALSE(Matches(false, true));
+    EXPECT_FALSE(Matches(true, false));
+
+    EXPECT_TRUE(Matches());
+}
+
+TEST_F(HevcVdencRoiStreaminParamsTest, EachRegionFieldInvalidates)
+{
+    uint16_t CODEC_ROI::*fields[] = {&CODEC_ROI::Top, &CODEC_ROI::Bottom, &CODEC_ROI::Left, &CODEC_ROI::Right};
+
+    for (auto field : fields)
+    {
+        m_picParams.ROI[1].*field += 1;
+        EXPECT_FALSE(Matches());
+        m_picParams.ROI[1].*field -= 1;
+
+        m_dirtyRects[0].*field += 1;
+        EXPECT_FALSE(Matches());
+        m_dirtyRects[0].*field -= 1;
+    }
+
+    m_picParams.ROI[0].PriorityLevelOrDQp = 1;
+    EXPECT_FALSE(Matches());
+    m_picParams.ROI[0].PriorityLevelOrDQp = 2;
+
+    m_picParams.NumROI = 1;
+    EXPECT_FALSE(Matches());
+    m_picParams.NumROI = 2;
+
+    m_dirtyRects[1]           = {20, 24, 20, 24, 0};
+    m_picParams.NumDirtyRects = 2;
+    EXPECT_FALSE(Matches());
+    m_picParams.NumDirtyRects = 1;
+
+    m_picParams.pDirtyRect = nullptr;
+    EXPECT_FALSE(Matches());
+    m_picParams.pDirtyRect = m_dirtyRects;
+
+    EXPECT_TRUE(Matches());
+}
+
+TEST_F(HevcVdencRoiStreaminParamsTest, DisabledRegionsAreIgnored)
+{
+    Save(false, false);
+    EXPECT_TRUE(Matches(false, false));
+
+    // Regions left in picture params while ROI is off do not affect streamin data
+    m_picParams.ROI[0].PriorityLevelOrDQp = 5;
+    m_picParams.NumROI                    = 1;
+    m_picParams.pDirtyRect                = nullptr;
+    EXPECT_TRUE(Matches(false, false));
+
+    // Enabling ROI again needs the regions compared
+    EXPECT_FALSE(Matches(true, false));
+}
@@ -0,0 +1,243 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "gtest/gtest.h"
+#include "media_cpu_copy.h"
+#include "media_copy_common.h"
+
+static std::vector<std::string> g_calls;      // Order of wait/lock/unlock calls
+static std::vector<uint8_t>     g_srcData;
+static std::vector<uint8_t>     g_dstData;
+static bool                     g_failDstLock = false;
+
+static MOS_RESOURCE g_src = {};
+static MOS_RESOURCE g_dst = {};
+
+static const char *ResName(PMOS_RESOURCE resource)
+{
+    return resource == &g_src ? "src" : "dst";
+}
+
+static void *StubLockResource(PMOS_INTERFACE osInterface, PMOS_RESOURCE resource, PMOS_LOCK_PARAMS flags)
+{
+    g_calls.push_back(std::string("lock ") + ResName(resource) + (flags->ReadOnly ? " read" : " write"));
+    if (resource == &g_src)
+    {
+        return g_srcData.data();
+    }
+    return g_failDstLock ? nullptr : g_dstData.data();
+}
+
+static MOS_STATUS StubUnlockResource(PMOS_INTERFACE osInterface, PMOS_RESOURCE resource)
+{
+    g_calls.push_back(std::string("unlock ") + ResName(resource));
+    return MOS_STATUS_SUCCESS;
+}
+
+//!
+//! \brief  Cpu copy with the MOS wait replaced, so the test can see it happen before the copy.
+//!
+class TestCpuCopyState : public CpuCopyState
+{
+public:
+    TestCpuCopyState(PMOS_INTERFACE osInterface) : CpuCopyState(osInterface) {}
+
+    MOS_STATUS m_waitStatus = MOS_STATUS_SUCCESS;
+
+protected:
+    MOS_STATUS WaitForResourceIdle(PMOS_RESOURCE resource) override
+    {
+        g_calls.push_back(std::string("wait ") + ResName(resource));
+        return m_waitStatus;
+    }
+};
+
+class MediaCpuCopyTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_osInterface.pfnLockResource   = StubLockResource;
+        m_osInterface.pfnUnlockResource = StubUnlockResource;
+
+        m_src = {&g_src, MOS_MMC_DISABLED, MOS_TILE_LINEAR, MCPY_CPMODE_CLEAR, false};
+        m_dst = {&g_dst, MOS_MMC_DISABLED, MOS_TILE_LINEAR, MCPY_CPMODE_CLEAR, false};
+
+        m_srcDetails.Format   = Format_NV12;
+        m_srcDetails.dwWidth  = 64;
+        m_srcDetails.dwHeight = 64;
+        m_srcDetails.dwPitch  = 64;
+        m_dstDetails          = m_srcDetails;
+
+        g_calls.clear();
+        g_failDstLock = false;
+        g_srcData.resize(4096);
+        g_dstData.assign(4096, 0);
+        for (size_t i = 0; i < g_srcData.size(); i++)
+        {
+            g_srcData[i] = (uint8_t)(i * 7 + 1);
+        }
+    }
+
+    bool IsSupported(bool sysMem, uint64_t size, bool localMem = false)
+    {
+        return CpuCopyState::IsCopySupported(m_src, m_dst, m_srcDetails, m_dstDetails, sysMem, localMem, size);
+    }
+
+    static MCPY_ENGINE_CAPS Caps(bool vebox, bool blt, bool render, bool cpu)
+    {
+        MCPY_ENGINE_CAPS caps = {};
+        caps.engineVebox      = vebox;
+        caps.engineBlt        = blt;
+        caps.engineRender     = render;
+        caps.engineCpu        = cpu;
+        return caps;
+    }
+
+    const MCPY_METHOD m_methods[4] = {
+        MCPY_METHOD_DEFAULT, MCPY_METHOD_POWERSAVING, MCPY_METHOD_PERFORMANCE, MCPY_METHOD_BALANCE};
+
+    MOS_INTERFACE     m_osInterface = {};
+    MCPY_STATE_PARAMS m_src         = {};
+    MCPY_STATE_PARAMS m_dst         = {};
+    MOS_SURFACE       m_srcDetails  = {};
+    MOS_SURFACE       m_dstDetails  = {};
+};
+
+TEST_F(MediaCpuCopyTest, SupportedForSmallLinearCopies)
+{
+    EXPECT_TRUE(IsSupported(false, 4096));
+    EXPECT_FALSE(IsSupported(false, MCPY_CPU_COPY_THRESHOLD));
+}
+
+TEST_F(MediaCpuCopyTest, SystemMemoryCopiesAreCapped)
+{
+    EXPECT_TRUE(IsSupported(true, MCPY_CPU_COPY_THRESHOLD));
+    EXPECT_FALSE(IsSupported(true, MCPY_CPU_COPY_SYSMEM_THRESHOLD));
+}
+
+TEST_F(MediaCpuCopyTest, NotSupportedForLocalMemory)
+{
+    EXPECT_FALSE(IsSupported(false, 4096, true));
+    EXPECT_FALSE(IsSupported(true, 4096, true));
+}
+
+TEST_F(MediaCpuCopyTest, PreferredOnlyForDefaultMethod)
+{
+    for (MCPY_METHOD method : m_methods)
+    {
+        EXPECT_EQ(CpuCopyState::IsPreferred(method, Caps(true, true, true, true)), method == MCPY_METHOD_DEFAULT)
+            << "method " << method;
+        EXPECT_EQ(CpuCopyState::IsPreferred(method, Caps(false, true, false, true)), method == MCPY_METHOD_DEFAULT)
+            << "method " << method;
+    }
+}
+
+TEST_F(MediaCpuCopyTest, PreferredForAnyMethodWithoutHwEngine)
+{
+    for (MCPY_METHOD method : m_methods)
+    {
+        EXPECT_TRUE(CpuCopyState::IsPreferred(method, Caps(false, false, false, true))) << "method " << method;
+    }
+}
+
+TEST_F(MediaCpuCopyTest, NotPreferredWhenNotSupported)
+{
+    for (MCPY_METHOD method : m_methods)
+    {
+        EXPECT_FALSE(CpuCopyState::IsPreferred(method, Caps(true, true, true, false))) << "method " << method;
+        EXPECT_FALSE(CpuCopyState::IsPreferred(method, Caps(false, false, false, false))) << "method " << method;
+    }
+}
+
+TEST_F(MediaCpuCopyTest, NotSupportedForTiledCompressedOrProtected)
+{
+    m_dst.TileMode = MOS_TILE_Y;
+    EXPECT_FALSE(IsSupported(false, 4096));
+    m_dst.TileMode = MOS_TILE_LINEAR;
+
+    m_src.CompressionMode = MOS_MMC_MC;
+    EXPECT_FALSE(IsSupported(false, 4096));
+    m_src.CompressionMode = MOS_MMC_DISABLED;
+
+    m_dst.CpMode = MCPY_CPMODE_CP;
+    EXPECT_FALSE(IsSupported(false, 4096));
+    m_dst.CpMode = MCPY_CPMODE_CLEAR;
+
+    m_src.bAuxSuface = true;
+    EXPECT_FALSE(IsSupported(false, 4096));
+}
+
+TEST_F(MediaCpuCopyTest, NotSupportedForDifferentLayouts)
+{
+    m_dstDetails.dwPitch = 128;
+    EXPECT_FALSE(IsSupported(false, 4096));
+
+    m_dstDetails        = m_srcDetails;
+    m_dstDetails.Format = Format_P010;
+    EXPECT_FALSE(IsSupported(false, 4096));
+}
+
+TEST_F(MediaCpuCopyTest, WaitsForGpuBeforeCopy)
+{
+    TestCpuCopyState cpuCopy(&m_osInterface);
+
+    ASSERT_EQ(cpuCopy.Copy(&g_src, &g_dst, g_srcData.size(), g_dstData.size()), MOS_STATUS_SUCCESS);
+    EXPECT_EQ(g_srcData, g_dstData);
+
+    std::vector<std::string> expected = {
+        "wait src", "wait dst", "lock src read", "lock dst write", "unlock src", "unlock dst"};
+    EXPECT_EQ(g_calls, expected);
+}
+
+TEST_F(MediaCpuCopyTest, CopiesSmallerOfBothSizes)
+{
+    TestCpuCopyState cpuCopy(&m_osInterface);
+
+    ASSERT_EQ(cpuCopy.Copy(&g_src, &g_dst, 1024, g_dstData.size()), MOS_STATUS_SUCCESS);
+    EXPECT_TRUE(std::equal(g_srcData.begin(), g_srcData.begin() + 1024, g_dstData.begin()));
+    EXPECT_EQ(g_dstData[1024], 0);
+}
+
+TEST_F(MediaCpuCopyTest, FailedWaitSkipsCopy)
+{
+    TestCpuCopyState cpuCopy(&m_osInterface);
+    cpuCopy.m_waitStatus = MOS_STATUS_UNKNOWN;
+
+    EXPECT_NE(cpuCopy.Copy(&g_src, &g_dst, g_srcData.size(), g_dstData.size()), MOS_STATUS_SUCCESS);
+    std::vector<std::string> expected = {"wait src"};
+    EXPECT_EQ(g_calls, expected);
+}
+
+TEST_F(MediaCpuCopyTest, FailedDestinationLockUnlocksSource)
+{
+    TestCpuCopyState cpuCopy(&m_osInterface);
+    g_failDstLock = true;
+
+    EXPECT_EQ(cpuCopy.Copy(&g_src, &g_dst, g_srcData.size(), g_dstData.size()), MOS_STATUS_NULL_POINTER);
+    std::vector<std::string> expected = {
+        "wait src", "wait dst", "lock src read", "lock dst write", "unlock src"};
+    EXPECT_EQ(g_calls, expected);
+}
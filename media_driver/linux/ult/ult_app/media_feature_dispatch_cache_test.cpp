@@ -0,0 +1,181 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <map>
+#include <vector>
+#include "gtest/gtest.h"
+#include "media_feature_dispatch_cache.h"
+
+//!
+//! \brief  Checks that the lists resolved by MediaFeatureDispatchCache match
+//!         the per-call dynamic_cast dispatch __SETPAR used to do.
+//!
+class MediaFeatureDispatchCacheTest : public testing::Test
+{
+protected:
+    struct Feature
+    {
+        explicit Feature(int id) : m_id(id) {}
+        virtual ~Feature() {}
+        int m_id;
+    };
+
+    // Stand-ins for MHW ParSetting interfaces
+    struct SettingA
+    {
+        virtual ~SettingA() {}
+        virtual void SetA(std::vector<int> &calls) const = 0;
+    };
+
+    struct SettingB
+    {
+        virtual ~SettingB() {}
+        virtual void SetB(std::vector<int> &calls) const = 0;
+    };
+
+    struct SettingC
+    {
+        virtual ~SettingC() {}
+    };
+
+    struct FeatureA : Feature, SettingA
+    {
+        explicit FeatureA(int id) : Feature(id) {}
+        void SetA(std::vector<int> &calls) const override { calls.push_back(m_id); }
+    };
+
+    struct FeatureB : Feature, SettingB
+    {
+        explicit FeatureB(int id) : Feature(id) {}
+        void SetB(std::vector<int> &calls) const override { calls.push_back(m_id); }
+    };
+
+    // SettingB is the second base here, so its pointer differs from the feature pointer
+    struct FeatureAB : Feature, SettingA, SettingB
+    {
+        explicit FeatureAB(int id) : Feature(id) {}
+        void SetA(std::vector<int> &calls) const override { calls.push_back(m_id); }
+        void SetB(std::vector<int> &calls) const override { calls.push_back(-m_id); }
+    };
+
+    using Container = std::map<int, Feature *>;
+
+    template <typename T>
+    static std::vector<const T *> PerCall(Container &features)
+    {
+        std::vector<const T *> list;
+        for (auto &e : features)
+        {
+            auto p = dynamic_cast<const T *>(e.second);
+            if (p)
+            {
+                list.push_back(p);
+            }
+        }
+        return list;
+    }
+
+    template <typename T>
+    std::vector<const T *> Resolved(Container &features)
+    {
+        std::vector<const T *> list;
+        for (auto feature : m_cache.Get<T>(features))
+        {
+            list.push_back(static_cast<const T *>(feature));
+        }
+        return list;
+    }
+
+    void SetUp() override
+    {
+        m_features[3] = &m_featureAB;
+        m_features[1] = &m_featureA;
+        m_features[7] = &m_plain;
+        m_features[2] = &m_featureB;
+    }
+
+    FeatureA                  m_featureA{1};
+    FeatureB                  m_featureB{2};
+    FeatureAB                 m_featureAB{3};
+    Feature                   m_plain{7};
+    Container                 m_features;
+    MediaFeatureDispatchCache m_cache;
+};
+
+TEST_F(MediaFeatureDispatchCacheTest, ResolvedMatchesPerCall)
+{
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(Resolved<SettingA>(m_features), PerCall<SettingA>(m_features));
+        EXPECT_EQ(Resolved<SettingB>(m_features), PerCall<SettingB>(m_features));
+        EXPECT_EQ(Resolved<SettingC>(m_features), PerCall<SettingC>(m_features));
+    }
+    EXPECT_EQ(Resolved<SettingA>(m_features).size(), 2u);
+    EXPECT_EQ(Resolved<SettingB>(m_features).size(), 2u);
+    EXPECT_TRUE(Resolved<SettingC>(m_features).empty());
+}
+
+TEST_F(MediaFeatureDispatchCacheTest, SettersCalledInFeatureIdOrder)
+{
+    std::vector<int> perCall, resolved;
+
+    for (auto p : PerCall<SettingB>(m_features))
+    {
+        p->SetB(perCall);
+    }
+    for (auto feature : m_cache.Get<SettingB>(m_features))
+    {
+        static_cast<const SettingB *>(feature)->SetB(resolved);
+    }
+
+    EXPECT_EQ(resolved, perCall);
+    EXPECT_EQ(resolved, (std::vector<int>{2, -3}));
+}
+
+TEST_F(MediaFeatureDispatchCacheTest, ClearPicksUpFeatureChanges)
+{
+    FeatureA added(5);
+
+    EXPECT_EQ(Resolved<SettingA>(m_features), PerCall<SettingA>(m_features));
+
+    m_features[5] = &added;
+    m_features.erase(1);
+    m_cache.Clear();
+    EXPECT_EQ(Resolved<SettingA>(m_features), PerCall<SettingA>(m_features));
+    EXPECT_EQ(Resolved<SettingB>(m_features), PerCall<SettingB>(m_features));
+
+    m_features.clear();
+    m_cache.Clear();
+    EXPECT_TRUE(Resolved<SettingA>(m_features).empty());
+}
+
+TEST_F(MediaFeatureDispatchCacheTest, CachesAreIndependent)
+{
+    // A packet's ManagerLite holds a subset of the pipeline's features
+    Container                 subset = {{2, &m_featureB}};
+    MediaFeatureDispatchCache subsetCache;
+
+    EXPECT_EQ(Resolved<SettingB>(m_features), PerCall<SettingB>(m_features));
+    EXPECT_EQ(subsetCache.Get<SettingB>(subset).size(), 1u);
+    EXPECT_TRUE(subsetCache.Get<SettingA>(subset).empty());
+    EXPECT_EQ(Resolved<SettingB>(m_features), PerCall<SettingB>(m_features));
+}
@@ -0,0 +1,90 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "media_image_scratch.h"
+
+TEST(MediaImageScratchTest, SmallerRequestReusesLargerBuffer)
+{
+    MediaImageScratch scratch;
+    uint32_t          capacity = 0;
+
+    uint8_t *large = scratch.Acquire(4096, capacity);
+    ASSERT_NE(large, nullptr);
+    EXPECT_EQ(capacity, 4096u);
+    scratch.Release(large, capacity);
+
+    // The cached buffer is handed out with its real capacity, not the requested size
+    uint8_t *small = scratch.Acquire(1024, capacity);
+    EXPECT_EQ(small, large);
+    EXPECT_EQ(capacity, 4096u);
+    EXPECT_EQ(scratch.GetCachedCapacity(), 0u);
+    scratch.Release(small, capacity);
+
+    // so a later request up to that capacity still reuses it
+    EXPECT_EQ(scratch.GetCachedCapacity(), 4096u);
+    uint8_t *again = scratch.Acquire(4096, capacity);
+    EXPECT_EQ(again, large);
+    EXPECT_EQ(capacity, 4096u);
+    scratch.Release(again, capacity);
+}
+
+TEST(MediaImageScratchTest, LargerRequestReplacesBuffer)
+{
+    MediaImageScratch scratch;
+    uint32_t          capacity = 0;
+
+    uint8_t *small = scratch.Acquire(1024, capacity);
+    ASSERT_NE(small, nullptr);
+    scratch.Release(small, capacity);
+
+    uint8_t *large = scratch.Acquire(8192, capacity);
+    ASSERT_NE(large, nullptr);
+    EXPECT_EQ(capacity, 8192u);
+    scratch.Release(large, capacity);
+    EXPECT_EQ(scratch.GetCachedCapacity(), 8192u);
+}
+
+TEST(MediaImageScratchTest, ConcurrentCallerGetsOwnBuffer)
+{
+    MediaImageScratch scratch;
+    uint32_t          firstCapacity = 0, secondCapacity = 0;
+
+    uint8_t *first  = scratch.Acquire(4096, firstCapacity);
+    uint8_t *second = scratch.Acquire(1024, secondCapacity);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(secondCapacity, 1024u);
+
+    // Only the larger buffer is kept, whatever the release order
+    scratch.Release(second, secondCapacity);
+    scratch.Release(first, firstCapacity);
+    EXPECT_EQ(scratch.GetCachedCapacity(), 4096u);
+
+    uint8_t *reused = scratch.Acquire(2048, firstCapacity);
+    EXPECT_EQ(reused, first);
+    scratch.Release(reused, firstCapacity);
+
+    scratch.Free();
+    EXPECT_EQ(scratch.GetCachedCapacity(), 0u);
+}
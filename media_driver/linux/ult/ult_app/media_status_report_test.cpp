@@ -0,0 +1,227 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include "gtest/gtest.h"
+#include "media_status_report.h"
+
+struct FakeReport
+{
+    uint32_t counter;
+    bool     parsed;
+    bool     outOfRange;
+};
+
+//!
+//! \brief  Status report whose completed count is advanced by the test instead of the GPU.
+//!
+class FakeStatusReport : public MediaStatusReport
+{
+public:
+    FakeStatusReport(uint32_t statusNum) : MediaStatusReport(statusNum)
+    {
+        m_completedCount = &m_completed;
+        m_sizeOfReport   = sizeof(FakeReport);
+        m_counters.resize(m_statusNum);
+    }
+
+    MOS_STATUS Create() override { return MOS_STATUS_SUCCESS; }
+
+    MOS_STATUS Init(void *inputPar) override
+    {
+        m_counters[CounterToIndex(m_submittedCount)] = m_submittedCount;
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MOS_STATUS Reset() override
+    {
+        m_submittedCount++;
+        return MOS_STATUS_SUCCESS;
+    }
+
+    void Submit(uint32_t num)
+    {
+        for (uint32_t i = 0; i < num; i++)
+        {
+            Init(nullptr);
+            Reset();
+        }
+    }
+
+    void Complete(uint32_t num) { m_completed += num; }
+
+    uint32_t m_parseCount = 0;
+
+protected:
+    MOS_STATUS ParseStatus(void *report, uint32_t index) override
+    {
+        FakeReport *fakeReport = (FakeReport *)report;
+        fakeReport->counter    = m_counters[index];
+        fakeReport->parsed     = true;
+        fakeReport->outOfRange = false;
+        m_parseCount++;
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MOS_STATUS SetStatus(void *report, uint32_t index, bool outOfRange) override
+    {
+        FakeReport *fakeReport = (FakeReport *)report;
+        fakeReport->parsed     = false;
+        fakeReport->outOfRange = outOfRange;
+        return MOS_STATUS_SUCCESS;
+    }
+
+    uint32_t              m_completed = 0;
+    std::vector<uint32_t> m_counters;
+};
+
+TEST(MediaStatusReportTest, RingSizeRoundsUpToPowerOfTwo)
+{
+    uint32_t defaultStatusNum = MediaStatusReport::m_defaultStatusNum;
+    EXPECT_EQ(FakeStatusReport(defaultStatusNum).GetStatusNum(), defaultStatusNum);
+    EXPECT_EQ(FakeStatusReport(100).GetStatusNum(), 128u);
+    EXPECT_EQ(FakeStatusReport(2048).GetStatusNum(), 2048u);
+}
+
+TEST(MediaStatusReportTest, RequestedRingSizeIsClamped)
+{
+    uint32_t defaultStatusNum = MediaStatusReport::m_defaultStatusNum;
+    uint32_t maxStatusNum     = MediaStatusReport::m_maxStatusNum;
+
+    // A ring smaller than the frames in flight would reuse slots still in use
+    EXPECT_EQ(MediaStatusReport::ClampStatusNum(0), defaultStatusNum);
+    EXPECT_EQ(MediaStatusReport::ClampStatusNum(defaultStatusNum - 1), defaultStatusNum);
+    EXPECT_EQ(MediaStatusReport::ClampStatusNum(defaultStatusNum + 1), 2 * defaultStatusNum);
+    EXPECT_EQ(MediaStatusReport::ClampStatusNum(maxStatusNum), maxStatusNum);
+    EXPECT_EQ(MediaStatusReport::ClampStatusNum(0xffffffff), maxStatusNum);
+}
+
+TEST(MediaStatusReportTest, BatchParsesEachCompletedEntryOnce)
+{
+    FakeStatusReport statusReport(16);
+    FakeReport       reports[8] = {};
+
+    statusReport.Submit(10);
+    statusReport.Complete(6);
+
+    // Multiple reports are returned newest first
+    ASSERT_EQ(statusReport.GetReport(8, reports), MOS_STATUS_SUCCESS);
+    for (uint32_t i = 0; i < 6; i++)
+    {
+        EXPECT_TRUE(reports[i].parsed);
+        EXPECT_EQ(reports[i].counter, 5 - i);
+    }
+    for (uint32_t i = 6; i < 8; i++)
+    {
+        EXPECT_FALSE(reports[i].parsed);
+        EXPECT_FALSE(reports[i].outOfRange);
+    }
+    EXPECT_EQ(statusReport.GetReportedCount(), 6u);
+    EXPECT_EQ(statusReport.m_parseCount, 6u);
+
+    // Nothing new completed, nothing is parsed again
+    ASSERT_EQ(statusReport.GetReport(8, reports), MOS_STATUS_SUCCESS);
+    EXPECT_EQ(statusReport.m_parseCount, 6u);
+    EXPECT_FALSE(reports[0].parsed);
+
+    statusReport.Complete(4);
+    ASSERT_EQ(statusReport.GetReport(8, reports), MOS_STATUS_SUCCESS);
+    EXPECT_EQ(statusReport.m_parseCount, 10u);
+    EXPECT_EQ(reports[0].counter, 9u);
+    EXPECT_EQ(reports[3].counter, 6u);
+    EXPECT_TRUE(reports[4].outOfRange);
+}
+
+TEST(MediaStatusReportTest, RepeatedQueryDoesNotReparse)
+{
+    FakeStatusReport statusReport(16);
+    FakeReport       report = {};
+
+    statusReport.Submit(2);
+    statusReport.Complete(1);
+
+    ASSERT_EQ(statusReport.GetReport(1, &report), MOS_STATUS_SUCCESS);
+    EXPECT_TRUE(report.parsed);
+    EXPECT_EQ(report.counter, 0u);
+
+    // Querying again while the next frame is still running costs no parse,
+    // the DDI keeps the result it got for the first frame on its surface
+    for (uint32_t i = 0; i < 8; i++)
+    {
+        ASSERT_EQ(statusReport.GetReport(1, &report), MOS_STATUS_SUCCESS);
+        EXPECT_FALSE(report.parsed);
+        EXPECT_FALSE(report.outOfRange);
+    }
+    EXPECT_EQ(statusReport.m_parseCount, 1u);
+    EXPECT_EQ(statusReport.GetReportedCount(), 1u);
+
+    statusReport.Complete(1);
+    ASSERT_EQ(statusReport.GetReport(1, &report), MOS_STATUS_SUCCESS);
+    EXPECT_TRUE(report.parsed);
+    EXPECT_EQ(report.counter, 1u);
+    EXPECT_EQ(statusReport.m_parseCount, 2u);
+}
+
+TEST(MediaStatusReportTest, CounterWrapsAroundRing)
+{
+    FakeStatusReport statusReport(16);
+    FakeReport       report   = {};
+    uint32_t         expected = 0;
+
+    for (uint32_t frame = 0; frame < 100; frame++)
+    {
+        statusReport.Submit(3);
+        statusReport.Complete(3);
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            ASSERT_EQ(statusReport.GetReport(1, &report), MOS_STATUS_SUCCESS);
+            ASSERT_TRUE(report.parsed);
+            EXPECT_EQ(report.counter, expected);
+            EXPECT_EQ(statusReport.GetIndex(report.counter), expected % statusReport.GetStatusNum());
+            expected++;
+        }
+    }
+    EXPECT_EQ(statusReport.GetReportedCount(), 300u);
+}
+
+TEST(MediaStatusReportTest, OverwrittenEntriesAreSkipped)
+{
+    FakeStatusReport statusReport(8);
+    FakeReport       report = {};
+
+    // The application fell more than one ring behind, the oldest slots now hold newer frames
+    statusReport.Submit(20);
+    statusReport.Complete(20);
+
+    ASSERT_EQ(statusReport.GetReport(1, &report), MOS_STATUS_SUCCESS);
+    ASSERT_TRUE(report.parsed);
+    EXPECT_EQ(report.counter, 13u);
+
+    uint32_t parsed = 1;
+    while (statusReport.GetReportedCount() != 20)
+    {
+        ASSERT_EQ(statusReport.GetReport(1, &report), MOS_STATUS_SUCCESS);
+        EXPECT_EQ(report.counter, 13 + parsed);
+        parsed++;
+    }
+    EXPECT_EQ(parsed, 7u);
+}
@@ -0,0 +1,148 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include "gtest/gtest.h"
+#include "mhw_utilities_next.h"
+#include "mhw_state_heap.h"
+
+//!
+//! \brief  Checks that tables served from the polyphase cache are bit-exact
+//!         with tables generated from scratch, for the Y, UV and UV offset
+//!         calculations SFC and AVS state programming use.
+//!
+class MhwPolyphaseCacheTest : public testing::Test
+{
+protected:
+    struct TableParams
+    {
+        uint32_t   type;        // 0: Y, 1: UV, 2: UV offset
+        float      scaleFactor;
+        uint32_t   plane;
+        MOS_FORMAT format;
+        float      hpStrength;
+        bool       use8x8Filter;
+        uint32_t   hwPhase;
+        float      lanczosT;
+        int32_t    uvPhaseOffset;
+    };
+
+    void SetUp() override
+    {
+        Mhw_ClearPolyphaseCache();
+    }
+
+    void TearDown() override
+    {
+        Mhw_ClearPolyphaseCache();
+    }
+
+    static std::vector<int32_t> Calc(const TableParams &params)
+    {
+        std::vector<int32_t> coefs(NUM_HW_POLYPHASE_TABLES * NUM_POLYPHASE_Y_ENTRIES, 0);
+        MOS_STATUS           status = MOS_STATUS_UNKNOWN;
+
+        switch (params.type)
+        {
+        case 0:
+            status = Mhw_CalcPolyphaseTablesY(coefs.data(), params.scaleFactor, params.plane, params.format,
+                params.hpStrength, params.use8x8Filter, params.hwPhase, params.lanczosT);
+            break;
+        case 1:
+            status = Mhw_CalcPolyphaseTablesUV(coefs.data(), params.lanczosT, params.scaleFactor);
+            break;
+        default:
+            status = Mhw_CalcPolyphaseTablesUVOffset(coefs.data(), params.lanczosT, params.scaleFactor, params.uvPhaseOffset);
+            break;
+        }
+        EXPECT_EQ(status, MOS_STATUS_SUCCESS);
+        return coefs;
+    }
+
+    static std::vector<TableParams> AllParams()
+    {
+        // Includes scale factors one float ulp apart, which must not share a table
+        const float scaleFactors[] = {0.25F, 1.0F / 3.0F, 0.5F, 0.75F, 1.0F, 1.0F + 1.0F / (1 << 23), 1.5F, 2.0F};
+
+        std::vector<TableParams> all;
+        for (float sf : scaleFactors)
+        {
+            for (uint32_t plane : {(uint32_t)MHW_Y_PLANE, (uint32_t)MHW_U_PLANE})
+            {
+                for (MOS_FORMAT format : {Format_NV12, Format_A8R8G8B8})
+                {
+                    for (bool use8x8Filter : {true, false})
+                    {
+                        for (uint32_t hwPhase : {(uint32_t)MHW_NUM_HW_POLYPHASE_TABLES, (uint32_t)NUM_HW_POLYPHASE_TABLES})
+                        {
+                            all.push_back({0, sf, plane, format, 0.0F, use8x8Filter, hwPhase, 0.0F, 0});
+                            all.push_back({0, sf, plane, format, 0.5F, use8x8Filter, hwPhase, 0.0F, 0});
+                        }
+                    }
+                }
+            }
+            for (float lanczosT : {2.0F, 3.0F, 4.0F})
+            {
+                all.push_back({1, sf, 0, Format_Any, 0.0F, false, 0, lanczosT, 0});
+                for (int32_t uvPhaseOffset : {0, 8, 16, -8})
+                {
+                    all.push_back({2, sf, 0, Format_Any, 0.0F, false, 0, lanczosT, uvPhaseOffset});
+                }
+            }
+        }
+        return all;
+    }
+};
+
+TEST_F(MhwPolyphaseCacheTest, CachedTableMatchesGenerated)
+{
+    for (const TableParams &params : AllParams())
+    {
+        Mhw_ClearPolyphaseCache();
+        std::vector<int32_t> generated = Calc(params);
+        std::vector<int32_t> cached    = Calc(params);
+        EXPECT_EQ(cached, generated) << "type " << params.type << " scale " << params.scaleFactor;
+    }
+}
+
+TEST_F(MhwPolyphaseCacheTest, InterleavedTablesMatchGenerated)
+{
+    std::vector<TableParams>          all = AllParams();
+    std::vector<std::vector<int32_t>> generated;
+
+    for (const TableParams &params : all)
+    {
+        Mhw_ClearPolyphaseCache();
+        generated.push_back(Calc(params));
+    }
+
+    // Far more tables than cache entries, so entries are both hit and evicted
+    Mhw_ClearPolyphaseCache();
+    for (uint32_t pass = 0; pass < 2; pass++)
+    {
+        for (size_t i = 0; i < all.size(); i++)
+        {
+            EXPECT_EQ(Calc(all[i]), generated[i]) << "table " << i << " pass " << pass;
+            EXPECT_EQ(Calc(all[i]), generated[i]) << "table " << i << " pass " << pass;
+        }
+    }
+}
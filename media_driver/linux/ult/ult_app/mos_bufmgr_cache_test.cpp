@@ -0,0 +1,194 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <stdlib.h>
+#include "gtest/gtest.h"
+#include "mos_bufmgr.h"
+
+//!
+//! \brief  Drives the GEM BO reuse cache of the libdrm mock bufmgr.
+//!
+class MosBufmgrCacheTest : public testing::Test
+{
+protected:
+    enum
+    {
+        m_boSize = 256 * 1024,  // exactly one bucket size, so cached BOs are not rounded up
+    };
+
+    void Init(const char *cacheMaxSizeMB)
+    {
+        if (cacheMaxSizeMB)
+        {
+            setenv("MEDIA_BO_CACHE_MAX_SIZE", cacheMaxSizeMB, 1);
+        }
+        // fd 1 selects the first device of the libdrm mock
+        m_bufmgr = mos_bufmgr_gem_init(1, 4096);
+        unsetenv("MEDIA_BO_CACHE_MAX_SIZE");
+        ASSERT_NE(m_bufmgr, nullptr);
+        mos_bufmgr_gem_enable_reuse(m_bufmgr);
+    }
+
+    void TearDown() override
+    {
+        if (m_bufmgr)
+        {
+            mos_bufmgr_destroy(m_bufmgr);
+        }
+    }
+
+    mos_linux_bo *Alloc(unsigned long size = m_boSize)
+    {
+        return mos_bo_alloc(m_bufmgr, "cache test", size, 0, MOS_MEMPOOL_SYSTEMMEMORY);
+    }
+
+    void GetStats()
+    {
+        mos_bufmgr_gem_get_bo_cache_stats(m_bufmgr, &m_hits, &m_misses, &m_evictions, &m_cachedBytes);
+    }
+
+    mos_bufmgr *m_bufmgr      = nullptr;
+    uint64_t    m_hits        = 0;
+    uint64_t    m_misses      = 0;
+    uint64_t    m_evictions   = 0;
+    uint64_t    m_cachedBytes = 0;
+};
+
+TEST_F(MosBufmgrCacheTest, FreedBoIsReused)
+{
+    Init(nullptr);
+
+    mos_linux_bo *first = Alloc();
+    ASSERT_NE(first, nullptr);
+    mos_bo_unreference(first);
+
+    GetStats();
+    EXPECT_EQ(m_misses, 1u);
+    EXPECT_EQ(m_cachedBytes, (uint64_t)m_boSize);
+
+    mos_linux_bo *second = Alloc();
+    EXPECT_EQ(second, first);
+
+    // a different bucket does not take it
+    mos_linux_bo *other = Alloc(2 * m_boSize);
+    ASSERT_NE(other, nullptr);
+    EXPECT_NE(other, first);
+
+    GetStats();
+    EXPECT_EQ(m_hits, 1u);
+    EXPECT_EQ(m_misses, 2u);
+    EXPECT_EQ(m_cachedBytes, 0u);
+
+    mos_bo_unreference(second);
+    mos_bo_unreference(other);
+}
+
+TEST_F(MosBufmgrCacheTest, DefaultBudgetIsBounded)
+{
+    Init(nullptr);
+
+    // 64MB is the largest cached size, nine of them go over the 512MB default
+    const unsigned long size  = 64 * 1024 * 1024;
+    const int           count = 9;
+    mos_linux_bo       *bos[count];
+
+    for (int i = 0; i < count; i++)
+    {
+        bos[i] = Alloc(size);
+        ASSERT_NE(bos[i], nullptr);
+    }
+    for (int i = 0; i < count; i++)
+    {
+        mos_bo_unreference(bos[i]);
+    }
+
+    GetStats();
+    EXPECT_EQ(m_evictions, 1u);
+    EXPECT_EQ(m_cachedBytes, (uint64_t)size * (count - 1));
+}
+
+TEST_F(MosBufmgrCacheTest, OldestBoIsEvictedOverBudget)
+{
+    Init("1");
+
+    const int     count = 5;
+    mos_linux_bo *bos[count];
+
+    for (int i = 0; i < count; i++)
+    {
+        bos[i] = Alloc();
+        ASSERT_NE(bos[i], nullptr);
+    }
+
+    // four BOs fill the 1MB budget exactly
+    for (int i = 0; i < count - 1; i++)
+    {
+        mos_bo_unreference(bos[i]);
+    }
+    GetStats();
+    EXPECT_EQ(m_evictions, 0u);
+    EXPECT_EQ(m_cachedBytes, 4u * m_boSize);
+
+    // the fifth pushes out the first one freed
+    mos_bo_unreference(bos[count - 1]);
+    GetStats();
+    EXPECT_EQ(m_evictions, 1u);
+    EXPECT_EQ(m_cachedBytes, 4u * m_boSize);
+
+    // the remaining BOs are handed out again, most recently freed first
+    for (int i = count - 1; i > 0; i--)
+    {
+        bos[i] = mos_bo_alloc_for_render(m_bufmgr, "cache test", m_boSize, 0, MOS_MEMPOOL_SYSTEMMEMORY);
+        EXPECT_NE(bos[i], nullptr);
+    }
+    GetStats();
+    EXPECT_EQ(m_hits, 4u);
+    EXPECT_EQ(m_cachedBytes, 0u);
+
+    for (int i = 1; i < count; i++)
+    {
+        mos_bo_unreference(bos[i]);
+    }
+}
+
+TEST_F(MosBufmgrCacheTest, ZeroBudgetIsUnbounded)
+{
+    Init("0");
+
+    const int     count = 8;
+    mos_linux_bo *bos[count];
+
+    for (int i = 0; i < count; i++)
+    {
+        bos[i] = Alloc();
+        ASSERT_NE(bos[i], nullptr);
+    }
+    for (int i = 0; i < count; i++)
+    {
+        mos_bo_unreference(bos[i]);
+    }
+
+    GetStats();
+    EXPECT_EQ(m_evictions, 0u);
+    EXPECT_EQ(m_cachedBytes, (uint64_t)count * m_boSize);
+}
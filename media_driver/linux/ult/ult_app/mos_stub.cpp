@@ -19,10 +19,38 @@
 * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 * OTHER DEALINGS IN THE SOFTWARE.
 */
+#include <cmath>
+#include <cstdlib>
 #include <cstring>
 #include "mos_utilities.h"
+#include "mos_interface.h"
+#include "media_user_setting.h"
 using namespace std;
 
+int32_t MosUtilities::m_mosMemAllocCounter = 0;
+
+int32_t MosUtilities::MosAtomicIncrement(int32_t *pValue)
+{
+    return __sync_add_and_fetch(pValue, 1);
+}
+
+int32_t MosUtilities::MosAtomicDecrement(int32_t *pValue)
+{
+    return __sync_sub_and_fetch(pValue, 1);
+}
+
+#if (_DEBUG || _RELEASE_INTERNAL)
+bool MosUtilities::MosSimulateAllocMemoryFail(
+    size_t      size,
+    size_t      alignment,
+    const char *functionName,
+    const char *filename,
+    int32_t     line)
+{
+    return false;
+}
+#endif // (_DEBUG || _RELEASE_INTERNAL)
+
 void MosUtilities::MosZeroMemory(void *pDestination, size_t stLength)
 {
     if(pDestination != nullptr)
@@ -31,3 +59,177 @@ void MosUtilities::MosZeroMemory(void *pDestination, size_t stLength)
     }
 }
 
+// Allocation wrappers for the driver sources built into devult, which does not link MOS
+#if MOS_MESSAGES_ENABLED
+void *MosUtilities::MosAllocMemoryUtils(
+    size_t     size,
+    const char *functionName,
+    const char *filename,
+    int32_t    line)
+{
+    return malloc(size);
+}
+
+void *MosUtilities::MosAllocAndZeroMemoryUtils(
+    size_t     size,
+    const char *functionName,
+    const char *filename,
+    int32_t    line)
+{
+    return calloc(1, size);
+}
+
+void MosUtilities::MosFreeMemoryUtils(
+    void       *ptr,
+    const char *functionName,
+    const char *filename,
+    int32_t    line)
+{
+    free(ptr);
+}
+#else // !MOS_MESSAGES_ENABLED
+void *MosUtilities::MosAllocMemory(size_t size)
+{
+    return malloc(size);
+}
+
+void *MosUtilities::MosAllocAndZeroMemory(size_t size)
+{
+    return calloc(1, size);
+}
+
+void MosUtilities::MosFreeMemory(void *ptr)
+{
+    free(ptr);
+}
+#endif // MOS_MESSAGES_ENABLED
+
+MOS_STATUS MosUtilities::MosSecureMemcpy(
+    void       *pDestination,
+    size_t     dstLength,
+    const void *pSource,
+    size_t     srcLength)
+{
+    if (pDestination == nullptr || pSource == nullptr)
+    {
+        return MOS_STATUS_NULL_POINTER;
+    }
+    if (dstLength < srcLength)
+    {
+        return MOS_STATUS_INVALID_PARAMETER;
+    }
+    memcpy(pDestination, pSource, srcLength);
+    return MOS_STATUS_SUCCESS;
+}
+
+// Same filter math as mos_utilities_next.cpp, for the MHW polyphase tables built into devult
+float MosUtilities::MosSinc(float x)
+{
+    return (MOS_ABS(x) < 1e-9f) ? 1.0F : (float)(sin(x) / x);
+}
+
+float MosUtilities::MosLanczos(float x, uint32_t dwNumEntries, float fLanczosT)
+{
+    uint32_t dwNumHalfEntries = dwNumEntries >> 1;
+    if (fLanczosT < dwNumHalfEntries)
+    {
+        fLanczosT = (float)dwNumHalfEntries;
+    }
+
+    if (MOS_ABS(x) >= dwNumHalfEntries)
+    {
+        return 0.0;
+    }
+
+    x *= MOS_PI;
+
+    return MosSinc(x) * MosSinc(x / fLanczosT);
+}
+
+float MosUtilities::MosLanczosG(float x, uint32_t dwNumEntries, float fLanczosT)
+{
+    uint32_t dwNumHalfEntries = (dwNumEntries >> 1) + (dwNumEntries & 1);
+    if (fLanczosT < dwNumHalfEntries)
+    {
+        fLanczosT = (float)dwNumHalfEntries;
+    }
+
+    if (x > (dwNumEntries >> 1) || (- x) >= dwNumHalfEntries)
+    {
+        return 0.0;
+    }
+
+    x *= MOS_PI;
+
+    return MosSinc(x) * MosSinc(x / fLanczosT);
+}
+
+#if MOS_ASSERT_ENABLED
+void MosUtilDebug::MosAssert(
+    MOS_COMPONENT_ID compID,
+    uint8_t          subCompID)
+{
+}
+#endif // MOS_ASSERT_ENABLED
+
+#if MOS_MESSAGES_ENABLED
+void MosUtilDebug::MosMessage(
+    MOS_MESSAGE_LEVEL level,
+    MOS_COMPONENT_ID  compID,
+    uint8_t           subCompID,
+    const PCCHAR      functionName,
+    int32_t           lineNum,
+    const PCCHAR      message,
+    ...)
+{
+}
+
+double MosUtilities::MosGetTime()
+{
+    return 0.0;
+}
+
+void MosUtilities::MosTraceEvent(
+    uint16_t         usId,
+    uint8_t          ucType,
+    const void       *pArg1,
+    uint32_t         dwSize1,
+    const void       *pArg2,
+    uint32_t         dwSize2)
+{
+}
+#endif // MOS_MESSAGES_ENABLED
+
+MOS_STATUS MosInterface::WaitForResourceIdle(
+    MOS_STREAM_HANDLE   streamState,
+    MOS_RESOURCE_HANDLE resource)
+{
+    return MOS_STATUS_SUCCESS;
+}
+
+// User settings are only read when an os interface is given, which ULTs don't
+std::shared_ptr<MediaUserSetting::MediaUserSetting> MediaUserSetting::MediaUserSetting::Instance()
+{
+    return nullptr;
+}
+
+MOS_STATUS MediaUserSetting::MediaUserSetting::Read(
+    Value             &value,
+    const std::string &valueName,
+    const Group       &group,
+    const Value       &customValue,
+    bool              useCustomValue,
+    uint32_t          option)
+{
+    return MOS_STATUS_UNIMPLEMENTED;
+}
+
+MOS_STATUS MediaUserSetting::MediaUserSetting::Write(
+    const std::string &valueName,
+    const Value       &value,
+    const Group       &group,
+    bool              isForReport,
+    uint32_t          option)
+{
+    return MOS_STATUS_UNIMPLEMENTED;
+}
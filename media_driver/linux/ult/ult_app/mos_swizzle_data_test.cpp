@@ -0,0 +1,116 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include "gtest/gtest.h"
+#include "mos_utilities.h"
+
+//!
+//! \brief  Compares MosSwizzleData against swizzling every byte through
+//!         MosSwizzleOffset, which is what MosSwizzleData did before it
+//!         copied whole tile lines.
+//!
+class MosSwizzleDataTest : public testing::Test
+{
+protected:
+    // Tiled surfaces are padded to whole tile rows
+    static size_t TiledSize(int32_t pitch, int32_t height)
+    {
+        return (size_t)pitch * MOS_ALIGN_CEIL(height, 32);
+    }
+
+    static void SwizzlePerByte(
+        const uint8_t *src,
+        uint8_t       *dst,
+        MOS_TILE_TYPE  srcTiling,
+        MOS_TILE_TYPE  dstTiling,
+        int32_t        height,
+        int32_t        pitch)
+    {
+        for (int32_t y = 0; y < height; y++)
+        {
+            for (int32_t x = 0; x < pitch; x++)
+            {
+                int32_t linearOffset = y * pitch + x;
+                if (srcTiling != MOS_TILE_LINEAR)
+                {
+                    int32_t tileOffset = MosUtilities::MosSwizzleOffset(x, y, pitch, srcTiling, false, 0);
+                    dst[linearOffset]  = src[tileOffset];
+                }
+                else
+                {
+                    int32_t tileOffset = MosUtilities::MosSwizzleOffset(x, y, pitch, dstTiling, false, 0);
+                    dst[tileOffset]    = src[linearOffset];
+                }
+            }
+        }
+    }
+
+    void Check(MOS_TILE_TYPE tiling, int32_t pitch, int32_t height)
+    {
+        size_t               size = TiledSize(pitch, height);
+        std::vector<uint8_t> src(size);
+        uint32_t             seed = 0x12345678;
+        for (auto &byte : src)
+        {
+            seed = seed * 1103515245 + 12345;
+            byte = (uint8_t)(seed >> 16);
+        }
+
+        // Bytes outside the surface keep their fill value in both outputs
+        std::vector<uint8_t> expected(size, 0xcd);
+        std::vector<uint8_t> actual(size, 0xcd);
+
+        SwizzlePerByte(src.data(), expected.data(), tiling, MOS_TILE_LINEAR, height, pitch);
+        MosUtilities::MosSwizzleData(src.data(), actual.data(), tiling, MOS_TILE_LINEAR, height, pitch, 0);
+        EXPECT_EQ(expected, actual) << "tiled to linear, tiling " << tiling << " pitch " << pitch << " height " << height;
+
+        std::fill(expected.begin(), expected.end(), 0xcd);
+        std::fill(actual.begin(), actual.end(), 0xcd);
+
+        SwizzlePerByte(src.data(), expected.data(), MOS_TILE_LINEAR, tiling, height, pitch);
+        MosUtilities::MosSwizzleData(src.data(), actual.data(), MOS_TILE_LINEAR, tiling, height, pitch, 0);
+        EXPECT_EQ(expected, actual) << "linear to tiled, tiling " << tiling << " pitch " << pitch << " height " << height;
+    }
+};
+
+TEST_F(MosSwizzleDataTest, TileYMatchesPerByteSwizzle)
+{
+    for (int32_t pitch : {128, 640, 2048})
+    {
+        for (int32_t height : {1, 32, 37, 96})
+        {
+            Check(MOS_TILE_Y, pitch, height);
+        }
+    }
+}
+
+TEST_F(MosSwizzleDataTest, TileXMatchesPerByteSwizzle)
+{
+    for (int32_t pitch : {512, 1536, 4096})
+    {
+        for (int32_t height : {1, 8, 13, 64})
+        {
+            Check(MOS_TILE_X, pitch, height);
+        }
+    }
+}
@@ -0,0 +1,133 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "vp_3dlut_cache.h"
+
+using namespace vp;
+
+//!
+//! \brief  Drives the cache the way VpResourceManager::Select3DLutTable and
+//!         Commit3DLutTable do for each HDR frame.
+//!
+class Vp3DLutCacheTest : public testing::Test
+{
+protected:
+    static VP_3DLUT_CACHE_KEY Key(uint32_t maxDisplayLum, uint32_t maxContentLevelLum = 1000, uint32_t hdrMode = 1)
+    {
+        VP_3DLUT_CACHE_KEY key = {};
+        key.maxDisplayLum      = maxDisplayLum;
+        key.maxContentLevelLum = maxContentLevelLum;
+        key.hdrMode            = hdrMode;
+        return key;
+    }
+
+    // Returns true if the 3DLut kernel can be skipped, commits the table otherwise.
+    bool Frame(const VP_3DLUT_CACHE_KEY &key, uint32_t &index, bool kernelSucceeded = true)
+    {
+        bool filled = m_cache.Select(key, index);
+        if (!filled && kernelSucceeded)
+        {
+            m_cache.SetFilled(index);
+        }
+        return filled;
+    }
+
+    Vp3DLutCache m_cache;
+};
+
+TEST_F(Vp3DLutCacheTest, SameMetadataHits)
+{
+    uint32_t first = 0, index = 0;
+
+    EXPECT_FALSE(Frame(Key(500), first));
+    for (uint32_t i = 0; i < 8; i++)
+    {
+        EXPECT_TRUE(Frame(Key(500), index));
+        EXPECT_EQ(index, first);
+    }
+}
+
+TEST_F(Vp3DLutCacheTest, EachKeyFieldMisses)
+{
+    uint32_t index = 0;
+
+    EXPECT_FALSE(Frame(Key(500, 1000, 1), index));
+    EXPECT_FALSE(Frame(Key(600, 1000, 1), index));
+    EXPECT_FALSE(Frame(Key(500, 4000, 1), index));
+    EXPECT_FALSE(Frame(Key(500, 1000, 2), index));
+
+    // all four tables are kept
+    EXPECT_TRUE(Frame(Key(500, 1000, 1), index));
+    EXPECT_TRUE(Frame(Key(600, 1000, 1), index));
+    EXPECT_TRUE(Frame(Key(500, 4000, 1), index));
+    EXPECT_TRUE(Frame(Key(500, 1000, 2), index));
+}
+
+TEST_F(Vp3DLutCacheTest, KeyHoldsOnlyKernelInputs)
+{
+    // maxDisplayLum, maxContentLevelLum and hdrMode are all the 3DLut kernel reads,
+    // anything else in the key would re-run the kernel with identical params.
+    EXPECT_EQ(sizeof(VP_3DLUT_CACHE_KEY), 3 * sizeof(uint32_t));
+}
+
+TEST_F(Vp3DLutCacheTest, LeastRecentlyUsedIsEvicted)
+{
+    uint32_t index = 0, lru = 0;
+
+    for (uint32_t i = 0; i < VP_NUM_3DLUT_CACHE_ENTRIES; i++)
+    {
+        EXPECT_FALSE(Frame(Key(100 + i), index));
+        EXPECT_EQ(index, i);
+    }
+
+    // touch all but key 101, which becomes the least recently used
+    EXPECT_TRUE(Frame(Key(100), index));
+    EXPECT_TRUE(Frame(Key(102), index));
+    EXPECT_TRUE(Frame(Key(103), index));
+    EXPECT_TRUE(Frame(Key(101), lru));
+    EXPECT_TRUE(Frame(Key(100), index));
+    EXPECT_TRUE(Frame(Key(102), index));
+    EXPECT_TRUE(Frame(Key(103), index));
+
+    EXPECT_FALSE(Frame(Key(200), index));
+    EXPECT_EQ(index, lru);
+
+    EXPECT_FALSE(Frame(Key(101), index));
+    EXPECT_TRUE(Frame(Key(200), index));
+}
+
+TEST_F(Vp3DLutCacheTest, FailedKernelIsNotReused)
+{
+    uint32_t index = 0, failed = 0;
+
+    EXPECT_FALSE(Frame(Key(500), failed, false));
+    EXPECT_FALSE(m_cache.GetEntry(failed).valid);
+
+    // the table is generated again, into the same entry
+    EXPECT_FALSE(Frame(Key(500), index));
+    EXPECT_EQ(index, failed);
+    EXPECT_TRUE(Frame(Key(500), index));
+
+    m_cache.Invalidate(index);
+    EXPECT_FALSE(Frame(Key(500), index));
+}
@@ -0,0 +1,131 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <map>
+#include <vector>
+#include "gtest/gtest.h"
+#include "vp_packet_pipe_cache.h"
+
+using namespace vp;
+
+//!
+//! \brief  Drives the cache the way VpPacketReuseManager does for 1:N workloads,
+//!         with the output width standing in for the scaling/csc/rotation params.
+//!
+class VpPacketPipeCacheTest : public testing::Test
+{
+protected:
+    VpPacketPipeCacheTest() : m_cache(16), m_pipes(64) {}
+
+    // Returns true if the packet pipe of the output is reused.
+    bool Execute(uint32_t outputWidth)
+    {
+        uint32_t index = 0;
+        auto match = [&](uint32_t slot) { return m_slotParams[slot] == outputWidth; };
+        if (m_cache.Find(match, index))
+        {
+            EXPECT_EQ(m_cache.GetPipe(index), m_outputPipes[outputWidth]);
+            m_hits++;
+            return true;
+        }
+
+        // Miss: store params to the next slot, then cache the newly created pipe there.
+        m_slotParams[m_cache.GetNextIndex()] = outputWidth;
+        PacketPipe *pipe = NewPipe();
+        m_outputPipes[outputWidth] = pipe;
+        PacketPipe *replaced = m_cache.Add(pipe);
+        if (replaced)
+        {
+            m_returned.push_back(replaced);
+        }
+        m_misses++;
+        return false;
+    }
+
+    PacketPipe *NewPipe()
+    {
+        EXPECT_LT(m_pipeCount, m_pipes.size());
+        return reinterpret_cast<PacketPipe *>(&m_pipes[m_pipeCount++]);
+    }
+
+    VpPacketPipeCache                 m_cache;
+    std::vector<uint8_t>              m_pipes;    // Storage standing in for packet pipes
+    uint32_t                          m_pipeCount = 0;
+    std::map<uint32_t, uint32_t>      m_slotParams;
+    std::map<uint32_t, PacketPipe *>  m_outputPipes;
+    std::vector<PacketPipe *>         m_returned;
+    uint32_t                          m_hits   = 0;
+    uint32_t                          m_misses = 0;
+};
+
+TEST_F(VpPacketPipeCacheTest, EachOutputReusesItsOwnPipe)
+{
+    // ABR ladder, outputs of one source alternate every frame
+    const uint32_t outputs[] = {1920, 1280, 854, 640};
+
+    for (uint32_t frame = 0; frame < 10; frame++)
+    {
+        for (uint32_t width : outputs)
+        {
+            EXPECT_EQ(Execute(width), frame != 0);
+        }
+    }
+
+    EXPECT_EQ(m_misses, 4u);
+    EXPECT_EQ(m_hits, 36u);
+    EXPECT_EQ(m_cache.GetSize(), 4u);
+    EXPECT_TRUE(m_returned.empty());
+}
+
+TEST_F(VpPacketPipeCacheTest, OldestSlotIsReplacedWhenFull)
+{
+    for (uint32_t width = 1; width <= 16; width++)
+    {
+        EXPECT_FALSE(Execute(width));
+    }
+    PacketPipe *first = m_outputPipes[1];
+
+    EXPECT_FALSE(Execute(17));
+    ASSERT_EQ(m_returned.size(), 1u);
+    EXPECT_EQ(m_returned[0], first);
+    EXPECT_FALSE(m_cache.Contains(first));
+    EXPECT_EQ(m_cache.GetSize(), 16u);
+
+    EXPECT_FALSE(Execute(1));
+    EXPECT_TRUE(Execute(17));
+    EXPECT_TRUE(Execute(3));
+}
+
+TEST_F(VpPacketPipeCacheTest, ClearReleasesEveryPipeOnce)
+{
+    Execute(1920);
+    Execute(1280);
+    Execute(1920);
+
+    std::vector<PacketPipe *> released;
+    m_cache.Clear([&](PacketPipe *pipe) { released.push_back(pipe); });
+
+    ASSERT_EQ(released.size(), 2u);
+    EXPECT_FALSE(m_cache.Contains(m_outputPipes[1920]));
+    EXPECT_EQ(m_cache.GetSize(), 0u);
+    EXPECT_EQ(m_cache.GetNextIndex(), 0u);
+}
@@ -269,11 +269,11 @@ MOS_STATUS HevcPipelineM12::AllocateResources(HevcBasicFeature &basicFeature)
 
     // In hevc short format decode, second level command buffer is programmed by Huc, so not need lock it.
     // In against hevc long format decode driver have to program second level command buffer, so it should
-    // be lockable.
+    // be lockable. Keep it lockable as well when short format pictures may be parsed on CPU.
     if (m_secondLevelBBArray == nullptr)
     {
         m_secondLevelBBArray = m_allocator->AllocateBatchBufferArray(
-            size, count, m_secondLevelBBNum, true, basicFeature.m_shortFormatInUse ? notLockableVideoMem : lockableVideoMem);
+            size, count, m_secondLevelBBNum, true, (basicFeature.m_shortFormatInUse && !basicFeature.m_cpuSliceParsingEnabled) ? notLockableVideoMem : lockableVideoMem);
         DECODE_CHK_NULL(m_secondLevelBBArray);
         PMHW_BATCH_BUFFER &batchBuf = m_secondLevelBBArray->Fetch();
         DECODE_CHK_NULL(batchBuf);
@@ -283,7 +283,7 @@ MOS_STATUS HevcPipelineM12::AllocateResources(HevcBasicFeature &basicFeature)
         PMHW_BATCH_BUFFER &batchBuf = m_secondLevelBBArray->Fetch();
         DECODE_CHK_NULL(batchBuf);
         DECODE_CHK_STATUS(m_allocator->Resize(
-            batchBuf, size, count, basicFeature.m_shortFormatInUse ? notLockableVideoMem : lockableVideoMem));
+            batchBuf, size, count, (basicFeature.m_shortFormatInUse && !basicFeature.m_cpuSliceParsingEnabled) ? notLockableVideoMem : lockableVideoMem));
     }
 
     return MOS_STATUS_SUCCESS;
@@ -321,7 +321,7 @@ namespace decode
 
     MOS_STATUS Av1PipelineXe_Lpm_Plus_Base::CreateStatusReport()
     {
-        m_statusReport = MOS_New(DecodeAv1StatusReportXe_Lpm_Plus_Base, m_allocator, true, m_osInterface);
+        m_statusReport = MOS_New(DecodeAv1StatusReportXe_Lpm_Plus_Base, m_allocator, true, m_osInterface, m_statusReportNum);
         DECODE_CHK_NULL(m_statusReport);
         DECODE_CHK_STATUS(m_statusReport->Create());
 
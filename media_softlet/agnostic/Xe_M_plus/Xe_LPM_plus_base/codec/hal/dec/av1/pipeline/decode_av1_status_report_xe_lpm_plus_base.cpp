@@ -33,8 +33,8 @@
 namespace decode {
 class DecodeAllocator;
     DecodeAv1StatusReportXe_Lpm_Plus_Base::DecodeAv1StatusReportXe_Lpm_Plus_Base(
-        DecodeAllocator* allocator, bool enableRcs, PMOS_INTERFACE osInterface):
-        DecodeStatusReport(allocator, enableRcs)
+        DecodeAllocator* allocator, bool enableRcs, PMOS_INTERFACE osInterface, uint32_t statusNum):
+        DecodeStatusReport(allocator, enableRcs, statusNum)
     {
         DECODE_FUNC_CALL()
 
@@ -41,7 +41,7 @@ struct DecodeStatusMfx;
 class DecodeAv1StatusReportXe_Lpm_Plus_Base : public DecodeStatusReport
 {
     public:
-        DecodeAv1StatusReportXe_Lpm_Plus_Base(DecodeAllocator *alloc, bool enableRcs, PMOS_INTERFACE osInterface);
+        DecodeAv1StatusReportXe_Lpm_Plus_Base(DecodeAllocator *alloc, bool enableRcs, PMOS_INTERFACE osInterface, uint32_t statusNum = m_defaultStatusNum);
         virtual ~DecodeAv1StatusReportXe_Lpm_Plus_Base() {}
 
     protected:
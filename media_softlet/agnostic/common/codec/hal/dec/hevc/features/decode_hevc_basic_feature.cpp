@@ -27,6 +27,8 @@
 #include "decode_hevc_basic_feature.h"
 #include "decode_utils.h"
 #include "decode_allocator.h"
+#include "decode_resource_auto_lock.h"
+#include "mos_os_cp_interface_specific.h"
 
 namespace decode
 {
@@ -37,10 +39,21 @@ MOS_STATUS HevcBasicFeature::Init(void *setting)
     DECODE_CHK_NULL(setting);
     DECODE_CHK_NULL(m_hwInterface);
 
-    m_shortFormatInUse = ((CodechalSetting*)setting)->shortFormatInUse;
+    m_shortFormatInUse      = ((CodechalSetting*)setting)->shortFormatInUse;
+    m_shortFormatConfigured = m_shortFormatInUse;
 
     DECODE_CHK_STATUS(DecodeBasicFeature::Init(setting));
 
+    // Selected per context, the user setting only applies to contexts which don't request it
+    m_cpuSliceParsingEnabled = m_shortFormatConfigured && ((CodechalSetting*)setting)->cpuSliceHeaderParsing;
+    if (m_shortFormatConfigured && !m_cpuSliceParsingEnabled)
+    {
+        DECODE_CHK_NULL(m_osInterface);
+        m_userSettingPtr         = m_osInterface->pfnGetUserSettingInstance(m_osInterface);
+        m_cpuSliceParsingEnabled = ReadUserFeature(
+            m_userSettingPtr, "HEVC Decode CPU Slice Header Parsing", MediaUserSetting::Group::Sequence).Get<bool>();
+    }
+
     DECODE_CHK_STATUS(m_refFrames.Init(this, *m_allocator));
     DECODE_CHK_STATUS(m_mvBuffers.Init(m_hwInterface, *m_allocator, *this,
                                        CODEC_NUM_HEVC_INITIAL_MV_BUFFERS));
@@ -78,12 +91,64 @@ MOS_STATUS HevcBasicFeature::Update(void *params)
     m_hevcSccPicParams   = static_cast<PCODEC_HEVC_SCC_PIC_PARAMS>(decodeParams->m_advPicParams);
     m_hevcSubsetParams   = static_cast<PCODEC_HEVC_SUBSET_PARAMS>(decodeParams->m_subsetParams);
 
+    m_shortFormatInUse = m_shortFormatConfigured;
+    // Bitstream segments are only catenated on GPU, m_resDataBuffer doesn't hold the whole picture yet
+    if (m_shortFormatConfigured && m_cpuSliceParsingEnabled && decodeParams->m_numBitstreamSegments == 0)
+    {
+        DECODE_CHK_STATUS(ParseShortFormatSlices());
+    }
+
     DECODE_CHK_STATUS(SetPictureStructs());
     DECODE_CHK_STATUS(SetSliceStructs());
 
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS HevcBasicFeature::ParseShortFormatSlices()
+{
+    DECODE_FUNC_CALL();
+
+    // Extension syntax is not handled by CPU parser, keep HuC S2L for these pictures
+    if (m_hevcRextPicParams != nullptr || m_hevcSccPicParams != nullptr ||
+        (m_hevcPicParams->tiles_enabled_flag && m_hevcPicParams->entropy_coding_sync_enabled_flag))
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    if (m_osInterface->osCpInterface != nullptr && m_osInterface->osCpInterface->IsHMEnabled())
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    for (uint32_t i = 0; i < m_numSlices; i++)
+    {
+        if (m_hevcSliceParams[i].slice_chopping != 0 ||
+            m_hevcSliceParams[i].slice_data_offset > m_dataSize ||
+            m_hevcSliceParams[i].slice_data_size > m_dataSize - m_hevcSliceParams[i].slice_data_offset)
+        {
+            return MOS_STATUS_SUCCESS;
+        }
+    }
+
+    ResourceAutoLock resLock(m_allocator, &m_resDataBuffer.OsResource);
+    const uint8_t *bitstream = (const uint8_t *)resLock.LockResourceForRead();
+    if (bitstream == nullptr)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MOS_STATUS status = m_sliceHeaderParser.ParseSlices(
+        *m_hevcPicParams, bitstream + m_dataOffset, m_dataSize, m_hevcSliceParams, m_numSlices);
+    if (status != MOS_STATUS_SUCCESS)
+    {
+        DECODE_NORMALMESSAGE("CPU slice header parsing falls back to HuC, status %d", status);
+        return MOS_STATUS_SUCCESS;
+    }
+
+    m_shortFormatInUse = false;
+    return MOS_STATUS_SUCCESS;
+}
+
 MOS_STATUS HevcBasicFeature::ErrorDetectAndConceal()
 {
 
@@ -32,6 +32,7 @@
 #include "decode_hevc_reference_frames.h"
 #include "decode_hevc_mv_buffers.h"
 #include "decode_hevc_tile_coding.h"
+#include "decode_hevc_slice_header_parser.h"
 
 namespace decode
 {
@@ -91,6 +92,7 @@ public:
 
     bool                            m_dummyReferenceSlot[CODECHAL_MAX_CUR_NUM_REF_FRAME_HEVC];
     bool                            m_shortFormatInUse = false;     //!< Indicate if short format
+    bool                            m_cpuSliceParsingEnabled = false; //!< Parse short format slice headers on CPU instead of HuC S2L
 
 protected:
     virtual MOS_STATUS SetRequiredBitstreamSize(uint32_t requiredSize) override;
@@ -99,7 +101,17 @@ protected:
     MOS_STATUS SetSliceStructs();
     MOS_STATUS ErrorDetectAndConceal();
 
+    //!
+    //! \brief  Convert short format slice params to long format on CPU
+    //! \details Leaves m_shortFormatInUse set when the picture needs HuC S2L
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS ParseShortFormatSlices();
+
     PMOS_INTERFACE        m_osInterface  = nullptr;
+    bool                  m_shortFormatConfigured = false;  //!< Short format requested at codec creation
+    HevcSliceHeaderParser m_sliceHeaderParser;              //!< CPU slice header parser
 
 MEDIA_CLASS_DEFINE_END(decode__HevcBasicFeature)
 };
@@ -0,0 +1,705 @@
+/*
+* Copyright (c) 2023, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     decode_hevc_slice_header_parser.cpp
+//! \brief    Implements the CPU slice header parser for hevc short format decode
+//!
+
+#include <array>
+#include "decode_hevc_slice_header_parser.h"
+#include "decode_utils.h"
+
+namespace decode
+{
+
+// NAL unit types referenced by slice_segment_header()
+static constexpr uint8_t hevcNalBlaWLp       = 16;
+static constexpr uint8_t hevcNalRsvIrapVcl23 = 23;
+static constexpr uint8_t hevcNalIdrWRadl     = 19;
+static constexpr uint8_t hevcNalIdrNLp       = 20;
+static constexpr uint8_t hevcNalMaxVcl       = 31;
+
+static constexpr uint8_t hevcSliceB = 0;
+static constexpr uint8_t hevcSliceP = 1;
+static constexpr uint8_t hevcSliceI = 2;
+
+static const std::array<uint8_t, 256> &LeadingZeroTable()
+{
+    static const std::array<uint8_t, 256> table = []() {
+        std::array<uint8_t, 256> t = {};
+        t[0] = 8;
+        for (uint32_t i = 1; i < 256; i++)
+        {
+            uint8_t zeros = 0;
+            while (((i << zeros) & 0x80) == 0)
+            {
+                zeros++;
+            }
+            t[i] = zeros;
+        }
+        return t;
+    }();
+    return table;
+}
+
+uint32_t HevcBitReader::Peek32() const
+{
+    uint32_t bytePos = (uint32_t)(m_bitPos >> 3);
+    uint64_t value   = 0;
+
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        value = (value << 8) | ((bytePos + i < m_size) ? m_data[bytePos + i] : 0);
+    }
+
+    return (uint32_t)(value >> (8 - (m_bitPos & 7)));
+}
+
+uint32_t HevcBitReader::ReadBits(uint32_t numBits)
+{
+    if (numBits == 0)
+    {
+        return 0;
+    }
+
+    uint32_t value = Peek32() >> (32 - numBits);
+    m_bitPos += numBits;
+    return value;
+}
+
+uint32_t HevcBitReader::ReadUe()
+{
+    const auto &table = LeadingZeroTable();
+
+    uint32_t bits  = Peek32();
+    uint32_t zeros = 0;
+    while (zeros < 32 && table[bits >> 24] == 8)
+    {
+        zeros += 8;
+        bits <<= 8;
+    }
+    zeros += table[bits >> 24];
+
+    if (zeros > 31)
+    {
+        // Not a valid code for any syntax element, force overrun
+        m_bitPos = ((uint64_t)m_size << 3) + 1;
+        return 0;
+    }
+
+    m_bitPos += zeros + 1;
+    return (uint32_t)((1ull << zeros) - 1 + ReadBits(zeros));
+}
+
+int32_t HevcBitReader::ReadSe()
+{
+    uint32_t codeNum = ReadUe();
+    return (codeNum & 1) ? (int32_t)((codeNum + 1) >> 1) : -(int32_t)(codeNum >> 1);
+}
+
+uint32_t HevcSliceHeaderParser::CeilLog2(uint32_t value)
+{
+    uint32_t log2 = 0;
+    while ((1u << log2) < value)
+    {
+        log2++;
+    }
+    return log2;
+}
+
+uint32_t HevcSliceHeaderParser::Unescape(const uint8_t *nalUnit, uint32_t nalUnitSize)
+{
+    uint32_t size = MOS_MIN(nalUnitSize, m_maxHeaderBytes);
+
+    m_rbsp.clear();
+    m_epbPositions.clear();
+    m_rbsp.reserve(size);
+
+    uint32_t zeros = 0;
+    for (uint32_t i = 0; i < size; i++)
+    {
+        if (zeros >= 2 && nalUnit[i] == 0x03)
+        {
+            m_epbPositions.push_back((uint32_t)m_rbsp.size());
+            zeros = 0;
+            continue;
+        }
+        zeros = (nalUnit[i] == 0) ? zeros + 1 : 0;
+        m_rbsp.push_back(nalUnit[i]);
+    }
+
+    return size;
+}
+
+uint32_t HevcSliceHeaderParser::GetRawOffset(uint32_t rbspOffset) const
+{
+    uint32_t rawOffset = rbspOffset;
+    for (auto pos : m_epbPositions)
+    {
+        if (pos > rbspOffset)
+        {
+            break;
+        }
+        rawOffset++;
+    }
+    return rawOffset;
+}
+
+MOS_STATUS HevcSliceHeaderParser::ParseSlices(
+    const CODEC_HEVC_PIC_PARAMS &picParams,
+    const uint8_t               *bitstream,
+    uint32_t                     bitstreamSize,
+    PCODEC_HEVC_SLICE_PARAMS     sliceParams,
+    uint32_t                     numSlices)
+{
+    DECODE_FUNC_CALL();
+
+    DECODE_CHK_NULL(bitstream);
+    DECODE_CHK_NULL(sliceParams);
+
+    m_parsedSlices.resize(numSlices);
+
+    const CODEC_HEVC_SLICE_PARAMS *prevSlice = nullptr;
+    for (uint32_t i = 0; i < numSlices; i++)
+    {
+        const CODEC_HEVC_SLICE_PARAMS &shortSlice = sliceParams[i];
+        CODEC_HEVC_SLICE_PARAMS       &slice      = m_parsedSlices[i];
+
+        if (shortSlice.slice_chopping != 0)
+        {
+            return MOS_STATUS_UNIMPLEMENTED;
+        }
+        DECODE_CHK_COND(shortSlice.slice_data_offset > bitstreamSize ||
+                        shortSlice.slice_data_size > bitstreamSize - shortSlice.slice_data_offset,
+            "Slice %d exceeds bitstream buffer", i);
+
+        // Long format slice data starts at the NAL unit header, skip start code prefix if present
+        const uint8_t *data      = bitstream + shortSlice.slice_data_offset;
+        uint32_t       size      = shortSlice.slice_data_size;
+        uint32_t       prefixLen = 0;
+        while (prefixLen < 3 && prefixLen < size && data[prefixLen] == 0)
+        {
+            prefixLen++;
+        }
+        if (prefixLen >= 2 && prefixLen < size && data[prefixLen] == 1)
+        {
+            prefixLen++;
+        }
+        else
+        {
+            prefixLen = 0;
+        }
+
+        MOS_ZeroMemory(&slice, sizeof(slice));
+        slice.slice_data_offset = shortSlice.slice_data_offset + prefixLen;
+        slice.slice_data_size   = shortSlice.slice_data_size - prefixLen;
+
+        DECODE_CHK_STATUS(ParseSlice(picParams, data + prefixLen, size - prefixLen, prevSlice, slice));
+
+        if (!slice.LongSliceFlags.fields.dependent_slice_segment_flag)
+        {
+            prevSlice = &slice;
+        }
+    }
+
+    if (numSlices > 0)
+    {
+        m_parsedSlices[numSlices - 1].LongSliceFlags.fields.LastSliceOfPic = 1;
+    }
+
+    for (uint32_t i = 0; i < numSlices; i++)
+    {
+        sliceParams[i] = m_parsedSlices[i];
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS HevcSliceHeaderParser::ParseSlice(
+    const CODEC_HEVC_PIC_PARAMS   &picParams,
+    const uint8_t                 *nalUnit,
+    uint32_t                       nalUnitSize,
+    const CODEC_HEVC_SLICE_PARAMS *prevSlice,
+    CODEC_HEVC_SLICE_PARAMS       &slice)
+{
+    DECODE_FUNC_CALL();
+
+    uint32_t headerSize = Unescape(nalUnit, nalUnitSize);
+    DECODE_CHK_COND(m_rbsp.size() < 3, "Slice NAL unit is too short");
+
+    HevcBitReader reader(m_rbsp.data(), (uint32_t)m_rbsp.size());
+
+    // nal_unit_header()
+    DECODE_CHK_COND(reader.ReadBits(1) != 0, "forbidden_zero_bit is set");
+    uint8_t nalUnitType = (uint8_t)reader.ReadBits(6);
+    DECODE_CHK_COND(nalUnitType > hevcNalMaxVcl, "NAL unit type %d is not a slice", nalUnitType);
+    if (reader.ReadBits(6) != 0)
+    {
+        return MOS_STATUS_UNIMPLEMENTED;  // multi-layer extension
+    }
+    reader.SkipBits(3);
+
+    uint32_t minCbSize     = 1 << (picParams.log2_min_luma_coding_block_size_minus3 + 3);
+    uint32_t ctbSize       = minCbSize << picParams.log2_diff_max_min_luma_coding_block_size;
+    uint32_t widthInCtb    = MOS_ROUNDUP_DIVIDE(picParams.PicWidthInMinCbsY * minCbSize, ctbSize);
+    uint32_t heightInCtb   = MOS_ROUNDUP_DIVIDE(picParams.PicHeightInMinCbsY * minCbSize, ctbSize);
+    uint32_t chromaArrType = picParams.separate_colour_plane_flag ? 0 : picParams.chroma_format_idc;
+
+    bool firstSliceSegmentInPic = reader.ReadBits(1);
+    if (nalUnitType >= hevcNalBlaWLp && nalUnitType <= hevcNalRsvIrapVcl23)
+    {
+        reader.SkipBits(1);  // no_output_of_prior_pics_flag
+    }
+    reader.ReadUe();  // slice_pic_parameter_set_id
+
+    bool dependentSliceSegment = false;
+    if (!firstSliceSegmentInPic)
+    {
+        if (picParams.dependent_slice_segments_enabled_flag)
+        {
+            dependentSliceSegment = reader.ReadBits(1);
+        }
+        slice.slice_segment_address = reader.ReadBits(CeilLog2(widthInCtb * heightInCtb));
+        DECODE_CHK_COND(slice.slice_segment_address >= widthInCtb * heightInCtb, "Invalid slice_segment_address");
+    }
+
+    if (dependentSliceSegment)
+    {
+        // Dependent slice segments inherit the header of the preceding independent segment
+        DECODE_CHK_NULL(prevSlice);
+        uint32_t address = slice.slice_segment_address;
+        uint32_t offset  = slice.slice_data_offset;
+        uint32_t size    = slice.slice_data_size;
+        slice            = *prevSlice;
+
+        slice.slice_segment_address                             = address;
+        slice.slice_data_offset                                 = offset;
+        slice.slice_data_size                                   = size;
+        slice.LongSliceFlags.fields.dependent_slice_segment_flag = 1;
+    }
+    else
+    {
+        reader.SkipBits(picParams.num_extra_slice_header_bits);
+
+        uint32_t sliceType = reader.ReadUe();
+        DECODE_CHK_COND(sliceType > hevcSliceI, "Invalid slice_type %d", sliceType);
+        slice.LongSliceFlags.fields.slice_type = sliceType;
+
+        if (picParams.output_flag_present_flag)
+        {
+            reader.SkipBits(1);  // pic_output_flag
+        }
+        if (picParams.separate_colour_plane_flag)
+        {
+            slice.LongSliceFlags.fields.color_plane_id = reader.ReadBits(2);
+        }
+
+        if (nalUnitType != hevcNalIdrWRadl && nalUnitType != hevcNalIdrNLp)
+        {
+            reader.SkipBits(picParams.log2_max_pic_order_cnt_lsb_minus4 + 4);  // slice_pic_order_cnt_lsb
+
+            bool shortTermRefPicSetSps = reader.ReadBits(1);
+            if (!shortTermRefPicSetSps)
+            {
+                reader.SkipBits(picParams.wNumBitsForShortTermRPSInSlice);
+            }
+            else if (picParams.num_short_term_ref_pic_sets > 1)
+            {
+                reader.SkipBits(CeilLog2(picParams.num_short_term_ref_pic_sets));
+            }
+
+            if (picParams.long_term_ref_pics_present_flag)
+            {
+                uint32_t numLongTermSps = 0;
+                if (picParams.num_long_term_ref_pic_sps > 0)
+                {
+                    numLongTermSps = reader.ReadUe();
+                }
+                uint32_t numLongTermPics = reader.ReadUe();
+                DECODE_CHK_COND(numLongTermSps + numLongTermPics > 32, "Invalid long term picture number");
+
+                for (uint32_t i = 0; i < numLongTermSps + numLongTermPics; i++)
+                {
+                    if (i < numLongTermSps)
+                    {
+                        if (picParams.num_long_term_ref_pic_sps > 1)
+                        {
+                            reader.SkipBits(CeilLog2(picParams.num_long_term_ref_pic_sps));  // lt_idx_sps
+                        }
+                    }
+                    else
+                    {
+                        reader.SkipBits(picParams.log2_max_pic_order_cnt_lsb_minus4 + 4 + 1);  // poc_lsb_lt, used_by_curr_pic_lt_flag
+                    }
+                    if (reader.ReadBits(1))  // delta_poc_msb_present_flag
+                    {
+                        reader.ReadUe();  // delta_poc_msb_cycle_lt
+                    }
+                }
+            }
+
+            if (picParams.sps_temporal_mvp_enabled_flag)
+            {
+                slice.LongSliceFlags.fields.slice_temporal_mvp_enabled_flag = reader.ReadBits(1);
+            }
+        }
+
+        if (picParams.sample_adaptive_offset_enabled_flag)
+        {
+            slice.LongSliceFlags.fields.slice_sao_luma_flag = reader.ReadBits(1);
+            if (chromaArrType != 0)
+            {
+                slice.LongSliceFlags.fields.slice_sao_chroma_flag = reader.ReadBits(1);
+            }
+        }
+
+        uint8_t listEntry[2][CODEC_MAX_NUM_REF_FRAME_HEVC] = {};
+        bool    listModified[2]                            = {};
+
+        slice.collocated_ref_idx = 0xff;
+        if (sliceType != hevcSliceI)
+        {
+            slice.num_ref_idx_l0_active_minus1 = picParams.num_ref_idx_l0_default_active_minus1;
+            slice.num_ref_idx_l1_active_minus1 = (sliceType == hevcSliceB) ? picParams.num_ref_idx_l1_default_active_minus1 : 0;
+            if (reader.ReadBits(1))  // num_ref_idx_active_override_flag
+            {
+                uint32_t numRefL0 = reader.ReadUe();
+                DECODE_CHK_COND(numRefL0 >= CODEC_MAX_NUM_REF_FRAME_HEVC, "Invalid num_ref_idx_l0_active_minus1");
+                slice.num_ref_idx_l0_active_minus1 = (uint8_t)numRefL0;
+                if (sliceType == hevcSliceB)
+                {
+                    uint32_t numRefL1 = reader.ReadUe();
+                    DECODE_CHK_COND(numRefL1 >= CODEC_MAX_NUM_REF_FRAME_HEVC, "Invalid num_ref_idx_l1_active_minus1");
+                    slice.num_ref_idx_l1_active_minus1 = (uint8_t)numRefL1;
+                }
+            }
+
+            uint32_t numPicTotalCurr = 0;
+            for (uint32_t i = 0; i < 8; i++)
+            {
+                numPicTotalCurr += (picParams.RefPicSetStCurrBefore[i] < CODEC_MAX_NUM_REF_FRAME_HEVC) ? 1 : 0;
+                numPicTotalCurr += (picParams.RefPicSetStCurrAfter[i] < CODEC_MAX_NUM_REF_FRAME_HEVC) ? 1 : 0;
+                numPicTotalCurr += (picParams.RefPicSetLtCurr[i] < CODEC_MAX_NUM_REF_FRAME_HEVC) ? 1 : 0;
+            }
+            DECODE_CHK_COND(numPicTotalCurr == 0, "No reference picture for inter slice");
+
+            if (picParams.lists_modification_present_flag && numPicTotalCurr > 1)
+            {
+                uint32_t entryBits = CeilLog2(numPicTotalCurr);
+                for (uint32_t list = 0; list < ((sliceType == hevcSliceB) ? 2u : 1u); list++)
+                {
+                    listModified[list] = reader.ReadBits(1);
+                    if (listModified[list])
+                    {
+                        uint32_t numRef = list ? slice.num_ref_idx_l1_active_minus1 : slice.num_ref_idx_l0_active_minus1;
+                        for (uint32_t i = 0; i <= numRef; i++)
+                        {
+                            listEntry[list][i] = (uint8_t)reader.ReadBits(entryBits);
+                            DECODE_CHK_COND(listEntry[list][i] >= numPicTotalCurr, "Invalid list_entry");
+                        }
+                    }
+                }
+            }
+
+            if (sliceType == hevcSliceB)
+            {
+                slice.LongSliceFlags.fields.mvd_l1_zero_flag = reader.ReadBits(1);
+            }
+            if (picParams.cabac_init_present_flag)
+            {
+                slice.LongSliceFlags.fields.cabac_init_flag = reader.ReadBits(1);
+            }
+
+            if (slice.LongSliceFlags.fields.slice_temporal_mvp_enabled_flag)
+            {
+                uint32_t collocatedFromL0 = 1;
+                if (sliceType == hevcSliceB)
+                {
+                    collocatedFromL0 = reader.ReadBits(1);
+                }
+                slice.LongSliceFlags.fields.collocated_from_l0_flag = collocatedFromL0;
+
+                uint32_t numRef = collocatedFromL0 ? slice.num_ref_idx_l0_active_minus1 : slice.num_ref_idx_l1_active_minus1;
+                slice.collocated_ref_idx = 0;
+                if (numRef > 0)
+                {
+                    uint32_t collocatedRefIdx = reader.ReadUe();
+                    DECODE_CHK_COND(collocatedRefIdx > numRef, "Invalid collocated_ref_idx");
+                    slice.collocated_ref_idx = (uint8_t)collocatedRefIdx;
+                }
+            }
+
+            if ((picParams.weighted_pred_flag && sliceType == hevcSliceP) ||
+                (picParams.weighted_bipred_flag && sliceType == hevcSliceB))
+            {
+                DECODE_CHK_STATUS(ParsePredWeightTable(picParams, reader, slice));
+            }
+
+            uint32_t fiveMinusMaxNumMergeCand = reader.ReadUe();
+            DECODE_CHK_COND(fiveMinusMaxNumMergeCand > 4, "Invalid five_minus_max_num_merge_cand");
+            slice.five_minus_max_num_merge_cand = (uint8_t)fiveMinusMaxNumMergeCand;
+
+            DECODE_CHK_STATUS(BuildRefPicLists(picParams, listEntry, listModified, slice));
+        }
+        else
+        {
+            for (uint32_t list = 0; list < 2; list++)
+            {
+                for (uint32_t i = 0; i < CODEC_MAX_NUM_REF_FRAME_HEVC; i++)
+                {
+                    slice.RefPicList[list][i].FrameIdx = 0x7f;
+                    slice.RefPicList[list][i].PicFlags = PICTURE_INVALID;
+                    slice.RefPicList[list][i].PicEntry = 0xff;
+                }
+            }
+        }
+
+        slice.slice_qp_delta = (char)reader.ReadSe();
+        if (picParams.pps_slice_chroma_qp_offsets_present_flag)
+        {
+            slice.slice_cb_qp_offset = (char)reader.ReadSe();
+            slice.slice_cr_qp_offset = (char)reader.ReadSe();
+        }
+
+        bool deblockingFilterOverride = false;
+        if (picParams.deblocking_filter_override_enabled_flag)
+        {
+            deblockingFilterOverride = reader.ReadBits(1);
+        }
+
+        slice.LongSliceFlags.fields.slice_deblocking_filter_disabled_flag = picParams.pps_deblocking_filter_disabled_flag;
+        slice.slice_beta_offset_div2                                      = picParams.pps_beta_offset_div2;
+        slice.slice_tc_offset_div2                                        = picParams.pps_tc_offset_div2;
+        if (deblockingFilterOverride)
+        {
+            slice.LongSliceFlags.fields.slice_deblocking_filter_disabled_flag = reader.ReadBits(1);
+            if (!slice.LongSliceFlags.fields.slice_deblocking_filter_disabled_flag)
+            {
+                slice.slice_beta_offset_div2 = (char)reader.ReadSe();
+                slice.slice_tc_offset_div2   = (char)reader.ReadSe();
+            }
+        }
+
+        slice.LongSliceFlags.fields.slice_loop_filter_across_slices_enabled_flag = picParams.pps_loop_filter_across_slices_enabled_flag;
+        if (picParams.pps_loop_filter_across_slices_enabled_flag &&
+            (slice.LongSliceFlags.fields.slice_sao_luma_flag ||
+             slice.LongSliceFlags.fields.slice_sao_chroma_flag ||
+             !slice.LongSliceFlags.fields.slice_deblocking_filter_disabled_flag))
+        {
+            slice.LongSliceFlags.fields.slice_loop_filter_across_slices_enabled_flag = reader.ReadBits(1);
+        }
+    }
+
+    slice.num_entry_point_offsets = 0;
+    if (picParams.tiles_enabled_flag || picParams.entropy_coding_sync_enabled_flag)
+    {
+        uint32_t numEntryPoints = reader.ReadUe();
+        DECODE_CHK_COND(numEntryPoints > widthInCtb * heightInCtb, "Invalid num_entry_point_offsets");
+        slice.num_entry_point_offsets = (uint16_t)numEntryPoints;
+        if (numEntryPoints > 0)
+        {
+            uint32_t offsetLen = reader.ReadUe() + 1;
+            DECODE_CHK_COND(offsetLen > 32, "Invalid offset_len_minus1");
+            reader.SkipBits(offsetLen * numEntryPoints);
+        }
+    }
+
+    if (picParams.slice_segment_header_extension_present_flag)
+    {
+        uint32_t extensionLength = reader.ReadUe();
+        DECODE_CHK_COND(extensionLength > 256, "Invalid slice_segment_header_extension_length");
+        reader.SkipBits(extensionLength << 3);
+    }
+
+    // byte_alignment()
+    DECODE_CHK_COND(reader.ReadBits(1) != 1, "Invalid alignment_bit_equal_to_one");
+    while (!reader.IsByteAligned())
+    {
+        reader.SkipBits(1);
+    }
+
+    if (reader.IsOverrun())
+    {
+        // Header longer than the unescaped window is legal but not expected, let HuC handle it
+        return (headerSize < nalUnitSize) ? MOS_STATUS_UNIMPLEMENTED : MOS_STATUS_INVALID_PARAMETER;
+    }
+
+    // Offset is counted in RBSP from the NAL unit header, same as long format input
+    uint32_t rbspOffset              = reader.GetBytePos();
+    slice.ByteOffsetToSliceData      = rbspOffset;
+    slice.NumEmuPrevnBytesInSliceHdr = (uint16_t)(GetRawOffset(rbspOffset) - rbspOffset);
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS HevcSliceHeaderParser::ParsePredWeightTable(
+    const CODEC_HEVC_PIC_PARAMS &picParams,
+    HevcBitReader               &reader,
+    CODEC_HEVC_SLICE_PARAMS     &slice)
+{
+    DECODE_FUNC_CALL();
+
+    uint32_t chromaArrType = picParams.separate_colour_plane_flag ? 0 : picParams.chroma_format_idc;
+
+    uint32_t lumaLog2WeightDenom = reader.ReadUe();
+    DECODE_CHK_COND(lumaLog2WeightDenom > 7, "Invalid luma_log2_weight_denom");
+    slice.luma_log2_weight_denom = (uint8_t)lumaLog2WeightDenom;
+
+    int32_t chromaLog2WeightDenom = lumaLog2WeightDenom;
+    if (chromaArrType != 0)
+    {
+        int32_t deltaChromaLog2WeightDenom = reader.ReadSe();
+        chromaLog2WeightDenom += deltaChromaLog2WeightDenom;
+        DECODE_CHK_COND(chromaLog2WeightDenom < 0 || chromaLog2WeightDenom > 7, "Invalid delta_chroma_log2_weight_denom");
+        slice.delta_chroma_log2_weight_denom = (uint8_t)deltaChromaLog2WeightDenom;
+    }
+
+    uint32_t numLists = (slice.LongSliceFlags.fields.slice_type == hevcSliceB) ? 2 : 1;
+    for (uint32_t list = 0; list < numLists; list++)
+    {
+        uint32_t numRef = (list ? slice.num_ref_idx_l1_active_minus1 : slice.num_ref_idx_l0_active_minus1) + 1;
+
+        char *deltaLumaWeight   = list ? slice.delta_luma_weight_l1 : slice.delta_luma_weight_l0;
+        char *lumaOffset        = list ? slice.luma_offset_l1 : slice.luma_offset_l0;
+        char(*deltaChromaWeight)[2] = list ? slice.delta_chroma_weight_l1 : slice.delta_chroma_weight_l0;
+        char(*chromaOffset)[2]      = list ? slice.ChromaOffsetL1 : slice.ChromaOffsetL0;
+
+        bool lumaWeightFlag[CODEC_MAX_NUM_REF_FRAME_HEVC]   = {};
+        bool chromaWeightFlag[CODEC_MAX_NUM_REF_FRAME_HEVC] = {};
+
+        // Reference pictures never share the POC of current picture without SCC
+        for (uint32_t i = 0; i < numRef; i++)
+        {
+            lumaWeightFlag[i] = reader.ReadBits(1);
+        }
+        if (chromaArrType != 0)
+        {
+            for (uint32_t i = 0; i < numRef; i++)
+            {
+                chromaWeightFlag[i] = reader.ReadBits(1);
+            }
+        }
+
+        for (uint32_t i = 0; i < numRef; i++)
+        {
+            if (lumaWeightFlag[i])
+            {
+                int32_t deltaWeight = reader.ReadSe();
+                int32_t offset      = reader.ReadSe();
+                DECODE_CHK_COND(deltaWeight < -128 || deltaWeight > 127 || offset < -128 || offset > 127,
+                    "Invalid luma weight or offset");
+                deltaLumaWeight[i] = (char)deltaWeight;
+                lumaOffset[i]      = (char)offset;
+            }
+            if (chromaWeightFlag[i])
+            {
+                for (uint32_t j = 0; j < 2; j++)
+                {
+                    int32_t deltaWeight = reader.ReadSe();
+                    int32_t deltaOffset = reader.ReadSe();
+                    DECODE_CHK_COND(deltaWeight < -128 || deltaWeight > 127 || deltaOffset < -512 || deltaOffset > 511,
+                        "Invalid chroma weight or offset");
+
+                    int32_t weight = (1 << chromaLog2WeightDenom) + deltaWeight;
+                    int32_t offset = 128 - ((128 * weight) >> chromaLog2WeightDenom) + deltaOffset;
+
+                    deltaChromaWeight[i][j] = (char)deltaWeight;
+                    chromaOffset[i][j]      = (char)CodecHal_Clip3(-128, 127, offset);
+                }
+            }
+        }
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS HevcSliceHeaderParser::BuildRefPicLists(
+    const CODEC_HEVC_PIC_PARAMS &picParams,
+    const uint8_t                listEntry[2][CODEC_MAX_NUM_REF_FRAME_HEVC],
+    const bool                   listModified[2],
+    CODEC_HEVC_SLICE_PARAMS     &slice)
+{
+    DECODE_FUNC_CALL();
+
+    const uint8_t *rpsLists[3] = {picParams.RefPicSetStCurrBefore, picParams.RefPicSetStCurrAfter, picParams.RefPicSetLtCurr};
+
+    for (uint32_t list = 0; list < 2; list++)
+    {
+        for (uint32_t i = 0; i < CODEC_MAX_NUM_REF_FRAME_HEVC; i++)
+        {
+            slice.RefPicList[list][i].FrameIdx = 0x7f;
+            slice.RefPicList[list][i].PicFlags = PICTURE_INVALID;
+            slice.RefPicList[list][i].PicEntry = 0xff;
+        }
+
+        if (list == 1 && slice.LongSliceFlags.fields.slice_type != hevcSliceB)
+        {
+            break;
+        }
+
+        // List 0 starts with StCurrBefore, list 1 with StCurrAfter, both end with LtCurr
+        const uint8_t *order[3] = {rpsLists[list], rpsLists[1 - list], rpsLists[2]};
+
+        uint8_t  tempList[16]   = {};
+        bool     tempIsLt[16]   = {};
+        uint32_t numRef         = (list ? slice.num_ref_idx_l1_active_minus1 : slice.num_ref_idx_l0_active_minus1) + 1;
+        uint32_t numTemp        = 0;
+        uint32_t numPicTotalCur = 0;
+        for (uint32_t set = 0; set < 3; set++)
+        {
+            for (uint32_t i = 0; i < 8; i++)
+            {
+                numPicTotalCur += (order[set][i] < CODEC_MAX_NUM_REF_FRAME_HEVC) ? 1 : 0;
+            }
+        }
+        uint32_t numRpsCurrTempList = MOS_MIN(MOS_MAX(numRef, numPicTotalCur), 16);
+
+        while (numTemp < numRpsCurrTempList)
+        {
+            for (uint32_t set = 0; set < 3 && numTemp < numRpsCurrTempList; set++)
+            {
+                for (uint32_t i = 0; i < 8 && numTemp < numRpsCurrTempList; i++)
+                {
+                    if (order[set][i] < CODEC_MAX_NUM_REF_FRAME_HEVC)
+                    {
+                        tempIsLt[numTemp]   = (set == 2);
+                        tempList[numTemp++] = order[set][i];
+                    }
+                }
+            }
+        }
+
+        for (uint32_t i = 0; i < numRef; i++)
+        {
+            uint32_t idx = listModified[list] ? listEntry[list][i] : i;
+            DECODE_CHK_COND(idx >= numTemp, "Invalid reference list entry");
+
+            slice.RefPicList[list][i].FrameIdx = tempList[idx];
+            slice.RefPicList[list][i].PicFlags = tempIsLt[idx] ? PICTURE_LONG_TERM_REFERENCE : PICTURE_FRAME;
+            slice.RefPicList[list][i].PicEntry = tempList[idx];
+        }
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+}  // namespace decode
@@ -0,0 +1,135 @@
+/*
+* Copyright (c) 2023, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     decode_hevc_slice_header_parser.h
+//! \brief    Defines the CPU slice header parser for hevc short format decode
+//!
+#ifndef __DECODE_HEVC_SLICE_HEADER_PARSER_H__
+#define __DECODE_HEVC_SLICE_HEADER_PARSER_H__
+
+#include <vector>
+#include "codec_def_decode_hevc.h"
+#include "media_class_trace.h"
+
+namespace decode
+{
+
+//!
+//! \brief  Bit reader for RBSP data with table driven Exp-Golomb decoding
+//!
+class HevcBitReader
+{
+public:
+    HevcBitReader(const uint8_t *data, uint32_t size) : m_data(data), m_size(size) {};
+
+    uint32_t ReadBits(uint32_t numBits);
+    uint32_t ReadUe();
+    int32_t  ReadSe();
+    void     SkipBits(uint32_t numBits) { m_bitPos += numBits; };
+
+    bool     IsByteAligned() const { return (m_bitPos & 7) == 0; };
+    bool     IsOverrun() const { return m_bitPos > ((uint64_t)m_size << 3); };
+    uint32_t GetBytePos() const { return (uint32_t)(m_bitPos >> 3); };
+
+protected:
+    uint32_t Peek32() const;
+
+    const uint8_t *m_data   = nullptr;
+    uint32_t       m_size   = 0;
+    uint64_t       m_bitPos = 0;
+
+MEDIA_CLASS_DEFINE_END(decode__HevcBitReader)
+};
+
+//!
+//! \brief  Convert hevc short format slice params to long format on CPU
+//! \details Parses slice_segment_header() of each slice from the bitstream and
+//!         derives the long format slice params HuC S2L would produce, so the
+//!         S2L pass can be skipped. Syntax which needs extension parameters
+//!         (range extension, SCC) is reported as unimplemented, callers should
+//!         then keep the HuC path for that picture.
+//!
+class HevcSliceHeaderParser
+{
+public:
+    HevcSliceHeaderParser() {};
+    ~HevcSliceHeaderParser() {};
+
+    //!
+    //! \brief  Parse slice headers and fill long format slice params
+    //! \param  [in] picParams
+    //!         Picture parameters of current picture
+    //! \param  [in] bitstream
+    //!         CPU address of the bitstream buffer
+    //! \param  [in] bitstreamSize
+    //!         Size of the bitstream buffer
+    //! \param  [in, out] sliceParams
+    //!         Short format slice params, updated only when all slices are parsed
+    //! \param  [in] numSlices
+    //!         Number of slices
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, MOS_STATUS_UNIMPLEMENTED if HuC is
+    //!         required, else fail reason
+    //!
+    MOS_STATUS ParseSlices(
+        const CODEC_HEVC_PIC_PARAMS &picParams,
+        const uint8_t               *bitstream,
+        uint32_t                     bitstreamSize,
+        PCODEC_HEVC_SLICE_PARAMS     sliceParams,
+        uint32_t                     numSlices);
+
+protected:
+    MOS_STATUS ParseSlice(
+        const CODEC_HEVC_PIC_PARAMS   &picParams,
+        const uint8_t                 *nalUnit,
+        uint32_t                       nalUnitSize,
+        const CODEC_HEVC_SLICE_PARAMS *prevSlice,
+        CODEC_HEVC_SLICE_PARAMS       &slice);
+
+    MOS_STATUS ParsePredWeightTable(
+        const CODEC_HEVC_PIC_PARAMS &picParams,
+        HevcBitReader               &reader,
+        CODEC_HEVC_SLICE_PARAMS     &slice);
+
+    MOS_STATUS BuildRefPicLists(
+        const CODEC_HEVC_PIC_PARAMS &picParams,
+        const uint8_t                listEntry[2][CODEC_MAX_NUM_REF_FRAME_HEVC],
+        const bool                   listModified[2],
+        CODEC_HEVC_SLICE_PARAMS     &slice);
+
+    uint32_t Unescape(const uint8_t *nalUnit, uint32_t nalUnitSize);
+    uint32_t GetRawOffset(uint32_t rbspOffset) const;
+
+    static uint32_t CeilLog2(uint32_t value);
+
+    static constexpr uint32_t m_maxHeaderBytes = 4096;  //!< Upper bound of escaped slice header size
+
+    std::vector<uint8_t>                 m_rbsp;         //!< Unescaped slice header
+    std::vector<uint32_t>                m_epbPositions; //!< RBSP offsets where emulation prevention bytes were removed
+    std::vector<CODEC_HEVC_SLICE_PARAMS> m_parsedSlices; //!< Long format params before commit
+
+MEDIA_CLASS_DEFINE_END(decode__HevcSliceHeaderParser)
+};
+
+}  // namespace decode
+
+#endif  // !__DECODE_HEVC_SLICE_HEADER_PARSER_H__
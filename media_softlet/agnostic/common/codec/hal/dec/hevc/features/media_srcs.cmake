@@ -26,6 +26,7 @@ set(SOFTLET_DECODE_HEVC_SOURCES_
     ${CMAKE_CURRENT_LIST_DIR}/decode_hevc_reference_frames.cpp
     ${CMAKE_CURRENT_LIST_DIR}/decode_hevc_mv_buffers.cpp
     ${CMAKE_CURRENT_LIST_DIR}/decode_hevc_tile_coding.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/decode_hevc_slice_header_parser.cpp
     ${CMAKE_CURRENT_LIST_DIR}/decode_hevc_downsampling_feature.cpp
 )
 
@@ -36,6 +37,7 @@ set(SOFTLET_DECODE_HEVC_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/decode_hevc_reference_frames.h
     ${CMAKE_CURRENT_LIST_DIR}/decode_hevc_mv_buffers.h
     ${CMAKE_CURRENT_LIST_DIR}/decode_hevc_tile_coding.h
+    ${CMAKE_CURRENT_LIST_DIR}/decode_hevc_slice_header_parser.h
     ${CMAKE_CURRENT_LIST_DIR}/decode_hevc_downsampling_feature.h
 )
 
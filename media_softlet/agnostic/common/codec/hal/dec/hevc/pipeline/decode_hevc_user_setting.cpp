@@ -67,6 +67,12 @@ MOS_STATUS HevcPipeline::InitUserSetting(MediaUserSettingSharedPtr userSettingPt
         MediaUserSetting::Group::Sequence,
         int32_t(0),
         true);
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "HEVC Decode CPU Slice Header Parsing",
+        MediaUserSetting::Group::Sequence,
+        int32_t(0),
+        true);
 #if (_DEBUG || _RELEASE_INTERNAL)
     DeclareUserSettingKeyForDebug(
         userSettingPtr,
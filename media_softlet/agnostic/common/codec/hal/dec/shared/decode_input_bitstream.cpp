@@ -119,6 +119,11 @@ MOS_STATUS DecodeInputBitstream::Append(const CodechalDecodeParams &decodeParams
     uint32_t segmentSize = decodeParams.m_dataSize;
 
     bool firstExecuteCall = (decodeParams.m_executeCallIndex == 0);
+    if (firstExecuteCall && decodeParams.m_numBitstreamSegments > 0)
+    {
+        return AppendSegments(decodeParams);
+    }
+
     if (firstExecuteCall)
     {
         m_requiredSize = m_basicFeature->m_dataSize;
@@ -148,13 +153,54 @@ MOS_STATUS DecodeInputBitstream::Append(const CodechalDecodeParams &decodeParams
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS DecodeInputBitstream::AppendSegments(const CodechalDecodeParams &decodeParams)
+{
+    DECODE_CHK_NULL(decodeParams.m_dataBuffer);
+    DECODE_CHK_NULL(decodeParams.m_bitstreamSegments);
+
+    // All segments come with the first execute call, the data buffer holds the
+    // bitstream up to the first segment and each segment has its final offset.
+    m_requiredSize = MOS_MAX(m_basicFeature->m_dataSize, decodeParams.m_dataSize);
+    DECODE_CHK_STATUS(AllocateCatenatedBuffer());
+    m_basicFeature->m_resDataBuffer = *m_catenatedBuffer;
+    m_basicFeature->m_dataOffset    = 0;
+    DECODE_CHK_STATUS(ActivatePacket(DecodePacketId(m_pipeline, hucCopyPacketId), true, 0, 0));
+
+    uint32_t headSize = decodeParams.m_bitstreamSegments[0].m_destOffset;
+    if (headSize > 0)
+    {
+        AddNewSegment(*(decodeParams.m_dataBuffer), decodeParams.m_dataOffset, headSize, 0);
+    }
+
+    for (uint32_t i = 0; i < decodeParams.m_numBitstreamSegments; i++)
+    {
+        const CodechalDecodeBitstreamSegment &segment = decodeParams.m_bitstreamSegments[i];
+        DECODE_CHK_NULL(segment.m_resource);
+        if (segment.m_destOffset > m_requiredSize || segment.m_size > m_requiredSize - segment.m_destOffset)
+        {
+            DECODE_ASSERTMESSAGE("Bitstream segment exceeds allocated buffer size!");
+            return MOS_STATUS_INVALID_PARAMETER;
+        }
+        AddNewSegment(*(segment.m_resource), segment.m_offset, segment.m_size, segment.m_destOffset);
+    }
+
+    m_segmentsTotalSize = m_requiredSize;
+
+    return MOS_STATUS_SUCCESS;
+}
+
 void DecodeInputBitstream::AddNewSegment(MOS_RESOURCE& resource, uint32_t offset, uint32_t size)
+{
+    AddNewSegment(resource, offset, size, m_segmentsTotalSize);
+}
+
+void DecodeInputBitstream::AddNewSegment(MOS_RESOURCE& resource, uint32_t offset, uint32_t size, uint32_t destOffset)
 {
     HucCopyPktItf::HucCopyParams copyParams;
     copyParams.srcBuffer    = &resource;
     copyParams.srcOffset    = offset;
     copyParams.destBuffer   = &(m_catenatedBuffer->OsResource);
-    copyParams.destOffset   = m_segmentsTotalSize;
+    copyParams.destOffset   = destOffset;
     copyParams.copyLength   = size;
     m_concatPkt->PushCopyParams(copyParams);
 }
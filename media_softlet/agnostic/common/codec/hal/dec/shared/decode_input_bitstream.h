@@ -125,6 +125,28 @@ protected:
     //!
     void AddNewSegment(MOS_RESOURCE& resource, uint32_t offset, uint32_t size);
 
+    //!
+    //! \brief  Add new segment to segment list at given offset of catenated buffer
+    //! \param  [in] resource
+    //!         Resource of current segment
+    //! \param  [in] offset
+    //!         Offset of current segment
+    //! \param  [in] size
+    //!         Size of current segment
+    //! \param  [in] destOffset
+    //!         Offset of current segment in catenated buffer
+    //!
+    void AddNewSegment(MOS_RESOURCE& resource, uint32_t offset, uint32_t size, uint32_t destOffset);
+
+    //!
+    //! \brief  Catenate the data buffer and the bitstream segments passed with it
+    //! \param  [in] decodeParams
+    //!         Decode parameters
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS AppendSegments(const CodechalDecodeParams &decodeParams);
+
     //!
     //! \brief  Initialize scalability parameters
     //!
@@ -56,6 +56,10 @@ DecodePipeline::DecodePipeline(
     m_singleTaskPhaseSupported =
         ReadUserFeature(m_userSettingPtr, "Decode Single Task Phase Enable", MediaUserSetting::Group::Sequence).Get<bool>();
 
+    // Applications which query status of many frames in flight need a larger ring
+    m_statusReportNum = MediaStatusReport::ClampStatusNum(
+        ReadUserFeature(m_userSettingPtr, "Decode Status Report Number", MediaUserSetting::Group::Sequence).Get<uint32_t>());
+
     m_pCodechalOcaDumper = MOS_New(CodechalOcaDumper);
     if (!m_pCodechalOcaDumper)
     {
@@ -70,7 +74,7 @@ DecodePipeline::DecodePipeline(
 
 MOS_STATUS DecodePipeline::CreateStatusReport()
 {
-    m_statusReport = MOS_New(DecodeStatusReport, m_allocator, true);
+    m_statusReport = MOS_New(DecodeStatusReport, m_allocator, true, m_statusReportNum);
     DECODE_CHK_NULL(m_statusReport);
     DECODE_CHK_STATUS(m_statusReport->Create());
 
@@ -518,6 +518,7 @@ protected:
     uint8_t                 m_numVdbox  = 0;            //!< Number of Vdbox
 
     bool                    m_singleTaskPhaseSupported = true; //!< Indicates whether sumbit packets in single phase
+    uint32_t                m_statusReportNum = MediaStatusReport::m_defaultStatusNum; //!< Number of status report entries
 
     MOS_GPU_CONTEXT         m_decodeContext = MOS_GPU_CONTEXT_INVALID_HANDLE;    //!< decode context inuse
     GPU_CONTEXT_HANDLE      m_decodeContextHandle = MOS_GPU_CONTEXT_INVALID_HANDLE;    //!< handle of decode context inuse
@@ -146,6 +146,12 @@ MOS_STATUS DecodePipeline::InitUserSetting(MediaUserSettingSharedPtr userSetting
         MediaUserSetting::Group::Sequence,
         int32_t(1),
         false);
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "Decode Status Report Number",
+        MediaUserSetting::Group::Sequence,
+        uint32_t(MediaStatusReport::m_defaultStatusNum),
+        false);
     DeclareUserSettingKey(
         userSettingPtr,
         "Decode RT Compressible",
@@ -31,9 +31,11 @@
 namespace decode {
 
     DecodeStatusReport::DecodeStatusReport(
-        DecodeAllocator* allocator, bool enableRcs):
+        DecodeAllocator* allocator, bool enableRcs, uint32_t statusNum):
+        MediaStatusReport(statusNum),
         m_enableRcs(enableRcs),
-        m_allocator(allocator)
+        m_allocator(allocator),
+        m_statusReportData(m_statusNum)
     {
         m_sizeOfReport = sizeof(DecodeStatusReportData);
     }
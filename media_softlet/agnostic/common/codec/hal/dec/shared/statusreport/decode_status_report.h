@@ -87,7 +87,7 @@ namespace decode {
     class DecodeStatusReport : public MediaStatusReport
     {
     public:
-        DecodeStatusReport(DecodeAllocator *alloc, bool enableRcs);
+        DecodeStatusReport(DecodeAllocator *alloc, bool enableRcs, uint32_t statusNum = m_defaultStatusNum);
         virtual ~DecodeStatusReport();
 
         //!
@@ -184,7 +184,7 @@ namespace decode {
         bool                   m_enableRcs = false;
         DecodeAllocator*       m_allocator = nullptr;  //!< Decode allocator
 
-        DecodeStatusReportData m_statusReportData[m_statusNum] = {};
+        std::vector<DecodeStatusReportData> m_statusReportData;
 
         const uint32_t         m_completedCountSize = sizeof(uint32_t) * 2;
         const uint32_t         m_statusBufSizeMfx   = MOS_ALIGN_CEIL(sizeof(DecodeStatusMfx), sizeof(uint64_t));
@@ -868,10 +868,14 @@ MHW_SETPAR_DECL_SRC(VDENC_CMD1, HevcBasicFeature)
     auto settings = static_cast<HevcVdencFeatureSettings *>(m_constSettings);
     ENCODE_CHK_NULL_RETURN(settings);
 
-    for (const auto &lambda : settings->vdencCmd1Settings)
-    {
-        ENCODE_CHK_STATUS_RETURN(lambda(params, m_ref.IsLowDelay()));
-    }
+    ENCODE_CHK_NULL_RETURN(m_hevcSeqParams);
+    ENCODE_CHK_NULL_RETURN(m_hevcPicParams);
+    ENCODE_CHK_NULL_RETURN(m_hevcSliceParams);
+    HevcVdencCmd1SettingsKey key(*m_hevcSeqParams, *m_hevcPicParams, *m_hevcSliceParams, m_ref.IsLowDelay());
+
+    // Settings only change with frame type and QP, so most frames reuse the previous result
+    ENCODE_CHK_STATUS_RETURN(settings->vdencCmd1Snapshot.Apply(
+        settings->vdencCmd1Settings, key, params, m_ref.IsLowDelay()));
 
     return MOS_STATUS_SUCCESS;
 }
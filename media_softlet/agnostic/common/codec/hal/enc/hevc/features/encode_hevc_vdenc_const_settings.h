@@ -123,6 +123,38 @@ struct HevcVdencArbSettings  // adaptive region boot settings
         m_rowOffsetsForBoost = {{0, 3, 5, 2, 7, 4, 1, 6}};
 };
 
+//!
+//! \brief  Inputs of the HEVC VDENC_CMD1 settings lambdas besides the command parameters
+//! \details Lambdas added to vdencCmd1Settings must only read these values.
+//!
+struct HevcVdencCmd1SettingsKey
+{
+    HevcVdencCmd1SettingsKey() = default;
+
+    HevcVdencCmd1SettingsKey(
+        const CODEC_HEVC_ENCODE_SEQUENCE_PARAMS &seqParams,
+        const CODEC_HEVC_ENCODE_PICTURE_PARAMS  &picParams,
+        const CODEC_HEVC_ENCODE_SLICE_PARAMS    &sliceParams,
+        bool                                     lowDelay) :
+        codingType(picParams.CodingType),
+        hierarchLevelPlus1(picParams.HierarchLevelPlus1),
+        qp((uint8_t)(picParams.QpY + sliceParams.slice_qp_delta)),
+        numRoi(picParams.NumROI),
+        gopRefDist(seqParams.GopRefDist),
+        lowDelayMode(seqParams.LowDelayMode),
+        isLowDelay(lowDelay)
+    {
+    }
+
+    uint32_t codingType         = 0;
+    uint32_t hierarchLevelPlus1 = 0;
+    uint32_t qp                 = 0;
+    uint32_t numRoi             = 0;
+    uint32_t gopRefDist         = 0;
+    uint32_t lowDelayMode       = 0;
+    uint32_t isLowDelay         = 0;
+};
+
 struct HevcVdencFeatureSettings : VdencFeatureSettings
 {
     std::array<bool, NUM_TARGET_USAGE_MODES + 1> rdoqEnable{};
@@ -174,6 +206,8 @@ struct HevcVdencFeatureSettings : VdencFeatureSettings
 
     HevcVdencBrcSettings brcSettings = {};
     HevcVdencArbSettings arbSettings = {};
+
+    VdencSettingsSnapshot<mhw::vdbox::vdenc::_MHW_PAR_T(VDENC_CMD1), HevcVdencCmd1SettingsKey> vdencCmd1Snapshot;
 };
 
 struct HevcVdencBrcConstSettings
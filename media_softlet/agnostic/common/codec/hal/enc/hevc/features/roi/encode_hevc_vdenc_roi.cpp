@@ -49,20 +49,11 @@ HevcVdencRoi::HevcVdencRoi(
     m_basicFeature = dynamic_cast<EncodeBasicFeature *>(m_featureManager->GetFeature(FeatureIDs::basicFeature));
     ENCODE_CHK_NULL_NO_STATUS_RETURN(m_basicFeature);
 }
-MOS_STATUS HevcVdencRoi::ClearStreaminBuffer(uint32_t lucNumber)
-{
-    // Clear streamin
-    ENCODE_CHK_NULL_RETURN(m_streamInTemp);
-
-    uint8_t *data = (uint8_t *)m_allocator->LockResourceForWrite(m_streamIn);
-    ENCODE_CHK_NULL_RETURN(data);
-
-    MOS_ZeroMemory(m_streamInTemp, lucNumber * 64);
-    MOS_SecureMemcpy(data, m_streamInSize, m_streamInTemp, m_streamInSize);
-
-    ENCODE_CHK_STATUS_RETURN(m_allocator->UnLock(m_streamIn));
 
-    return MOS_STATUS_SUCCESS;
+HevcVdencRoi::~HevcVdencRoi()
+{
+    MOS_SafeFreeMemory(m_streamInTemp);
+    m_streamInTemp = nullptr;
 }
 
 MOS_STATUS HevcVdencRoi::Init(void *setting)
@@ -158,14 +149,26 @@ MOS_STATUS HevcVdencRoi::Update(void *params)
 
     if (!m_isArbRoi || (hevcPicParams->CodingType == I_TYPE && !IFrameIsSet) || ((hevcPicParams->CodingType == P_TYPE || hevcPicParams->CodingType == B_TYPE) && !PBFrameIsSet))
     {
-        m_streamInTemp = (uint8_t *)MOS_AllocMemory(m_streamInSize);
-        ENCODE_CHK_NULL_RETURN(m_streamInTemp);
+        if (m_streamInTemp == nullptr)
+        {
+            m_streamInTemp = (uint8_t *)MOS_AllocAndZeroMemory(m_streamInSize);
+            ENCODE_CHK_NULL_RETURN(m_streamInTemp);
+        }
 
-        uint32_t lcuNumber = GetLCUNumber();
+        // Streamin data generated for last frame is kept in m_streamInTemp,
+        // only regenerate it when the parameters it depends on changed.
+        m_streamInReused = IsStreaminDataUnchanged(hevcSeqParams, hevcPicParams, hevcSlcParams);
 
-        ENCODE_CHK_STATUS_RETURN(ClearStreaminBuffer(lcuNumber));
+        if (!m_streamInReused)
+        {
+            uint32_t lcuNumber = GetLCUNumber();
 
-        m_roiOverlap.Update(lcuNumber);
+            // Stays invalid if generation below fails part way,
+            // SaveStreaminDataParams validates it on success.
+            m_streamInDataValid = false;
+            MOS_ZeroMemory(m_streamInTemp, lcuNumber * 64);
+            m_roiOverlap.Update(lcuNumber);
+        }
 
         ENCODE_CHK_STATUS_RETURN(ExecuteDirtyRoi(hevcSeqParams, hevcPicParams, hevcSlcParams));
 
@@ -185,7 +188,10 @@ MOS_STATUS HevcVdencRoi::Update(void *params)
 
         ENCODE_CHK_STATUS_RETURN(WriteStreaminData());
 
-        MOS_SafeFreeMemory(m_streamInTemp);
+        if (!m_streamInReused)
+        {
+            SaveStreaminDataParams(hevcSeqParams, hevcPicParams, hevcSlcParams);
+        }
 
 #if (_DEBUG || _RELEASE_INTERNAL)
         ENCODE_CHK_NULL_RETURN(m_hwInterface);
@@ -218,10 +224,13 @@ MOS_STATUS HevcVdencRoi::WriteStreaminData()
     uint8_t *streaminBuffer = (uint8_t *)m_allocator->LockResourceForWrite(m_streamIn);
     ENCODE_CHK_NULL_RETURN(streaminBuffer);
 
-    m_roiOverlap.WriteStreaminData(
-        m_strategyFactory.GetRoi(), 
-        m_strategyFactory.GetDirtyRoi(),
-        m_streamInTemp);
+    if (!m_streamInReused)
+    {
+        m_roiOverlap.WriteStreaminData(
+            m_strategyFactory.GetRoi(),
+            m_strategyFactory.GetDirtyRoi(),
+            m_streamInTemp);
+    }
 
     MOS_SecureMemcpy(streaminBuffer, m_streamInSize, m_streamInTemp, m_streamInSize);
 
@@ -263,7 +272,10 @@ MOS_STATUS HevcVdencRoi::ExecuteRoi(
     ENCODE_CHK_STATUS_RETURN(
         strategy->PrepareParams(hevcSeqParams, hevcPicParams, hevcSlcParams));
 
-    ENCODE_CHK_STATUS_RETURN(strategy->SetupRoi(m_roiOverlap));
+    if (!m_streamInReused)
+    {
+        ENCODE_CHK_STATUS_RETURN(strategy->SetupRoi(m_roiOverlap));
+    }
     return MOS_STATUS_SUCCESS;
 }
 
@@ -288,7 +300,10 @@ MOS_STATUS HevcVdencRoi::ExecuteRoiExt(
     ENCODE_CHK_STATUS_RETURN(
         strategy->PrepareParams(hevcSeqParams, hevcPicParams, hevcSlcParams));
 
-    ENCODE_CHK_STATUS_RETURN(strategy->SetupRoi(m_roiOverlap));
+    if (!m_streamInReused)
+    {
+        ENCODE_CHK_STATUS_RETURN(strategy->SetupRoi(m_roiOverlap));
+    }
     return MOS_STATUS_SUCCESS;
 }
 
@@ -311,11 +326,63 @@ MOS_STATUS HevcVdencRoi::ExecuteDirtyRoi(
     ENCODE_CHK_STATUS_RETURN(
         strategy->PrepareParams(hevcSeqParams, hevcPicParams, hevcSlcParams));
 
-    ENCODE_CHK_STATUS_RETURN(strategy->SetupRoi(m_roiOverlap));
+    if (!m_streamInReused)
+    {
+        ENCODE_CHK_STATUS_RETURN(strategy->SetupRoi(m_roiOverlap));
+    }
 
     return MOS_STATUS_SUCCESS;
 }
 
+bool HevcVdencRoi::IsStreaminDataUnchanged(
+    SeqParams *hevcSeqParams,
+    PicParams *hevcPicParams,
+    SlcParams *hevcSlcParams)
+{
+    ENCODE_FUNC_CALL();
+
+    // ARB ROI has its own buffer reuse, MB QP map and tile layouts are
+    // not part of the saved parameters.
+    if (!m_streamInDataValid || m_isArbRoi || m_mbQpDataEnabled || hevcPicParams->tiles_enabled_flag)
+    {
+        return false;
+    }
+
+    return m_streamInDataParams.Matches(
+        m_basicFeature->m_frameWidth,
+        m_basicFeature->m_frameHeight,
+        m_basicFeature->m_oriFrameHeight,
+        *hevcSeqParams,
+        *hevcPicParams,
+        *hevcSlcParams,
+        m_roiEnabled,
+        m_dirtyRoiEnabled);
+}
+
+void HevcVdencRoi::SaveStreaminDataParams(
+    SeqParams *hevcSeqParams,
+    PicParams *hevcPicParams,
+    SlcParams *hevcSlcParams)
+{
+    ENCODE_FUNC_CALL();
+
+    m_streamInDataParams.Save(
+        m_basicFeature->m_frameWidth,
+        m_basicFeature->m_frameHeight,
+        m_basicFeature->m_oriFrameHeight,
+        *hevcSeqParams,
+        *hevcPicParams,
+        *hevcSlcParams,
+        m_roiEnabled,
+        m_dirtyRoiEnabled);
+
+    // HuC based force QP ROI generates its streamin data on GPU from per
+    // frame buffers, so its setup can not be skipped.
+    RoiStrategy *roi = m_roiEnabled ? m_strategyFactory.GetRoi() : nullptr;
+    m_streamInDataValid = !m_isArbRoi && !m_mbQpDataEnabled && !hevcPicParams->tiles_enabled_flag &&
+                          (roi == nullptr || roi->GetStreamInBuf() == nullptr);
+}
+
 bool HevcVdencRoi::ProcessRoiDeltaQp(
     uint8_t    numROI,
     CODEC_ROI  *roiRegions,
@@ -30,6 +30,7 @@
 #include "media_feature.h"
 #include "encode_hevc_vdenc_roi_overlap.h"
 #include "encode_hevc_vdenc_roi_strategy.h"
+#include "encode_hevc_vdenc_roi_streamin_params.h"
 #include "encode_hevc_brc.h"
 #include "mhw_vdbox_vdenc_itf.h"
 #include "mhw_vdbox_huc_itf.h"
@@ -60,7 +61,7 @@ public:
         CodechalHwInterfaceNext *hwInterface,
         void *constSettings);
 
-    virtual ~HevcVdencRoi() {}
+    virtual ~HevcVdencRoi();
 
     //!
     //! \brief  Init encode parameter
@@ -205,11 +206,37 @@ protected:
     }
 
     //!
-    //! \brief    ClearStreaminBuffer
-    //! \return   MOS_STATUS
-    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //! \brief    Check whether the streamin data of last frame can be reused
+    //!
+    //! \param    [in] hevcSeqParams
+    //!           pointer of sequence parameters
+    //! \param    [in] hevcPicParams
+    //!           pointer of picture parameters
+    //! \param    [in] hevcSlcParams
+    //!           pointer of slice parameters
+    //! \return   bool
+    //!           true if all parameters the streamin data depends on are unchanged
+    //!
+    bool IsStreaminDataUnchanged(
+        SeqParams *hevcSeqParams,
+        PicParams *hevcPicParams,
+        SlcParams *hevcSlcParams);
+
+    //!
+    //! \brief    Save the parameters the streamin data is generated from
+    //!
+    //! \param    [in] hevcSeqParams
+    //!           pointer of sequence parameters
+    //! \param    [in] hevcPicParams
+    //!           pointer of picture parameters
+    //! \param    [in] hevcSlcParams
+    //!           pointer of slice parameters
+    //! \return   void
     //!
-    MOS_STATUS ClearStreaminBuffer(uint32_t lucNumber);
+    void SaveStreaminDataParams(
+        SeqParams *hevcSeqParams,
+        PicParams *hevcPicParams,
+        SlcParams *hevcSlcParams);
 
     //!
     //! \brief    Get strategy for setting command parameters
@@ -244,8 +271,12 @@ protected:
     bool m_isArbRoiSupported = true;     //!< Whether is Adaptive Region Boost ROI Supported
 
     PMOS_RESOURCE      m_streamIn = nullptr; //!< Stream in buffer
-    uint8_t *          m_streamInTemp = nullptr;
+    uint8_t *          m_streamInTemp = nullptr; //!< Streamin data of last generated frame
     uint32_t           m_streamInSize = 0;
+
+    HevcVdencRoiStreaminParams m_streamInDataParams;  //!< Parameters of the streamin data in m_streamInTemp
+    bool               m_streamInDataValid = false;   //!< m_streamInTemp can be reused if parameters unchanged
+    bool               m_streamInReused    = false;   //!< Streamin data of last frame reused in current frame
     RoiStrategyFactory m_strategyFactory;    //!< Factory of strategy
     RoiOverlap         m_roiOverlap;         //!< ROI and dirty ROI overlap
 
@@ -86,7 +86,7 @@ public:
     //! \return void
     //!
     void MarkLcus(
-        const UintVector lcus, 
+        const UintVector &lcus, 
         OverlapMarker marker, 
         int32_t roiRegionIndex = m_maskRoiRegionIndex)
     {
@@ -64,6 +64,9 @@ MOS_STATUS RoiStrategy::PrepareParams(
     m_roiDistinctDeltaQp = hevcPicParams->ROIDistinctDeltaQp;
     ENCODE_CHK_NULL_RETURN(m_roiDistinctDeltaQp);
 
+    m_tuStreaminParamsValid[0] = false;
+    m_tuStreaminParamsValid[1] = false;
+
     return MOS_STATUS_SUCCESS;
 }
 
@@ -263,13 +266,21 @@ void RoiStrategy::SetStreaminParamByTU(
 {
     MOS_ZeroMemory(&streaminDataParams, sizeof(streaminDataParams));
 
-    auto settings = static_cast<HevcVdencFeatureSettings *>(m_featureManager->GetFeatureSettings()->GetConstSettings());
-    ENCODE_CHK_NULL_NO_STATUS_RETURN(settings);
-
-    for (const auto &lambda : settings->vdencStreaminStateSettings)
+    uint32_t index = cu64Align ? 1 : 0;
+    if (!m_tuStreaminParamsValid[index])
     {
-        lambda(streaminDataParams, cu64Align);
+        auto settings = static_cast<HevcVdencFeatureSettings *>(m_featureManager->GetFeatureSettings()->GetConstSettings());
+        ENCODE_CHK_NULL_NO_STATUS_RETURN(settings);
+
+        MOS_ZeroMemory(&m_tuStreaminParams[index], sizeof(m_tuStreaminParams[index]));
+        for (const auto &lambda : settings->vdencStreaminStateSettings)
+        {
+            lambda(m_tuStreaminParams[index], cu64Align);
+        }
+        m_tuStreaminParamsValid[index] = true;
     }
+
+    streaminDataParams = m_tuStreaminParams[index];
 }
 
 void RoiStrategy::GetLCUsInRoiRegionForTile(
@@ -347,6 +358,11 @@ void RoiStrategy::GetLCUsInRoiRegion(
         return;
     }
 
+    if (bottom > top && right > left)
+    {
+        lcuVector.reserve(lcuVector.size() + (bottom - top) * (right - left));
+    }
+
     for (auto y = top; y < bottom; y++)
     {
         for (auto x = left; x < right; x++)
@@ -506,6 +506,11 @@ protected:
     bool     m_isTileModeEnabled  = false;
     uint32_t m_minCodingBlockSize = 0;
 
+    // The TU based streamin settings only depend on the target usage, so
+    // they are evaluated once per frame for each CU64 alignment.
+    StreamInParams m_tuStreaminParams[2]      = {};
+    bool           m_tuStreaminParamsValid[2] = {};
+
     EncodeAllocator *m_allocator    = nullptr;
     RecycleResource *m_recycle      = nullptr;
     HevcBasicFeature *m_basicFeature = nullptr;
@@ -0,0 +1,169 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     encode_hevc_vdenc_roi_streamin_params.h
+//! \brief    Defines the parameters ROI streamin data is generated from
+//!
+
+#ifndef __CODECHAL_HEVC_VDENC_ROI_STREAMIN_PARAMS_H__
+#define __CODECHAL_HEVC_VDENC_ROI_STREAMIN_PARAMS_H__
+
+#include <vector>
+#include "codec_def_encode_hevc.h"
+
+namespace encode
+{
+
+//!
+//! \struct   HevcVdencRoiStreaminParams
+//!
+//! \brief    Frame parameters the ROI and dirty ROI streamin data depends on.
+//!
+//! \detail   Saved when the streamin data is generated, a later frame that
+//!           matches them can reuse the streamin data instead of generating it.
+//!
+struct HevcVdencRoiStreaminParams
+{
+    //!
+    //! \brief    Check whether frame parameters match the saved ones
+    //!
+    //! \param    [in] frameWidth
+    //!           frame width
+    //! \param    [in] frameHeight
+    //!           frame height
+    //! \param    [in] oriFrameHeight
+    //!           original frame height
+    //! \param    [in] seqParams
+    //!           sequence parameters
+    //! \param    [in] picParams
+    //!           picture parameters
+    //! \param    [in] slcParams
+    //!           slice parameters
+    //! \param    [in] roiEnabled
+    //!           whether ROI is enabled
+    //! \param    [in] dirtyRoiEnabled
+    //!           whether dirty ROI is enabled
+    //! \return   bool
+    //!           true if all parameters match
+    //!
+    bool Matches(
+        uint32_t                                 frameWidth,
+        uint32_t                                 frameHeight,
+        uint32_t                                 oriFrameHeight,
+        const CODEC_HEVC_ENCODE_SEQUENCE_PARAMS &seqParams,
+        const CODEC_HEVC_ENCODE_PICTURE_PARAMS  &picParams,
+        const CODEC_HEVC_ENCODE_SLICE_PARAMS    &slcParams,
+        bool                                     roiEnabled,
+        bool                                     dirtyRoiEnabled) const
+    {
+        if (m_frameWidth != frameWidth ||
+            m_frameHeight != frameHeight ||
+            m_oriFrameHeight != oriFrameHeight ||
+            m_targetUsage != seqParams.TargetUsage ||
+            m_rateControlMethod != seqParams.RateControlMethod ||
+            m_qpY != picParams.QpY ||
+            m_sliceQpDelta != slcParams.slice_qp_delta ||
+            m_minCodingBlkSize != seqParams.log2_min_coding_block_size_minus3 ||
+            m_roiEnabled != roiEnabled ||
+            m_dirtyRoiEnabled != dirtyRoiEnabled)
+        {
+            return false;
+        }
+
+        return IsSameRegions(m_roiRegions, picParams.ROI, roiEnabled ? picParams.NumROI : 0) &&
+               IsSameRegions(m_dirtyRegions, picParams.pDirtyRect, dirtyRoiEnabled ? picParams.NumDirtyRects : 0);
+    }
+
+    //!
+    //! \brief    Save frame parameters, see Matches for the parameters
+    //!
+    void Save(
+        uint32_t                                 frameWidth,
+        uint32_t                                 frameHeight,
+        uint32_t                                 oriFrameHeight,
+        const CODEC_HEVC_ENCODE_SEQUENCE_PARAMS &seqParams,
+        const CODEC_HEVC_ENCODE_PICTURE_PARAMS  &picParams,
+        const CODEC_HEVC_ENCODE_SLICE_PARAMS    &slcParams,
+        bool                                     roiEnabled,
+        bool                                     dirtyRoiEnabled)
+    {
+        m_frameWidth        = frameWidth;
+        m_frameHeight       = frameHeight;
+        m_oriFrameHeight    = oriFrameHeight;
+        m_targetUsage       = seqParams.TargetUsage;
+        m_rateControlMethod = seqParams.RateControlMethod;
+        m_qpY               = picParams.QpY;
+        m_sliceQpDelta      = slcParams.slice_qp_delta;
+        m_minCodingBlkSize  = seqParams.log2_min_coding_block_size_minus3;
+        m_roiEnabled        = roiEnabled;
+        m_dirtyRoiEnabled   = dirtyRoiEnabled;
+
+        m_roiRegions.clear();
+        if (roiEnabled)
+        {
+            m_roiRegions.assign(picParams.ROI, picParams.ROI + picParams.NumROI);
+        }
+
+        m_dirtyRegions.clear();
+        if (dirtyRoiEnabled && picParams.pDirtyRect != nullptr)
+        {
+            m_dirtyRegions.assign(picParams.pDirtyRect, picParams.pDirtyRect + picParams.NumDirtyRects);
+        }
+    }
+
+protected:
+    static bool IsSameRegions(const std::vector<CODEC_ROI> &saved, const CODEC_ROI *regions, uint32_t num)
+    {
+        if (saved.size() != num || (num > 0 && regions == nullptr))
+        {
+            return false;
+        }
+        for (uint32_t i = 0; i < num; i++)
+        {
+            if (saved[i].Top != regions[i].Top ||
+                saved[i].Bottom != regions[i].Bottom ||
+                saved[i].Left != regions[i].Left ||
+                saved[i].Right != regions[i].Right ||
+                saved[i].PriorityLevelOrDQp != regions[i].PriorityLevelOrDQp)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    uint32_t               m_frameWidth        = 0;
+    uint32_t               m_frameHeight       = 0;
+    uint32_t               m_oriFrameHeight    = 0;
+    uint8_t                m_targetUsage       = 0;
+    uint8_t                m_rateControlMethod = 0;
+    int8_t                 m_qpY               = 0;
+    int8_t                 m_sliceQpDelta      = 0;
+    uint8_t                m_minCodingBlkSize  = 0;
+    bool                   m_roiEnabled        = false;
+    bool                   m_dirtyRoiEnabled   = false;
+    std::vector<CODEC_ROI> m_roiRegions;
+    std::vector<CODEC_ROI> m_dirtyRegions;
+};
+
+}  // namespace encode
+#endif  // __CODECHAL_HEVC_VDENC_ROI_STREAMIN_PARAMS_H__
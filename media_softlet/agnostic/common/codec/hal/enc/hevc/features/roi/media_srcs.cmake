@@ -45,6 +45,7 @@ set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/encode_hevc_vdenc_roi_forceqp.h
     ${CMAKE_CURRENT_LIST_DIR}/encode_hevc_vdenc_roi_qpmap.h
     ${CMAKE_CURRENT_LIST_DIR}/encode_hevc_vdenc_roi_forcedeltaqp.h
+    ${CMAKE_CURRENT_LIST_DIR}/encode_hevc_vdenc_roi_streamin_params.h
 )
 
 set(SOFTLET_ENCODE_HEVC_HEADERS_
@@ -31,10 +31,61 @@
 #include <array>
 #include <vector>
 #include <functional>
+#include <cstring>
+#include <type_traits>
 #include "media_feature_const_settings.h"
 #include "encode_utils.h"
 #include "mhw_vdbox_vdenc_cmdpar.h"
 
+//!
+//! \brief  Result of a settings lambda chain, reused while its inputs are unchanged
+//! \details Key holds every value the lambdas of the chain read besides the input
+//!         parameters, and must be plain data without padding. When the key and the
+//!         input parameters match the previous run, the previous output is copied
+//!         instead of running the chain again.
+//!
+template <typename Par, typename Key>
+class VdencSettingsSnapshot
+{
+public:
+    template <typename Settings, typename... Args>
+    MOS_STATUS Apply(const Settings &settings, const Key &key, Par &par, Args... args)
+    {
+        static_assert(std::is_trivially_copyable<Par>::value && std::is_trivially_copyable<Key>::value,
+            "settings snapshot only supports plain data");
+
+        if (m_valid &&
+            memcmp(&m_key, &key, sizeof(Key)) == 0 &&
+            memcmp(&m_input, &par, sizeof(Par)) == 0)
+        {
+            memcpy(&par, &m_output, sizeof(Par));
+            return MOS_STATUS_SUCCESS;
+        }
+
+        m_valid = false;
+        memcpy(&m_input, &par, sizeof(Par));
+
+        for (const auto &lambda : settings)
+        {
+            ENCODE_CHK_STATUS_RETURN(lambda(par, args...));
+        }
+
+        memcpy(&m_key, &key, sizeof(Key));
+        memcpy(&m_output, &par, sizeof(Par));
+        m_valid = true;
+
+        return MOS_STATUS_SUCCESS;
+    }
+
+    void Reset() { m_valid = false; }
+
+private:
+    Par  m_input  = {};
+    Par  m_output = {};
+    Key  m_key    = {};
+    bool m_valid  = false;
+};
+
 struct VdencFeatureSettings: MediaFeatureSettings
 {
     virtual ~VdencFeatureSettings(){};
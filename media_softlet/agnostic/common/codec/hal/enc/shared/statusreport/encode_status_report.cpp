@@ -47,6 +47,8 @@ namespace encode {
 
     EncoderStatusReport::EncoderStatusReport(
         EncodeAllocator *allocator, bool enableMfx, bool enableRcs, bool enablecp):
+        MediaStatusReport(CODECHAL_ENCODE_STATUS_NUM),
+        m_statusReportData(m_statusNum),
         m_enableMfx(enableMfx),
         m_enableRcs(enableRcs),
         m_enableCp(enablecp),
@@ -82,7 +84,7 @@ namespace encode {
 
         if (m_enableMfx)
         {
-            param.dwBytes  = m_statusBufSizeMfx * CODECHAL_ENCODE_STATUS_NUM;
+            param.dwBytes  = m_statusBufSizeMfx * m_statusNum;
             param.pBufName = "StatusQueryBufferMfx";
             // keeping status buffer persistent since its used in all command buffers
             param.bIsPersistent = true;
@@ -95,7 +97,7 @@ namespace encode {
 
         if (m_enableRcs)
         {
-            param.dwBytes  = m_statusBufSizeRcs * CODECHAL_ENCODE_STATUS_NUM;
+            param.dwBytes  = m_statusBufSizeRcs * m_statusNum;
             param.pBufName = "StatusQueryBufferRcs";
             // keeping status buffer persistent since its used in all command buffers
             param.bIsPersistent = true;
@@ -108,7 +110,7 @@ namespace encode {
 
         if (m_enableCp)  // && m_skipFrameBasedHWCounterRead == false)
         {
-            param.dwBytes       = sizeof(HwCounter) * CODECHAL_ENCODE_STATUS_NUM + sizeof(HwCounter);
+            param.dwBytes       = sizeof(HwCounter) * m_statusNum + sizeof(HwCounter);
             param.pBufName      = "HWCounterQueryBuffer";
             param.bIsPersistent = true;  // keeping status buffer persistent since its used in all command buffers
             m_hwcounterBuf      = m_allocator->AllocateResource(param, false);
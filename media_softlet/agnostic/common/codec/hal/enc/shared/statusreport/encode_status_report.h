@@ -396,7 +396,7 @@ namespace encode {
         }
 
     protected:
-        EncodeStatusReportData m_statusReportData[m_statusNum] = {};
+        std::vector<EncodeStatusReportData> m_statusReportData;
         bool                   m_enableMfx = false;
         bool                   m_enableRcs = false;
         bool                   m_enableCp  = false;
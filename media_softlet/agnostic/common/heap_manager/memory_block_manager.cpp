@@ -25,6 +25,8 @@
 //!
 
 #include "memory_block_manager.h"
+#include <algorithm>
+#include <initializer_list>
 
 MemoryBlockManager::~MemoryBlockManager()
 {
@@ -86,7 +88,11 @@ MOS_STATUS MemoryBlockManager::AcquireSpace(
     }
     if (m_sortedSizes.size() > 1)
     {
-        m_sortedSizes.sort([](SortedSizePair &a, SortedSizePair &b) { return a.m_blockSize > b.m_blockSize; });
+        // ties are ordered by original index to keep the order of a stable sort
+        std::sort(m_sortedSizes.begin(), m_sortedSizes.end(), [](const SortedSizePair &a, const SortedSizePair &b) {
+            return a.m_blockSize > b.m_blockSize ||
+                (a.m_blockSize == b.m_blockSize && a.m_originalIdx < b.m_originalIdx);
+        });
     }
 
     if (m_sortedBlockListNumEntries[MemoryBlockInternal::submitted] > m_numSubmissionsForRefresh)
@@ -174,8 +180,22 @@ MOS_STATUS MemoryBlockManager::RefreshBlockStates(bool &blocksUpdated)
         currTrackerId = *m_trackerData;
     }
 
+    // A block taken off its sorted list must be put back on every error path,
+    // blocks outside of all sorted lists are never visited again
+    auto relinkOnError = [this](MOS_STATUS status, std::initializer_list<MemoryBlockInternal *> blocks) {
+        for (auto relink : blocks)
+        {
+            if (relink != nullptr && relink->m_stateListType == MemoryBlockInternal::State::stateCount)
+            {
+                AddBlockToSortedList(relink, relink->GetState());
+            }
+        }
+        return status;
+    };
+
     auto block = m_sortedBlockList[MemoryBlockInternal::State::submitted];
     MemoryBlockInternal *nextSubmitted = nullptr;
+    MOS_STATUS           eStatus       = MOS_STATUS_SUCCESS;
     while (block != nullptr)
     {
         nextSubmitted = block->m_stateNext;
@@ -190,35 +210,54 @@ MOS_STATUS MemoryBlockManager::RefreshBlockStates(bool &blocksUpdated)
             {
                 // Add the block to deleted list instead of freed to prevent it from being reused
                 HEAP_CHK_STATUS(RemoveBlockFromSortedList(block, block->GetState()));
-                HEAP_CHK_STATUS(block->Delete());
+                eStatus = block->Delete();
+                if (eStatus != MOS_STATUS_SUCCESS)
+                {
+                    return relinkOnError(eStatus, {block});
+                }
                 HEAP_CHK_STATUS(AddBlockToSortedList(block, block->GetState()));
                 block = nextSubmitted;
                 continue;
             }
 
             HEAP_CHK_STATUS(RemoveBlockFromSortedList(block, block->GetState()));
-            HEAP_CHK_STATUS(block->Free());
-            HEAP_CHK_STATUS(AddBlockToSortedList(block, block->GetState()));
+            eStatus = block->Free();
+            if (eStatus != MOS_STATUS_SUCCESS)
+            {
+                return relinkOnError(eStatus, {block});
+            }
 
-            // Consolidate free blocks
+            // Consolidate free blocks before inserting into the sorted free list,
+            // so the list is walked once per released block instead of once per merge
             auto prev = block->GetPrev(), next = block->GetNext();
             if (prev && prev->GetState() == MemoryBlockInternal::State::free)
             {
-                HEAP_CHK_STATUS(MergeBlocks(prev, block));
+                eStatus = MergeBlocks(prev, block);
+                if (eStatus != MOS_STATUS_SUCCESS)
+                {
+                    return relinkOnError(eStatus, {prev, block});
+                }
                 // re-assign block to pPrev for use in MergeBlocks with pNext
                 block = prev;
             }
             else if (prev == nullptr)
             {
                 HEAP_ASSERTMESSAGE("The previous block should always be valid");
-                return MOS_STATUS_UNKNOWN;
+                // Put the freed block back, it is not in any sorted list at this point
+                return relinkOnError(MOS_STATUS_UNKNOWN, {block});
             }
 
             if (next && next->GetState() == MemoryBlockInternal::State::free)
             {
-                HEAP_CHK_STATUS(MergeBlocks(block, next));
+                eStatus = MergeBlocks(block, next);
+                if (eStatus != MOS_STATUS_SUCCESS)
+                {
+                    return relinkOnError(eStatus, {block, next});
+                }
             }
 
+            HEAP_CHK_STATUS(AddBlockToSortedList(block, block->GetState()));
+
             blocksUpdated = true;
         }
         block = nextSubmitted;
@@ -834,11 +873,16 @@ MOS_STATUS MemoryBlockManager::MergeBlocks(
         return MOS_STATUS_INVALID_PARAMETER;
     }
 
-    HEAP_CHK_STATUS(RemoveBlockFromSortedList(blockCombined, blockCombined->GetState()));
-    HEAP_CHK_STATUS(RemoveBlockFromSortedList(blockRelease, blockRelease->GetState()));
+    if (blockCombined->m_stateListType != MemoryBlockInternal::State::stateCount)
+    {
+        HEAP_CHK_STATUS(RemoveBlockFromSortedList(blockCombined, blockCombined->GetState()));
+    }
+    if (blockRelease->m_stateListType != MemoryBlockInternal::State::stateCount)
+    {
+        HEAP_CHK_STATUS(RemoveBlockFromSortedList(blockRelease, blockRelease->GetState()));
+    }
     HEAP_CHK_STATUS(blockCombined->Combine(blockRelease));
     HEAP_CHK_STATUS(AddBlockToSortedList(blockRelease, blockRelease->GetState()));
-    HEAP_CHK_STATUS(AddBlockToSortedList(blockCombined, blockCombined->GetState()));
 
     return MOS_STATUS_SUCCESS;
 }
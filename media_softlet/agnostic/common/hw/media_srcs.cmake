@@ -51,6 +51,7 @@ set(TMP_SOURCES_
     ${CMAKE_CURRENT_LIST_DIR}/mhw_memory_pool.c
     ${CMAKE_CURRENT_LIST_DIR}/mhw_blt.cpp
     ${CMAKE_CURRENT_LIST_DIR}/mhw_utilities_next.cpp  
+    ${CMAKE_CURRENT_LIST_DIR}/mhw_utilities_polyphase_next.cpp
 )
 
 set(SOFTLET_COMMON_SOURCES_
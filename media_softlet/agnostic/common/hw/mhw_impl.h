@@ -28,6 +28,9 @@
 #ifndef __MHW_IMPL_H__
 #define __MHW_IMPL_H__
 
+#include <cstring>
+#include <memory>
+#include <type_traits>
 #include "mhw_itf.h"
 #include "mhw_utilities.h"
 #include "media_class_trace.h"
@@ -64,6 +67,11 @@
 #define MHW_HWCMDPARSER_INITCMDNAME(CMD)
 #endif
 
+// Last parameters the MHW command was built from, see mhw::CmdTemplateEnabled
+#define __MHW_CMDTEMPLATE_T(CMD) mhw::CmdTemplate<_MHW_PAR_T(CMD)>
+
+#define __MHW_CMDTEMPLATE_M(CMD) m_##CMD##_Template
+
 #define __MHW_ADDCMD_DEF(CMD)                                             \
     __MHW_ADDCMD_DECL(CMD) override                                       \
     {                                                                     \
@@ -72,7 +80,9 @@
         return this->AddCmd(cmdBuf,                                       \
             batchBuf,                                                     \
             this->__MHW_CMDINFO_M(CMD)->second,                           \
-            [=]() -> MOS_STATUS { return this->__MHW_SETCMD_F(CMD)(); }); \
+            [=]() -> MOS_STATUS { return this->__MHW_SETCMD_F(CMD)(); },  \
+            this->__MHW_CMDINFO_M(CMD)->first,                            \
+            this->__MHW_CMDTEMPLATE_M(CMD));                              \
     }
 
 #if __cplusplus < 201402L
@@ -83,13 +93,23 @@
     __MHW_CMDINFO_M(CMD) = std::make_unique<__MHW_CMDINFO_T(CMD)>()
 #endif
 
+#define __MHW_CMDTEMPLATE_DEF(CMD) std::unique_ptr<__MHW_CMDTEMPLATE_T(CMD)> __MHW_CMDTEMPLATE_M(CMD)
+
 #define _MHW_CMD_ALL_DEF_FOR_IMPL(CMD) \
 public:                                \
     __MHW_GETPAR_DEF(CMD);             \
     __MHW_GETSIZE_DEF(CMD);            \
     __MHW_ADDCMD_DEF(CMD)              \
 protected:                             \
-    __MHW_CMDINFO_DEF(CMD)
+    __MHW_CMDINFO_DEF(CMD);            \
+    __MHW_CMDTEMPLATE_DEF(CMD)
+
+// Opt a command in to template reuse, must be used in namespace mhw before the impl class is defined
+#define _MHW_CMD_TEMPLATE_ENABLE(PAR)               \
+    template <>                                     \
+    struct CmdTemplateEnabled<PAR> : std::true_type \
+    {                                               \
+    }
 
 #define _MHW_SETCMD_OVERRIDE_DECL(CMD) __MHW_SETCMD_DECL(CMD) override
 
@@ -108,6 +128,24 @@ protected:                             \
 
 namespace mhw
 {
+//!
+//! \brief  Whether a command may be re-emitted from its previously built bytes
+//! \details Only commands whose SETCMD is a pure function of plain-old-data parameters
+//!         (no resources, no pointers, no side effects) may be enabled with
+//!         _MHW_CMD_TEMPLATE_ENABLE.
+//!
+template <typename Par>
+struct CmdTemplateEnabled : std::false_type
+{
+};
+
+template <typename Par>
+struct CmdTemplate
+{
+    Par  params = {};
+    bool valid  = false;
+};
+
 class Impl
 {
 protected:
@@ -255,6 +293,68 @@ protected:
         return Mhw_AddCommandCmdOrBB(cmdBuf, batchBuf, &cmd, sizeof(cmd));
     }
 
+    template <typename Cmd, typename CmdSetting, typename Par,
+        typename std::enable_if<!CmdTemplateEnabled<Par>::value, bool>::type = true>
+    MOS_STATUS AddCmd(PMOS_COMMAND_BUFFER cmdBuf,
+        PMHW_BATCH_BUFFER                 batchBuf,
+        Cmd &                             cmd,
+        const CmdSetting &                setting,
+        const Par &,
+        std::unique_ptr<CmdTemplate<Par>> &)
+    {
+        return AddCmd(cmdBuf, batchBuf, cmd, setting);
+    }
+
+    //!
+    //! \brief  Add command, reusing the command bytes built on the previous call
+    //! \details When the parameters are bytewise identical to the ones the current
+    //!         command data was built from, setting the command is skipped and the
+    //!         previous data is emitted as-is. Consecutive frames of a sequence
+    //!         mostly hit this path for picture-level state.
+    //!
+    template <typename Cmd, typename CmdSetting, typename Par,
+        typename std::enable_if<CmdTemplateEnabled<Par>::value, bool>::type = true>
+    MOS_STATUS AddCmd(PMOS_COMMAND_BUFFER cmdBuf,
+        PMHW_BATCH_BUFFER                 batchBuf,
+        Cmd &                             cmd,
+        const CmdSetting &                setting,
+        const Par &                       params,
+        std::unique_ptr<CmdTemplate<Par>> &cmdTemplate)
+    {
+        static_assert(std::is_trivially_copyable<Par>::value, "command template parameters must be plain data");
+
+        if (cmdTemplate == nullptr)
+        {
+            cmdTemplate.reset(new CmdTemplate<Par>());
+        }
+
+        if (cmdTemplate->valid && memcmp(&cmdTemplate->params, &params, sizeof(Par)) == 0)
+        {
+            this->m_currentCmdBuf   = cmdBuf;
+            this->m_currentBatchBuf = batchBuf;
+
+        #if MHW_HWCMDPARSER_ENABLED
+            auto instance = mhw::HwcmdParser::GetInstance();
+            if (instance)
+            {
+                instance->ParseCmd(this->m_currentCmdName,
+                    reinterpret_cast<uint32_t *>(&cmd),
+                    sizeof(cmd) / sizeof(uint32_t));
+            }
+        #endif
+
+            return Mhw_AddCommandCmdOrBB(cmdBuf, batchBuf, &cmd, sizeof(cmd));
+        }
+
+        // cmd may be partially set if setting fails, so only record parameters after success
+        cmdTemplate->valid = false;
+        MHW_CHK_STATUS_RETURN(AddCmd(cmdBuf, batchBuf, cmd, setting));
+        cmdTemplate->params = params;
+        cmdTemplate->valid  = true;
+
+        return MOS_STATUS_SUCCESS;
+    }
+
 protected:
     MOS_STATUS(*AddResourceToCmd)
     (PMOS_INTERFACE osItf, PMOS_COMMAND_BUFFER cmdBuf, PMHW_RESOURCE_PARAMS params) = nullptr;
@@ -618,351 +618,6 @@ MOS_STATUS Mhw_SetNearestModeTable(
     return eStatus;
 }
 
-//!
-//! \brief      Calculate Polyphase tables for Y , across SFC and Render engine to set the sampler states
-//! \details    Calculate Polyphase tables for Y
-//!             This function uses 17 phases.
-//!             MHW_NUM_HW_POLYPHASE_TABLES reflects the phases to program coefficients in HW, and
-//!             NUM_POLYPHASE_TABLES reflects the number of phases used for internal calculations.
-//! \param      int32_t*   iCoefs
-//!             [out]   Polyphase Table to fill
-//! \param      float   fScaleFactor
-//!             [in]    Scaling factor
-//! \param      uint32_t   dwPlane
-//!             [in]    Plane Info
-//! \param      MOS_FORMAT srcFmt
-//!             [in]    Source Format
-//! \param      float   fHPStrength
-//!             [in]    High Pass Strength
-//! \param      bool    bUse8x8Filter
-//!             [in]    is 8x8 Filter used
-//! \param      uint32_t   dwHwPhase
-//!             [in]    Number of phases in HW
-//! \param      float      fLanczosT
-//!             [in]    Lanczos factor
-//! \return   MOS_STATUS
-//!           MOS_STATUS_SUCCESS if success, else fail reason
-//!
-MOS_STATUS Mhw_CalcPolyphaseTablesY(
-    int32_t         *iCoefs,
-    float           fScaleFactor,
-    uint32_t        dwPlane,
-    MOS_FORMAT      srcFmt,
-    float           fHPStrength,
-    bool            bUse8x8Filter,
-    uint32_t        dwHwPhase,
-    float           fLanczosT)
-{
-    uint32_t                dwNumEntries;
-    uint32_t                dwTableCoefUnit;
-    uint32_t                i, j;
-    int32_t                 k;
-    MOS_STATUS              eStatus = MOS_STATUS_SUCCESS;
-    float                   fPhaseCoefs[NUM_POLYPHASE_Y_ENTRIES];
-    float                   fPhaseCoefsCopy[NUM_POLYPHASE_Y_ENTRIES];
-    float                   fStartOffset;
-    float                   fHPFilter[3], fHPSum, fHPHalfPhase; // Only used for Y_PLANE
-    float                   fBase, fPos, fSumCoefs;
-    int32_t                 iCenterPixel;
-    int32_t                 iSumQuantCoefs;
-
-    MHW_FUNCTION_ENTER;
-
-    MHW_CHK_NULL_RETURN(iCoefs);
-    MHW_ASSERT((dwHwPhase == MHW_NUM_HW_POLYPHASE_TABLES) || (dwHwPhase == NUM_HW_POLYPHASE_TABLES));
-
-    if (dwPlane == MHW_GENERIC_PLANE || dwPlane == MHW_Y_PLANE)
-    {
-        dwNumEntries = NUM_POLYPHASE_Y_ENTRIES;
-    }
-    else // if (dwPlane == MHW_U_PLANE || dwPlane == MHW_V_PLANE)
-    {
-        dwNumEntries = NUM_POLYPHASE_UV_ENTRIES;
-    }
-
-    MOS_ZeroMemory(fPhaseCoefs    , sizeof(fPhaseCoefs));
-    MOS_ZeroMemory(fPhaseCoefsCopy, sizeof(fPhaseCoefsCopy));
-
-    dwTableCoefUnit = 1 << MHW_AVS_TBL_COEF_PREC;
-    iCenterPixel = dwNumEntries / 2 - 1;
-    fStartOffset = (float)(-iCenterPixel);
-
-    if ((IS_YUV_FORMAT(srcFmt)    &&
-        dwPlane != MHW_U_PLANE    &&
-        dwPlane != MHW_V_PLANE)   ||
-        ((IS_RGB32_FORMAT(srcFmt) ||
-        srcFmt == Format_Y410     ||
-        srcFmt == Format_AYUV)    &&
-        dwPlane == MHW_Y_PLANE))
-    {
-        if (fScaleFactor < 1.0F)
-        {
-            fLanczosT = 4.0F;
-        }
-        else
-        {
-            fLanczosT = 8.0F;
-        }
-    }
-    else // if (dwPlane == MHW_U_PLANE || dwPlane == MHW_V_PLANE || (IS_RGB_FORMAT(srcFmt) && dwPlane != MHW_V_PLANE))
-    {
-        fLanczosT = 2.0F;
-    }
-
-    for (i = 0; i < dwHwPhase; i++)
-    {
-        fBase = fStartOffset - (float)i / (float)NUM_POLYPHASE_TABLES;
-        fSumCoefs = 0.0F;
-
-        for (j = 0; j < dwNumEntries; j++)
-        {
-            fPos = fBase + (float)j;
-
-            if (bUse8x8Filter)
-            {
-                fPhaseCoefs[j] = fPhaseCoefsCopy[j] = MosUtilities::MosLanczos(fPos * fScaleFactor, dwNumEntries, fLanczosT);
-            }
-            else
-            {
-                fPhaseCoefs[j] = fPhaseCoefsCopy[j] = MosUtilities::MosLanczosG(fPos * fScaleFactor, NUM_POLYPHASE_5x5_Y_ENTRIES, fLanczosT);
-            }
-
-            fSumCoefs += fPhaseCoefs[j];
-        }
-
-        // Convolve with HP
-        if (dwPlane == MHW_GENERIC_PLANE || dwPlane == MHW_Y_PLANE)
-        {
-            if (i <= NUM_POLYPHASE_TABLES / 2)
-            {
-                fHPHalfPhase = (float)i / (float)NUM_POLYPHASE_TABLES;
-            }
-            else
-            {
-                fHPHalfPhase = (float)(NUM_POLYPHASE_TABLES - i) / (float)NUM_POLYPHASE_TABLES;
-            }
-            fHPFilter[0] = fHPFilter[2] = -fHPStrength * MosUtilities::MosSinc(fHPHalfPhase * MOS_PI);
-            fHPFilter[1] = 1.0F + 2.0F * fHPStrength;
-
-            for (j = 0; j < dwNumEntries; j++)
-            {
-                fHPSum = 0.0F;
-                for (k = -1; k <= 1; k++)
-                {
-                    if ((((long)j + k) >= 0) && (j + k < dwNumEntries))
-                    {
-                        fHPSum += fPhaseCoefsCopy[(int32_t)j+k] * fHPFilter[k+1];
-                    }
-                    fPhaseCoefs[j] = fHPSum;
-                }
-            }
-        }
-
-        // Normalize coefs and save
-        iSumQuantCoefs = 0;
-        for (j = 0; j < dwNumEntries; j++)
-        {
-            iCoefs[i * dwNumEntries + j] = (int32_t)floor(0.5F + (float)dwTableCoefUnit * fPhaseCoefs[j] / fSumCoefs);
-            iSumQuantCoefs += iCoefs[i * dwNumEntries + j];
-        }
-
-        // Fix center coef so that filter is balanced
-        if (i <= NUM_POLYPHASE_TABLES / 2)
-        {
-            iCoefs[i * dwNumEntries + iCenterPixel] -= iSumQuantCoefs - dwTableCoefUnit;
-        }
-        else
-        {
-            iCoefs[i * dwNumEntries + iCenterPixel + 1] -= iSumQuantCoefs - dwTableCoefUnit;
-        }
-    }
-
-    return eStatus;
-}
-
-//!
-//! \brief      Calculate Polyphase tables for UV for Gen9, across SFC and Render engine to set the sampler states
-//! \details    Calculate Polyphase tables for UV
-//! \param      int32_t*   piCoefs
-//!             [out]   Polyphase Table to fill
-//! \param      float   fLanczosT
-//!             [in]    Lanczos modifying factor
-//! \param      float   fInverseScaleFactor
-//!             [in]    Inverse scaling factor
-//! \return   MOS_STATUS
-//!           MOS_STATUS_SUCCESS if success, else fail reason
-//!
-MOS_STATUS Mhw_CalcPolyphaseTablesUV(
-    int32_t    *piCoefs,
-    float      fLanczosT,
-    float      fInverseScaleFactor)
-{
-    int32_t     phaseCount, tableCoefUnit, centerPixel, sumQuantCoefs;
-    double      phaseCoefs[MHW_SCALER_UV_WIN_SIZE];
-    double      startOffset, sf, base, sumCoefs, pos;
-    int32_t     minCoef[MHW_SCALER_UV_WIN_SIZE];
-    int32_t     maxCoef[MHW_SCALER_UV_WIN_SIZE];
-    int32_t     i, j;
-    MOS_STATUS              eStatus = MOS_STATUS_SUCCESS;
-
-    MHW_FUNCTION_ENTER;
-
-    MHW_CHK_NULL_RETURN(piCoefs);
-
-    phaseCount      = MHW_TABLE_PHASE_COUNT;
-    centerPixel     = (MHW_SCALER_UV_WIN_SIZE / 2) - 1;
-    startOffset     = (double)(-centerPixel);
-    tableCoefUnit   = 1 << MHW_TBL_COEF_PREC;
-    sf              = MOS_MIN(1.0, fInverseScaleFactor); // Sf isn't used for upscaling
-
-    MOS_ZeroMemory(piCoefs, sizeof(int32_t) * MHW_SCALER_UV_WIN_SIZE * phaseCount);
-    MOS_ZeroMemory(minCoef, sizeof(minCoef));
-    MOS_ZeroMemory(maxCoef, sizeof(maxCoef));
-
-    if (sf < 1.0F)
-    {
-        fLanczosT = 2.0F;
-    }
-
-    for(i = 0; i < phaseCount; ++i, piCoefs += MHW_SCALER_UV_WIN_SIZE)
-    {
-        // Write all
-        // Note - to shift by a half you need to a half to each phase.
-        base     = startOffset - (double)(i) / (double)(phaseCount);
-        sumCoefs = 0.0;
-
-        for(j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
-        {
-            pos             = base + (double) j;
-            phaseCoefs[j]   = MosUtilities::MosLanczos((float)(pos * sf), MHW_SCALER_UV_WIN_SIZE, fLanczosT);
-            sumCoefs        += phaseCoefs[j];
-        }
-        // Normalize coefs and save
-        for(j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
-        {
-            piCoefs[j] = (int32_t) floor((0.5 + (double)(tableCoefUnit) * (phaseCoefs[j] / sumCoefs)));
-
-            //For debug purposes:
-            minCoef[j] = MOS_MIN(minCoef[j], piCoefs[j]);
-            maxCoef[j] = MOS_MAX(maxCoef[j], piCoefs[j]);
-        }
-
-        // Recalc center coef
-        sumQuantCoefs = 0;
-        for(j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
-        {
-            sumQuantCoefs += piCoefs[j];
-        }
-
-        // Fix center coef so that filter is balanced
-        if (i <= phaseCount/2)
-        {
-            piCoefs[centerPixel]     -= sumQuantCoefs - tableCoefUnit;
-        }
-        else
-        {
-            piCoefs[centerPixel + 1] -= sumQuantCoefs - tableCoefUnit;
-        }
-    }
-
-    return eStatus;
-}
-
-//!
-//! \brief      Calculate polyphase tables UV offset for Gen9, across SFC and Render engine to set the sampler states
-//! \details    Calculate Polyphase tables for UV with chroma siting for
-//!             420 to 444 conversion
-//! \param      int32_t*   piCoefs
-//!             [out]   Polyphase Table to fill
-//! \param      float   fLanczosT
-//!             [in]    Lanczos modifying factor
-//! \param      float   fInverseScaleFactor
-//!             [in]    Inverse scaling factor
-//! \param      int32_t     iUvPhaseOffset
-//!             [in]    UV Phase Offset
-//! \return   MOS_STATUS
-//!           MOS_STATUS_SUCCESS if success, else fail reason
-//!
-MOS_STATUS Mhw_CalcPolyphaseTablesUVOffset(
-    int32_t     *piCoefs,
-    float       fLanczosT,
-    float       fInverseScaleFactor,
-    int32_t     iUvPhaseOffset)
-{
-    int32_t     phaseCount, tableCoefUnit, centerPixel, sumQuantCoefs;
-    double      phaseCoefs[MHW_SCALER_UV_WIN_SIZE];
-    double      startOffset, sf, pos, sumCoefs, base;
-    int32_t     minCoef[MHW_SCALER_UV_WIN_SIZE];
-    int32_t     maxCoef[MHW_SCALER_UV_WIN_SIZE];
-    int32_t     i, j;
-    int32_t     adjusted_phase;
-    MOS_STATUS              eStatus = MOS_STATUS_SUCCESS;
-
-    MHW_FUNCTION_ENTER;
-
-    MHW_CHK_NULL_RETURN(piCoefs);
-
-    phaseCount = MHW_TABLE_PHASE_COUNT;
-    centerPixel = (MHW_SCALER_UV_WIN_SIZE / 2) - 1;
-    startOffset = (double)(-centerPixel +
-        (double)iUvPhaseOffset / (double)(phaseCount));
-    tableCoefUnit = 1 << MHW_TBL_COEF_PREC;
-
-    MOS_ZeroMemory(minCoef, sizeof(minCoef));
-    MOS_ZeroMemory(maxCoef, sizeof(maxCoef));
-    MOS_ZeroMemory(piCoefs, sizeof(int32_t)* MHW_SCALER_UV_WIN_SIZE * phaseCount);
-
-    sf = MOS_MIN(1.0, fInverseScaleFactor); // Sf isn't used for upscaling
-    if (sf < 1.0)
-    {
-        fLanczosT = 3.0;
-    }
-
-    for (i = 0; i < phaseCount; ++i, piCoefs += MHW_SCALER_UV_WIN_SIZE)
-    {
-        // Write all
-        // Note - to shift by a half you need to a half to each phase.
-        base = startOffset - (double)(i) / (double)(phaseCount);
-        sumCoefs = 0.0;
-
-        for (j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
-        {
-            pos = base + (double)j;
-            phaseCoefs[j] = MosUtilities::MosLanczos((float)(pos * sf), 6/*MHW_SCALER_UV_WIN_SIZE*/, fLanczosT);
-            sumCoefs += phaseCoefs[j];
-        }
-        // Normalize coefs and save
-        for (j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
-        {
-            piCoefs[j] = (int32_t)floor((0.5 + (double)(tableCoefUnit)* (phaseCoefs[j] / sumCoefs)));
-
-            // For debug purposes:
-            minCoef[j] = MOS_MIN(minCoef[j], piCoefs[j]);
-            maxCoef[j] = MOS_MAX(maxCoef[j], piCoefs[j]);
-        }
-
-        // Recalc center coef
-        sumQuantCoefs = 0;
-        for (j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
-        {
-            sumQuantCoefs += piCoefs[j];
-        }
-
-        // Fix center coef so that filter is balanced
-        adjusted_phase = i - iUvPhaseOffset;
-        if (adjusted_phase <= phaseCount / 2)
-        {
-            piCoefs[centerPixel] -= sumQuantCoefs - tableCoefUnit;
-        }
-        else // if(adjusted_phase < phaseCount)
-        {
-            piCoefs[centerPixel + 1] -= sumQuantCoefs - tableCoefUnit;
-        }
-    }
-
-    return eStatus;
-}
-
 //!
 //! \brief    Allocate BB
 //! \details  Allocated Batch Buffer
@@ -698,6 +698,8 @@ MOS_STATUS Mhw_CalcPolyphaseTablesUVOffset(
     float       fInverseScaleFactor,
     int32_t     iUvPhaseOffset);
 
+void Mhw_ClearPolyphaseCache();
+
 MOS_STATUS Mhw_AllocateBb(
     PMOS_INTERFACE          pOsInterface,
     PMHW_BATCH_BUFFER       pBatchBuffer,
@@ -0,0 +1,548 @@
+/*
+* Copyright (c) 2014-2022, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file      mhw_utilities_polyphase_next.cpp
+//! \brief         Polyphase filter tables shared by SFC and render engine scaling, and their cache.
+//!
+
+#include <math.h>
+#include <cstring>
+#include <mutex>
+#include "mhw_utilities_next.h"
+#include "mhw_state_heap.h"
+
+#define MHW_POLYPHASE_CACHE_ENTRIES     32                                                  // Number of cached polyphase tables
+#define MHW_POLYPHASE_CACHE_MAX_COEFS   (NUM_HW_POLYPHASE_TABLES * NUM_POLYPHASE_Y_ENTRIES) // Max coefficients per table
+
+//!
+//! \brief    Polyphase table type, part of the polyphase cache key
+//!
+enum MHW_POLYPHASE_TABLE_TYPE
+{
+    MHW_POLYPHASE_TABLE_Y = 0,
+    MHW_POLYPHASE_TABLE_UV,
+    MHW_POLYPHASE_TABLE_UV_OFFSET
+};
+
+//!
+//! \brief    Inputs that fully determine a polyphase table (compared bitwise)
+//!
+typedef struct _MHW_POLYPHASE_CACHE_KEY
+{
+    uint32_t    dwTableType;
+    uint32_t    dwPlane;
+    uint32_t    dwHwPhase;
+    uint32_t    dwUse8x8Filter;
+    float       fScaleFactor;
+    float       fLanczosT;
+    float       fHPStrength;
+    int32_t     iUvPhaseOffset;
+} MHW_POLYPHASE_CACHE_KEY;
+
+typedef struct _MHW_POLYPHASE_CACHE_ENTRY
+{
+    MHW_POLYPHASE_CACHE_KEY Key;
+    uint32_t                dwCoefCount;                            // 0 if entry is unused
+    uint32_t                dwLastUsed;                             // For LRU replacement
+    int32_t                 iCoefs[MHW_POLYPHASE_CACHE_MAX_COEFS];
+} MHW_POLYPHASE_CACHE_ENTRY;
+
+// Process-wide cache: SFC/AVS states are reprogrammed every frame, usually with a few distinct scaling factors
+static MHW_POLYPHASE_CACHE_ENTRY g_polyphaseCache[MHW_POLYPHASE_CACHE_ENTRIES] = {};
+static uint32_t                  g_polyphaseCacheClock                         = 0;
+static std::mutex                g_polyphaseCacheMutex;
+
+//!
+//! \brief    Get polyphase table from cache
+//! \param    const MHW_POLYPHASE_CACHE_KEY &key
+//!           [in] Table inputs
+//! \param    int32_t *piCoefs
+//!           [out] Polyphase table to fill
+//! \param    uint32_t dwCoefCount
+//!           [in] Number of coefficients in the table
+//! \return   bool
+//!           true if the table was found in cache
+//!
+static bool Mhw_GetCachedPolyphaseTable(
+    const MHW_POLYPHASE_CACHE_KEY &key,
+    int32_t                       *piCoefs,
+    uint32_t                      dwCoefCount)
+{
+    std::lock_guard<std::mutex> lock(g_polyphaseCacheMutex);
+
+    for (uint32_t i = 0; i < MHW_POLYPHASE_CACHE_ENTRIES; i++)
+    {
+        MHW_POLYPHASE_CACHE_ENTRY &entry = g_polyphaseCache[i];
+        if (entry.dwCoefCount == dwCoefCount &&
+            memcmp(&entry.Key, &key, sizeof(key)) == 0)
+        {
+            entry.dwLastUsed = ++g_polyphaseCacheClock;
+            MOS_SecureMemcpy(piCoefs, dwCoefCount * sizeof(int32_t), entry.iCoefs, dwCoefCount * sizeof(int32_t));
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//!
+//! \brief    Add polyphase table to cache, replacing the least recently used table
+//! \param    const MHW_POLYPHASE_CACHE_KEY &key
+//!           [in] Table inputs
+//! \param    const int32_t *piCoefs
+//!           [in] Polyphase table
+//! \param    uint32_t dwCoefCount
+//!           [in] Number of coefficients in the table
+//! \return   void
+//!
+static void Mhw_CachePolyphaseTable(
+    const MHW_POLYPHASE_CACHE_KEY &key,
+    const int32_t                 *piCoefs,
+    uint32_t                      dwCoefCount)
+{
+    std::lock_guard<std::mutex> lock(g_polyphaseCacheMutex);
+
+    MHW_POLYPHASE_CACHE_ENTRY *victim = &g_polyphaseCache[0];
+    for (uint32_t i = 0; i < MHW_POLYPHASE_CACHE_ENTRIES; i++)
+    {
+        MHW_POLYPHASE_CACHE_ENTRY &entry = g_polyphaseCache[i];
+        if (entry.dwCoefCount == 0)
+        {
+            victim = &entry;
+            break;
+        }
+        if ((int32_t)(entry.dwLastUsed - victim->dwLastUsed) < 0)
+        {
+            victim = &entry;
+        }
+    }
+
+    victim->Key         = key;
+    victim->dwCoefCount = dwCoefCount;
+    victim->dwLastUsed  = ++g_polyphaseCacheClock;
+    MOS_SecureMemcpy(victim->iCoefs, sizeof(victim->iCoefs), piCoefs, dwCoefCount * sizeof(int32_t));
+}
+
+//!
+//! \brief    Drop all cached polyphase tables
+//! \return   void
+//!
+void Mhw_ClearPolyphaseCache()
+{
+    std::lock_guard<std::mutex> lock(g_polyphaseCacheMutex);
+
+    MOS_ZeroMemory(g_polyphaseCache, sizeof(g_polyphaseCache));
+    g_polyphaseCacheClock = 0;
+}
+
+//!
+//! \brief      Calculate Polyphase tables for Y , across SFC and Render engine to set the sampler states
+//! \details    Calculate Polyphase tables for Y
+//!             This function uses 17 phases.
+//!             MHW_NUM_HW_POLYPHASE_TABLES reflects the phases to program coefficients in HW, and
+//!             NUM_POLYPHASE_TABLES reflects the number of phases used for internal calculations.
+//! \param      int32_t*   iCoefs
+//!             [out]   Polyphase Table to fill
+//! \param      float   fScaleFactor
+//!             [in]    Scaling factor
+//! \param      uint32_t   dwPlane
+//!             [in]    Plane Info
+//! \param      MOS_FORMAT srcFmt
+//!             [in]    Source Format
+//! \param      float   fHPStrength
+//!             [in]    High Pass Strength
+//! \param      bool    bUse8x8Filter
+//!             [in]    is 8x8 Filter used
+//! \param      uint32_t   dwHwPhase
+//!             [in]    Number of phases in HW
+//! \param      float      fLanczosT
+//!             [in]    Lanczos factor
+//! \return   MOS_STATUS
+//!           MOS_STATUS_SUCCESS if success, else fail reason
+//!
+MOS_STATUS Mhw_CalcPolyphaseTablesY(
+    int32_t         *iCoefs,
+    float           fScaleFactor,
+    uint32_t        dwPlane,
+    MOS_FORMAT      srcFmt,
+    float           fHPStrength,
+    bool            bUse8x8Filter,
+    uint32_t        dwHwPhase,
+    float           fLanczosT)
+{
+    uint32_t                dwNumEntries;
+    uint32_t                dwTableCoefUnit;
+    uint32_t                i, j;
+    int32_t                 k;
+    MOS_STATUS              eStatus = MOS_STATUS_SUCCESS;
+    float                   fPhaseCoefs[NUM_POLYPHASE_Y_ENTRIES];
+    float                   fPhaseCoefsCopy[NUM_POLYPHASE_Y_ENTRIES];
+    float                   fStartOffset;
+    float                   fHPFilter[3], fHPSum, fHPHalfPhase; // Only used for Y_PLANE
+    float                   fBase, fPos, fSumCoefs;
+    int32_t                 iCenterPixel;
+    int32_t                 iSumQuantCoefs;
+
+    MHW_FUNCTION_ENTER;
+
+    MHW_CHK_NULL_RETURN(iCoefs);
+    MHW_ASSERT((dwHwPhase == MHW_NUM_HW_POLYPHASE_TABLES) || (dwHwPhase == NUM_HW_POLYPHASE_TABLES));
+
+    if (dwPlane == MHW_GENERIC_PLANE || dwPlane == MHW_Y_PLANE)
+    {
+        dwNumEntries = NUM_POLYPHASE_Y_ENTRIES;
+    }
+    else // if (dwPlane == MHW_U_PLANE || dwPlane == MHW_V_PLANE)
+    {
+        dwNumEntries = NUM_POLYPHASE_UV_ENTRIES;
+    }
+
+    MOS_ZeroMemory(fPhaseCoefs    , sizeof(fPhaseCoefs));
+    MOS_ZeroMemory(fPhaseCoefsCopy, sizeof(fPhaseCoefsCopy));
+
+    dwTableCoefUnit = 1 << MHW_AVS_TBL_COEF_PREC;
+    iCenterPixel = dwNumEntries / 2 - 1;
+    fStartOffset = (float)(-iCenterPixel);
+
+    if ((IS_YUV_FORMAT(srcFmt)    &&
+        dwPlane != MHW_U_PLANE    &&
+        dwPlane != MHW_V_PLANE)   ||
+        ((IS_RGB32_FORMAT(srcFmt) ||
+        srcFmt == Format_Y410     ||
+        srcFmt == Format_AYUV)    &&
+        dwPlane == MHW_Y_PLANE))
+    {
+        if (fScaleFactor < 1.0F)
+        {
+            fLanczosT = 4.0F;
+        }
+        else
+        {
+            fLanczosT = 8.0F;
+        }
+    }
+    else // if (dwPlane == MHW_U_PLANE || dwPlane == MHW_V_PLANE || (IS_RGB_FORMAT(srcFmt) && dwPlane != MHW_V_PLANE))
+    {
+        fLanczosT = 2.0F;
+    }
+
+    MHW_POLYPHASE_CACHE_KEY cacheKey = {};
+    uint32_t                coefCount = dwHwPhase * dwNumEntries;
+    cacheKey.dwTableType    = MHW_POLYPHASE_TABLE_Y;
+    cacheKey.dwPlane        = dwPlane;
+    cacheKey.dwHwPhase      = dwHwPhase;
+    cacheKey.dwUse8x8Filter = bUse8x8Filter;
+    cacheKey.fScaleFactor   = fScaleFactor;
+    cacheKey.fLanczosT      = fLanczosT;
+    cacheKey.fHPStrength    = fHPStrength;
+
+    if (coefCount <= MHW_POLYPHASE_CACHE_MAX_COEFS &&
+        Mhw_GetCachedPolyphaseTable(cacheKey, iCoefs, coefCount))
+    {
+        return eStatus;
+    }
+
+    for (i = 0; i < dwHwPhase; i++)
+    {
+        fBase = fStartOffset - (float)i / (float)NUM_POLYPHASE_TABLES;
+        fSumCoefs = 0.0F;
+
+        for (j = 0; j < dwNumEntries; j++)
+        {
+            fPos = fBase + (float)j;
+
+            if (bUse8x8Filter)
+            {
+                fPhaseCoefs[j] = fPhaseCoefsCopy[j] = MosUtilities::MosLanczos(fPos * fScaleFactor, dwNumEntries, fLanczosT);
+            }
+            else
+            {
+                fPhaseCoefs[j] = fPhaseCoefsCopy[j] = MosUtilities::MosLanczosG(fPos * fScaleFactor, NUM_POLYPHASE_5x5_Y_ENTRIES, fLanczosT);
+            }
+
+            fSumCoefs += fPhaseCoefs[j];
+        }
+
+        // Convolve with HP
+        if (dwPlane == MHW_GENERIC_PLANE || dwPlane == MHW_Y_PLANE)
+        {
+            if (i <= NUM_POLYPHASE_TABLES / 2)
+            {
+                fHPHalfPhase = (float)i / (float)NUM_POLYPHASE_TABLES;
+            }
+            else
+            {
+                fHPHalfPhase = (float)(NUM_POLYPHASE_TABLES - i) / (float)NUM_POLYPHASE_TABLES;
+            }
+            fHPFilter[0] = fHPFilter[2] = -fHPStrength * MosUtilities::MosSinc(fHPHalfPhase * MOS_PI);
+            fHPFilter[1] = 1.0F + 2.0F * fHPStrength;
+
+            for (j = 0; j < dwNumEntries; j++)
+            {
+                fHPSum = 0.0F;
+                for (k = -1; k <= 1; k++)
+                {
+                    if ((((long)j + k) >= 0) && (j + k < dwNumEntries))
+                    {
+                        fHPSum += fPhaseCoefsCopy[(int32_t)j+k] * fHPFilter[k+1];
+                    }
+                    fPhaseCoefs[j] = fHPSum;
+                }
+            }
+        }
+
+        // Normalize coefs and save
+        iSumQuantCoefs = 0;
+        for (j = 0; j < dwNumEntries; j++)
+        {
+            iCoefs[i * dwNumEntries + j] = (int32_t)floor(0.5F + (float)dwTableCoefUnit * fPhaseCoefs[j] / fSumCoefs);
+            iSumQuantCoefs += iCoefs[i * dwNumEntries + j];
+        }
+
+        // Fix center coef so that filter is balanced
+        if (i <= NUM_POLYPHASE_TABLES / 2)
+        {
+            iCoefs[i * dwNumEntries + iCenterPixel] -= iSumQuantCoefs - dwTableCoefUnit;
+        }
+        else
+        {
+            iCoefs[i * dwNumEntries + iCenterPixel + 1] -= iSumQuantCoefs - dwTableCoefUnit;
+        }
+    }
+
+    if (coefCount <= MHW_POLYPHASE_CACHE_MAX_COEFS)
+    {
+        Mhw_CachePolyphaseTable(cacheKey, iCoefs, coefCount);
+    }
+
+    return eStatus;
+}
+
+//!
+//! \brief      Calculate Polyphase tables for UV for Gen9, across SFC and Render engine to set the sampler states
+//! \details    Calculate Polyphase tables for UV
+//! \param      int32_t*   piCoefs
+//!             [out]   Polyphase Table to fill
+//! \param      float   fLanczosT
+//!             [in]    Lanczos modifying factor
+//! \param      float   fInverseScaleFactor
+//!             [in]    Inverse scaling factor
+//! \return   MOS_STATUS
+//!           MOS_STATUS_SUCCESS if success, else fail reason
+//!
+MOS_STATUS Mhw_CalcPolyphaseTablesUV(
+    int32_t    *piCoefs,
+    float      fLanczosT,
+    float      fInverseScaleFactor)
+{
+    int32_t     phaseCount, tableCoefUnit, centerPixel, sumQuantCoefs;
+    double      phaseCoefs[MHW_SCALER_UV_WIN_SIZE];
+    double      startOffset, sf, base, sumCoefs, pos;
+    int32_t     minCoef[MHW_SCALER_UV_WIN_SIZE];
+    int32_t     maxCoef[MHW_SCALER_UV_WIN_SIZE];
+    int32_t     i, j;
+    MOS_STATUS              eStatus = MOS_STATUS_SUCCESS;
+
+    MHW_FUNCTION_ENTER;
+
+    MHW_CHK_NULL_RETURN(piCoefs);
+
+    MHW_POLYPHASE_CACHE_KEY cacheKey = {};
+    int32_t                 *piTable = piCoefs;
+    cacheKey.dwTableType    = MHW_POLYPHASE_TABLE_UV;
+    cacheKey.fScaleFactor   = fInverseScaleFactor;
+    cacheKey.fLanczosT      = fLanczosT;
+
+    if (Mhw_GetCachedPolyphaseTable(cacheKey, piTable, MHW_SCALER_UV_WIN_SIZE * MHW_TABLE_PHASE_COUNT))
+    {
+        return eStatus;
+    }
+
+    phaseCount      = MHW_TABLE_PHASE_COUNT;
+    centerPixel     = (MHW_SCALER_UV_WIN_SIZE / 2) - 1;
+    startOffset     = (double)(-centerPixel);
+    tableCoefUnit   = 1 << MHW_TBL_COEF_PREC;
+    sf              = MOS_MIN(1.0, fInverseScaleFactor); // Sf isn't used for upscaling
+
+    MOS_ZeroMemory(piCoefs, sizeof(int32_t) * MHW_SCALER_UV_WIN_SIZE * phaseCount);
+    MOS_ZeroMemory(minCoef, sizeof(minCoef));
+    MOS_ZeroMemory(maxCoef, sizeof(maxCoef));
+
+    if (sf < 1.0F)
+    {
+        fLanczosT = 2.0F;
+    }
+
+    for(i = 0; i < phaseCount; ++i, piCoefs += MHW_SCALER_UV_WIN_SIZE)
+    {
+        // Write all
+        // Note - to shift by a half you need to a half to each phase.
+        base     = startOffset - (double)(i) / (double)(phaseCount);
+        sumCoefs = 0.0;
+
+        for(j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
+        {
+            pos             = base + (double) j;
+            phaseCoefs[j]   = MosUtilities::MosLanczos((float)(pos * sf), MHW_SCALER_UV_WIN_SIZE, fLanczosT);
+            sumCoefs        += phaseCoefs[j];
+        }
+        // Normalize coefs and save
+        for(j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
+        {
+            piCoefs[j] = (int32_t) floor((0.5 + (double)(tableCoefUnit) * (phaseCoefs[j] / sumCoefs)));
+
+            //For debug purposes:
+            minCoef[j] = MOS_MIN(minCoef[j], piCoefs[j]);
+            maxCoef[j] = MOS_MAX(maxCoef[j], piCoefs[j]);
+        }
+
+        // Recalc center coef
+        sumQuantCoefs = 0;
+        for(j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
+        {
+            sumQuantCoefs += piCoefs[j];
+        }
+
+        // Fix center coef so that filter is balanced
+        if (i <= phaseCount/2)
+        {
+            piCoefs[centerPixel]     -= sumQuantCoefs - tableCoefUnit;
+        }
+        else
+        {
+            piCoefs[centerPixel + 1] -= sumQuantCoefs - tableCoefUnit;
+        }
+    }
+
+    Mhw_CachePolyphaseTable(cacheKey, piTable, MHW_SCALER_UV_WIN_SIZE * MHW_TABLE_PHASE_COUNT);
+
+    return eStatus;
+}
+
+//!
+//! \brief      Calculate polyphase tables UV offset for Gen9, across SFC and Render engine to set the sampler states
+//! \details    Calculate Polyphase tables for UV with chroma siting for
+//!             420 to 444 conversion
+//! \param      int32_t*   piCoefs
+//!             [out]   Polyphase Table to fill
+//! \param      float   fLanczosT
+//!             [in]    Lanczos modifying factor
+//! \param      float   fInverseScaleFactor
+//!             [in]    Inverse scaling factor
+//! \param      int32_t     iUvPhaseOffset
+//!             [in]    UV Phase Offset
+//! \return   MOS_STATUS
+//!           MOS_STATUS_SUCCESS if success, else fail reason
+//!
+MOS_STATUS Mhw_CalcPolyphaseTablesUVOffset(
+    int32_t     *piCoefs,
+    float       fLanczosT,
+    float       fInverseScaleFactor,
+    int32_t     iUvPhaseOffset)
+{
+    int32_t     phaseCount, tableCoefUnit, centerPixel, sumQuantCoefs;
+    double      phaseCoefs[MHW_SCALER_UV_WIN_SIZE];
+    double      startOffset, sf, pos, sumCoefs, base;
+    int32_t     minCoef[MHW_SCALER_UV_WIN_SIZE];
+    int32_t     maxCoef[MHW_SCALER_UV_WIN_SIZE];
+    int32_t     i, j;
+    int32_t     adjusted_phase;
+    MOS_STATUS              eStatus = MOS_STATUS_SUCCESS;
+
+    MHW_FUNCTION_ENTER;
+
+    MHW_CHK_NULL_RETURN(piCoefs);
+
+    MHW_POLYPHASE_CACHE_KEY cacheKey = {};
+    int32_t                 *piTable = piCoefs;
+    cacheKey.dwTableType    = MHW_POLYPHASE_TABLE_UV_OFFSET;
+    cacheKey.fScaleFactor   = fInverseScaleFactor;
+    cacheKey.fLanczosT      = fLanczosT;
+    cacheKey.iUvPhaseOffset = iUvPhaseOffset;
+
+    if (Mhw_GetCachedPolyphaseTable(cacheKey, piTable, MHW_SCALER_UV_WIN_SIZE * MHW_TABLE_PHASE_COUNT))
+    {
+        return eStatus;
+    }
+
+    phaseCount = MHW_TABLE_PHASE_COUNT;
+    centerPixel = (MHW_SCALER_UV_WIN_SIZE / 2) - 1;
+    startOffset = (double)(-centerPixel +
+        (double)iUvPhaseOffset / (double)(phaseCount));
+    tableCoefUnit = 1 << MHW_TBL_COEF_PREC;
+
+    MOS_ZeroMemory(minCoef, sizeof(minCoef));
+    MOS_ZeroMemory(maxCoef, sizeof(maxCoef));
+    MOS_ZeroMemory(piCoefs, sizeof(int32_t)* MHW_SCALER_UV_WIN_SIZE * phaseCount);
+
+    sf = MOS_MIN(1.0, fInverseScaleFactor); // Sf isn't used for upscaling
+    if (sf < 1.0)
+    {
+        fLanczosT = 3.0;
+    }
+
+    for (i = 0; i < phaseCount; ++i, piCoefs += MHW_SCALER_UV_WIN_SIZE)
+    {
+        // Write all
+        // Note - to shift by a half you need to a half to each phase.
+        base = startOffset - (double)(i) / (double)(phaseCount);
+        sumCoefs = 0.0;
+
+        for (j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
+        {
+            pos = base + (double)j;
+            phaseCoefs[j] = MosUtilities::MosLanczos((float)(pos * sf), 6/*MHW_SCALER_UV_WIN_SIZE*/, fLanczosT);
+            sumCoefs += phaseCoefs[j];
+        }
+        // Normalize coefs and save
+        for (j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
+        {
+            piCoefs[j] = (int32_t)floor((0.5 + (double)(tableCoefUnit)* (phaseCoefs[j] / sumCoefs)));
+
+            // For debug purposes:
+            minCoef[j] = MOS_MIN(minCoef[j], piCoefs[j]);
+            maxCoef[j] = MOS_MAX(maxCoef[j], piCoefs[j]);
+        }
+
+        // Recalc center coef
+        sumQuantCoefs = 0;
+        for (j = 0; j < MHW_SCALER_UV_WIN_SIZE; ++j)
+        {
+            sumQuantCoefs += piCoefs[j];
+        }
+
+        // Fix center coef so that filter is balanced
+        adjusted_phase = i - iUvPhaseOffset;
+        if (adjusted_phase <= phaseCount / 2)
+        {
+            piCoefs[centerPixel] -= sumQuantCoefs - tableCoefUnit;
+        }
+        else // if(adjusted_phase < phaseCount)
+        {
+            piCoefs[centerPixel + 1] -= sumQuantCoefs - tableCoefUnit;
+        }
+    }
+
+    Mhw_CachePolyphaseTable(cacheKey, piTable, MHW_SCALER_UV_WIN_SIZE * MHW_TABLE_PHASE_COUNT);
+
+    return eStatus;
+}
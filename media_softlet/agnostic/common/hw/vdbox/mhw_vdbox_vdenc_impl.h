@@ -39,6 +39,14 @@
 
 namespace mhw
 {
+// Picture-level commands built only from plain parameters, usually unchanged between frames.
+// Only the SETCMD packing is reused: the SETPAR chain has to run, since feature SETPARs read
+// per-frame feature state (BRC, ROI, tiles), and the HuC read batch these commands are also
+// written to is rewritten by HuC BRC every frame, so it cannot be reused as a batch either.
+_MHW_CMD_TEMPLATE_ENABLE(vdbox::vdenc::_MHW_PAR_T(VDENC_CMD1));
+_MHW_CMD_TEMPLATE_ENABLE(vdbox::vdenc::_MHW_PAR_T(VDENC_CMD3));
+_MHW_CMD_TEMPLATE_ENABLE(vdbox::vdenc::_MHW_PAR_T(VDENC_WEIGHTSOFFSETS_STATE));
+
 namespace vdbox
 {
 namespace vdenc
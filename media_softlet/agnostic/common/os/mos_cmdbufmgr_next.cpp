@@ -57,11 +57,8 @@ MOS_STATUS CmdBufMgrNext::Initialize(OsContextNext *osContext, uint32_t cmdBufSi
     {
         m_osContext          = osContext;
 
-        m_inUsePoolMutex     = MosUtilities::MosCreateMutex();
-        MOS_OS_CHK_NULL_RETURN(m_inUsePoolMutex);
-
-        m_availablePoolMutex = MosUtilities::MosCreateMutex();
-        MOS_OS_CHK_NULL_RETURN(m_availablePoolMutex);
+        m_cmdBufPoolMutex    = MosUtilities::MosCreateMutex();
+        MOS_OS_CHK_NULL_RETURN(m_cmdBufPoolMutex);
 
         for (uint32_t i = 0; i < m_initBufNum; i++)
         {
@@ -81,9 +78,9 @@ MOS_STATUS CmdBufMgrNext::Initialize(OsContextNext *osContext, uint32_t cmdBufSi
                 return MOS_STATUS_INVALID_HANDLE;
             }
 
-            MosUtilities::MosLockMutex(m_availablePoolMutex);
+            MosUtilities::MosLockMutex(m_cmdBufPoolMutex);
             m_availableCmdBufPool.push_back(cmdBuf);
-            MosUtilities::MosUnlockMutex(m_availablePoolMutex);
+            MosUtilities::MosUnlockMutex(m_cmdBufPoolMutex);
 
             m_cmdBufTotalNum++;
         }
@@ -102,9 +99,7 @@ MOS_STATUS CmdBufMgrNext::Reset()
     auto gpuContextMgr      = m_osContext->GetGpuContextMgr();
     MOS_OS_CHK_NULL_RETURN(gpuContextMgr);
 
-    MosUtilities::MosLockMutex(m_availablePoolMutex);
-
-    MosUtilities::MosLockMutex(m_inUsePoolMutex);
+    MosUtilities::MosLockMutex(m_cmdBufPoolMutex);
 
     if (!m_inUseCmdBufPool.empty())
     {
@@ -116,7 +111,6 @@ MOS_STATUS CmdBufMgrNext::Reset()
 
     // clear in-use command buffer pool
     m_inUseCmdBufPool.clear();
-    MosUtilities::MosUnlockMutex(m_inUsePoolMutex);
 
     for (auto& cmdBuf : m_availableCmdBufPool)
     {
@@ -146,7 +140,7 @@ MOS_STATUS CmdBufMgrNext::Reset()
         }
     }
     m_cmdBufTotalNum = m_availableCmdBufPool.size();
-    MosUtilities::MosUnlockMutex(m_availablePoolMutex);
+    MosUtilities::MosUnlockMutex(m_cmdBufPoolMutex);
     return MOS_STATUS_SUCCESS;
 }
 
@@ -155,7 +149,9 @@ void CmdBufMgrNext::CleanUp()
     MOS_OS_FUNCTION_ENTER;
 
     CommandBufferNext *cmdBuf = nullptr;
-    MosUtilities::MosLockMutex(m_availablePoolMutex);
+    MosUtilities::MosLockMutex(m_cmdBufPoolMutex);
+
+    MOS_OS_NORMALMESSAGE("cmd buf pool hits %u, misses %u", m_poolHitCount, m_poolMissCount);
 
     for (auto& cmdBuf : m_availableCmdBufPool)
     {
@@ -179,8 +175,6 @@ void CmdBufMgrNext::CleanUp()
 
     // clear available command buffer pool
     m_availableCmdBufPool.clear();
-    MosUtilities::MosUnlockMutex(m_availablePoolMutex);
-    MosUtilities::MosLockMutex(m_inUsePoolMutex);
 
     if (!m_inUseCmdBufPool.empty())
     {
@@ -196,14 +190,12 @@ void CmdBufMgrNext::CleanUp()
 
     // clear in-use command buffer pool
     m_inUseCmdBufPool.clear();
-    MosUtilities::MosUnlockMutex(m_inUsePoolMutex);
+    MosUtilities::MosUnlockMutex(m_cmdBufPoolMutex);
 
     m_cmdBufTotalNum = 0;
     m_initialized    = false;
-    MosUtilities::MosDestroyMutex(m_inUsePoolMutex);
-    m_inUsePoolMutex = nullptr;
-    MosUtilities::MosDestroyMutex(m_availablePoolMutex);
-    m_availablePoolMutex = nullptr;
+    MosUtilities::MosDestroyMutex(m_cmdBufPoolMutex);
+    m_cmdBufPoolMutex = nullptr;
 }
 
 CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size)
@@ -216,9 +208,8 @@ CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size)
         return nullptr;
     }
 
-    // lock for both in-use and available command buffer pool before pick up
-    MosUtilities::MosLockMutex(m_inUsePoolMutex);
-    MosUtilities::MosLockMutex(m_availablePoolMutex);
+    // lock command buffer pools before pick up
+    MosUtilities::MosLockMutex(m_cmdBufPoolMutex);
 
     CommandBufferNext* cmdBuf = nullptr;
     CommandBufferNext* retbuf  = nullptr;
@@ -230,17 +221,34 @@ CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size)
         if (cmdBuf == nullptr)
         {
             MOS_OS_ASSERTMESSAGE("available command buf pool is null.");
-            MosUtilities::MosUnlockMutex(m_inUsePoolMutex);
-            MosUtilities::MosUnlockMutex(m_availablePoolMutex);
+            MosUtilities::MosUnlockMutex(m_cmdBufPoolMutex);
             return nullptr;
         }
 
+        // pool is sorted by descending size, so every buf large enough is in
+        // front of the first one that is too small, pick the first idle one
+        auto iter = m_availableCmdBufPool.begin();
+        for (; iter != m_availableCmdBufPool.end(); iter++)
+        {
+            if (*iter == nullptr || size > (*iter)->GetCmdBufSize())
+            {
+                iter = m_availableCmdBufPool.end();
+                break;
+            }
+            if (!(*iter)->IsUsedByHw() && !(*iter)->IsInCmdList())
+            {
+                break;
+            }
+        }
+
         // find available buf
-        if (size <= cmdBuf->GetCmdBufSize() && !cmdBuf->IsUsedByHw() && !cmdBuf->IsInCmdList())
+        if (iter != m_availableCmdBufPool.end())
         {
+            cmdBuf = *iter;
             m_inUseCmdBufPool.push_back(cmdBuf);
 
-            m_availableCmdBufPool.erase(m_availableCmdBufPool.begin());
+            m_availableCmdBufPool.erase(iter);
+            m_poolHitCount++;
 
             MOS_OS_VERBOSEMESSAGE("successfully get available buf from pool");
         }
@@ -248,6 +256,7 @@ CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size)
         else
         {
             MOS_OS_VERBOSEMESSAGE("find available buf, but is not large enough or it is still used by HW");
+            m_poolMissCount++;
 
             cmdBuf = CommandBufferNext::CreateCmdBuf(this);
             if (cmdBuf == nullptr)
@@ -275,6 +284,7 @@ CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size)
     else
     {
         MOS_OS_VERBOSEMESSAGE("No more cmd buf in the pool");
+        m_poolMissCount++;
 
         if (m_cmdBufTotalNum < m_maxPoolSize)
         {
@@ -305,13 +315,11 @@ CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size)
                 }
                 else
                 {
-                    m_availableCmdBufPool.insert(m_availableCmdBufPool.begin(), cmdBuf);
+                    // keep the pool sorted by descending size
+                    UpperInsert(cmdBuf);
                 }
                 m_cmdBufTotalNum++;
             }
-
-            // sort by decent order
-            std::sort(m_availableCmdBufPool.begin(), m_availableCmdBufPool.end(), &CmdBufMgrNext::GreaterSizeSort);
         }
         else
         {
@@ -321,8 +329,7 @@ CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size)
     }
 
     // unlock after got return buffer
-    MosUtilities::MosUnlockMutex(m_inUsePoolMutex);
-    MosUtilities::MosUnlockMutex(m_availablePoolMutex);
+    MosUtilities::MosUnlockMutex(m_cmdBufPoolMutex);
 
     return retbuf;
 }
@@ -347,9 +354,8 @@ MOS_STATUS CmdBufMgrNext::ReleaseCmdBuf(CommandBufferNext *cmdBuf)
 
     MOS_OS_CHK_NULL_RETURN(cmdBuf);
 
-    // lock for both in-use and available command buffer pool before release
-    MosUtilities::MosLockMutex(m_inUsePoolMutex);
-    MosUtilities::MosLockMutex(m_availablePoolMutex);
+    // lock command buffer pools before release
+    MosUtilities::MosLockMutex(m_cmdBufPoolMutex);
 
     bool           found = false;
     for (auto iter = m_inUseCmdBufPool.begin(); iter != m_inUseCmdBufPool.end(); iter++)
@@ -373,8 +379,7 @@ MOS_STATUS CmdBufMgrNext::ReleaseCmdBuf(CommandBufferNext *cmdBuf)
     }
 
     // unlock after release buffer
-    MosUtilities::MosUnlockMutex(m_availablePoolMutex);
-    MosUtilities::MosUnlockMutex(m_inUsePoolMutex);
+    MosUtilities::MosUnlockMutex(m_cmdBufPoolMutex);
 
     return eStatus;
 }
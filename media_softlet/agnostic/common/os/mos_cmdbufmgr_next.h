@@ -167,6 +167,24 @@ public:
         return m_handle;
     }
 
+    //!
+    //! \brief    Get the number of pick ups served from available pool
+    //! \return   uint32_t
+    //!
+    uint32_t GetPoolHitCount()
+    {
+        return m_poolHitCount;
+    }
+
+    //!
+    //! \brief    Get the number of pick ups that allocated a new command buffer
+    //! \return   uint32_t
+    //!
+    uint32_t GetPoolMissCount()
+    {
+        return m_poolMissCount;
+    }
+
  protected:
     //!
     //! \brief    Self define compare method as std:sort input 
@@ -196,14 +214,18 @@ public:
     //! \brief   Sorted List of available command buffer pool
     std::vector<CommandBufferNext *> m_availableCmdBufPool;
 
-    //! \brief   Mutex for available command buffer pool
-    PMOS_MUTEX m_availablePoolMutex = nullptr;
-
     //! \brief   List of in used command buffer pool
     std::vector<CommandBufferNext *> m_inUseCmdBufPool;
 
-    //! \brief   Mutex for in-use command buffer pool
-    PMOS_MUTEX m_inUsePoolMutex = nullptr;
+    //! \brief   Mutex for both available and in-use command buffer pool,
+    //!          buffers move between the two pools under it
+    PMOS_MUTEX m_cmdBufPoolMutex = nullptr;
+
+    //! \brief   Number of pick ups served from available pool
+    uint32_t m_poolHitCount = 0;
+
+    //! \brief   Number of pick ups that allocated a new command buffer
+    uint32_t m_poolMissCount = 0;
 
     //! \brief   Flag to indicate cmd buf mgr initialized or not
     bool m_initialized = false;
@@ -1306,6 +1306,25 @@ public:
         MOS_RESOURCE_HANDLE resource,
         bool writeOperation,
         GPU_CONTEXT_HANDLE requsetorGpuContext = MOS_GPU_CONTEXT_INVALID_HANDLE);
+
+    //!
+    //! \brief    Wait for resource idle
+    //! \details  [Resource Interface] Block the calling thread until all submitted GPU work using the resource is done
+    //! \details  Caller: HAL only
+    //! \details  Needed before CPU access through a mapping which does not wait for the GPU by itself,
+    //!           such as user pointer resources or resources which are already mapped.
+    //!
+    //! \param    [in] streamState
+    //!           Handle of Os Stream State
+    //! \param    [in] resource
+    //!           MOS Resource handle of the resource to wait for
+    //!
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    static MOS_STATUS WaitForResourceIdle(
+        MOS_STREAM_HANDLE   streamState,
+        MOS_RESOURCE_HANDLE resource);
         
     //!
     //! \brief    Resource Sync call back between Media and 3D for resource Sync
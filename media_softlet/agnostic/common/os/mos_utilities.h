@@ -459,6 +459,30 @@ public:
     static MOS_STATUS MosCreateDirectory(
         char * const       lpPathName);
 
+    //!
+    //! \brief    Creates a directory private to the current user
+    //! \details  Creates the directory if it doesn't exist, then checks that it is
+    //!           a directory owned by the current user and not accessible by others
+    //! \param    [in] lpPathName
+    //!           Pointer to the path name
+    //! \return   MOS_STATUS
+    //!           Returns MOS_STATUS_SUCCESS if the directory is private to the current user,
+    //!           MOS_STATUS_DIR_CREATE_FAILED if it can't be created,
+    //!           else MOS_STATUS_INVALID_PARAMETER
+    //!
+    static MOS_STATUS MosCreatePrivateDirectory(
+        char * const       lpPathName);
+
+    //!
+    //! \brief    Check the owner of an opened file
+    //! \param    [in] hFile
+    //!           Handle to the file
+    //! \return   bool
+    //!           true if the file is a regular file owned by the current user
+    //!
+    static bool MosIsFileOwnedByCurrentUser(
+        HANDLE             hFile);
+
     //!
     //! \brief    Creates or opens a file/object
     //! \details  Creates or opens a file/object
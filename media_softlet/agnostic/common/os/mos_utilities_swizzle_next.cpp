@@ -0,0 +1,224 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     mos_utilities_swizzle_next.cpp
+//! \brief    Tile swizzling of MOS utilities
+//! \details  Kept apart from mos_utilities_next.cpp so that it can be built
+//!           without the rest of MOS
+//!
+
+#include "mos_utilities.h"
+#include "mos_util_debug.h"
+
+#ifdef _MOS_UTILITY_EXT
+#include "mos_utilities_ext_next.h"
+#else
+#define Mos_SwizzleOffset MosUtilities::MosSwizzleOffset
+#endif
+
+int32_t MosUtilities::MosSwizzleOffset(
+    int32_t         OffsetX,
+    int32_t         OffsetY,
+    int32_t         Pitch,
+    MOS_TILE_TYPE   TileFormat,
+    int32_t         CsxSwizzle,
+    int32_t         ExtFlags)
+{
+    // When dealing with a tiled surface, logical linear accesses to the
+    // surface (y * pitch + x) must be translated into appropriate tile-
+    // formated accesses--This is done by swizzling (rearranging/translating)
+    // the given access address--though it is important to note that the
+    // swizzling is actually done on the accessing OFFSET into a TILED
+    // REGION--not on the absolute address itself.
+
+    // (!) Y-MAJOR TILING, REINTERPRETATION: For our purposes here, Y-Major
+    // tiling will be thought of in a different way, we will deal with
+    // the 16-byte-wide columns individually--i.e., we will treat a single
+    // Y-Major tile as 8 separate, thinner tiles--Doing so allows us to
+    // deal with both X- and Y-Major tile formats in the same "X-Major"
+    // way--just with different dimensions: either 512B x 8 rows, or
+    // 16B x 32 rows, respectively.
+
+    // A linear offset into a surface is of the form
+    //     y * pitch + x   =   y:x (Shorthand, meaning: y * (x's per y) + x)
+    //
+    // To treat a surface as being composed of tiles (though still being
+    // linear), just as a linear offset has a y:x composition--its y and x
+    // components can be thought of as having Row:Line and Column:X
+    // compositions, respectively, where Row specifies a row of tiles, Line
+    // specifies a row of pixels within a tile, Column specifies a column
+    // of tiles, and X in this context refers to a byte within a Line--i.e.,
+    //     offset = y:x
+    //     y = Row:Line
+    //     x = Col:X
+    //     offset = y:x = Row:Line:Col:X
+
+    // Given the Row:Line:Col:X composition of a linear offset, all that
+    // tile swizzling does is swap the Line and Col components--i.e.,
+    //     Linear Offset:   Row:Line:Col:X
+    //     Swizzled Offset: Row:Col:Line:X
+    // And with our reinterpretation of the Y-Major tiling format, we can now
+    // describe both the X- and Y-Major tiling formats in two simple terms:
+    // (1) The bit-depth of their Lines component--LBits, and (2) the
+    // swizzled bit-position of the Lines component (after it swaps with the
+    // Col component)--LPos.
+
+    int32_t Row, Line, Col, x; // Linear Offset Components
+    int32_t LBits, LPos; // Size and swizzled position of the Line component.
+    int32_t SwizzledOffset;
+    if (TileFormat == MOS_TILE_LINEAR)
+    {
+        return(OffsetY * Pitch + OffsetX);
+    }
+
+    if (TileFormat == MOS_TILE_Y)
+    {
+        LBits = 5; // Log2(TileY.Height = 32)
+        LPos = 4;  // Log2(TileY.PseudoWidth = 16)
+    }
+    else //if (TileFormat == MOS_TILE_X)
+    {
+        LBits = 3; // Log2(TileX.Height = 8)
+        LPos = 9;  // Log2(TileX.Width = 512)
+    }
+
+    Row = OffsetY >> LBits;               // OffsetY / LinesPerTile
+    Line = OffsetY & ((1 << LBits) - 1);   // OffsetY % LinesPerTile
+    Col = OffsetX >> LPos;                // OffsetX / BytesPerLine
+    x = OffsetX & ((1 << LPos) - 1);    // OffsetX % BytesPerLine
+
+    SwizzledOffset =
+        (((((Row * (Pitch >> LPos)) + Col) << LBits) + Line) << LPos) + x;
+    //                V                V                 V
+    //                / BytesPerLine   * LinesPerTile    * BytesPerLine
+
+    /// Channel Select XOR Swizzling ///////////////////////////////////////////
+    if (CsxSwizzle)
+    {
+        if (TileFormat == MOS_TILE_Y) // A6 = A6 ^ A9
+        {
+            SwizzledOffset ^= ((SwizzledOffset >> (9 - 6)) & 0x40);
+        }
+        else //if (TileFormat == VPHAL_TILE_X) // A6 = A6 ^ A9 ^ A10
+        {
+            SwizzledOffset ^= (((SwizzledOffset >> (9 - 6)) ^ (SwizzledOffset >> (10 - 6))) & 0x40);
+        }
+    }
+
+    return(SwizzledOffset);
+}
+
+void MosUtilities::MosSwizzleData(
+    uint8_t         *pSrc,
+    uint8_t         *pDst,
+    MOS_TILE_TYPE   SrcTiling,
+    MOS_TILE_TYPE   DstTiling,
+    int32_t         iHeight,
+    int32_t         iPitch,
+    int32_t         extFlags)
+{
+
+#define IS_TILED(_a)                ((_a) != MOS_TILE_LINEAR)
+#define IS_TILED_TO_LINEAR(_a, _b)  (IS_TILED(_a) && !IS_TILED(_b))
+#define IS_LINEAR_TO_TILED(_a, _b)  (!IS_TILED(_a) && IS_TILED(_b))
+
+    int32_t LinearOffset;
+    int32_t TileOffset;
+    int32_t x;
+    int32_t y;
+
+#ifndef _MOS_UTILITY_EXT
+    // Without CSX swizzling, bytes inside one line of a tile (16B for TileY
+    // columns, 512B for TileX) stay contiguous in both layouts, so resolve the
+    // swizzled offset once per tile line and copy the whole span at a time.
+    if (IS_TILED_TO_LINEAR(SrcTiling, DstTiling) || IS_LINEAR_TO_TILED(SrcTiling, DstTiling))
+    {
+        MOS_TILE_TYPE TileFormat = IS_TILED(SrcTiling) ? SrcTiling : DstTiling;
+        int32_t       SpanSize   = (TileFormat == MOS_TILE_Y) ? 16 : 512;
+        int32_t       CopySize;
+
+        for (y = 0; y < iHeight; y++)
+        {
+            LinearOffset = y * iPitch;
+            for (x = 0; x < iPitch; x += SpanSize)
+            {
+                TileOffset = Mos_SwizzleOffset(
+                    x,
+                    y,
+                    iPitch,
+                    TileFormat,
+                    false,
+                    extFlags);
+                CopySize = MOS_MIN(SpanSize, iPitch - x);
+
+                if (IS_TILED(SrcTiling))
+                {
+                    MosSecureMemcpy(pDst + LinearOffset + x, CopySize, pSrc + TileOffset, CopySize);
+                }
+                else
+                {
+                    MosSecureMemcpy(pDst + TileOffset, CopySize, pSrc + LinearOffset + x, CopySize);
+                }
+            }
+        }
+        return;
+    }
+#endif
+
+    // Translate from one format to another
+    for (y = 0, LinearOffset = 0, TileOffset = 0; y < iHeight; y++)
+    {
+        for (x = 0; x < iPitch; x++, LinearOffset++)
+        {
+            // x or y --> linear
+            if (IS_TILED_TO_LINEAR(SrcTiling, DstTiling))
+            {
+                TileOffset = Mos_SwizzleOffset(
+                    x,
+                    y,
+                    iPitch,
+                    SrcTiling,
+                    false,
+                    extFlags);
+
+                *(pDst + LinearOffset) = *(pSrc + TileOffset);
+            }
+            // linear --> x or y
+            else if (IS_LINEAR_TO_TILED(SrcTiling, DstTiling))
+            {
+                TileOffset = Mos_SwizzleOffset(
+                    x,
+                    y,
+                    iPitch,
+                    DstTiling,
+                    false,
+                    extFlags);
+
+                *(pDst + TileOffset) = *(pSrc + LinearOffset);
+            }
+            else
+            {
+                MOS_OS_ASSERT(0);
+            }
+        }
+    }
+}
@@ -949,6 +949,206 @@ void RenderHal_GetPixelsPerSample(
     }
 }
 
+//!
+//! \brief    Get Kernel Hash Buckets
+//! \details  Number of buckets of the kernel allocation hash index,
+//!           power of 2 and at least twice the number of kernel allocations
+//! \param    int32_t iKernelCount
+//!           [in] Number of kernel allocation entries
+//! \return   uint32_t
+//!           Number of hash buckets
+//!
+static uint32_t RenderHal_GetKernelHashBuckets(
+    int32_t iKernelCount)
+{
+    uint32_t dwBuckets = 16;
+
+    while (dwBuckets < (uint32_t)MOS_MAX(iKernelCount, 0) * 2)
+    {
+        dwBuckets <<= 1;
+    }
+
+    return dwBuckets;
+}
+
+//!
+//! \brief    Get Kernel Hash Bucket
+//! \details  Hash kernel unique ID and kernel cache ID to a hash bucket
+//! \param    PRENDERHAL_STATE_HEAP pStateHeap
+//!           [in] Pointer to State Heap
+//! \param    int32_t iKUID
+//!           [in] Kernel unique ID
+//! \param    int32_t iKCID
+//!           [in] Kernel cache ID
+//! \return   uint32_t
+//!           Hash bucket index
+//!
+static uint32_t RenderHal_GetKernelHashBucket(
+    PRENDERHAL_STATE_HEAP pStateHeap,
+    int32_t               iKUID,
+    int32_t               iKCID)
+{
+    uint32_t dwHash = (uint32_t)iKUID * 0x9E3779B1u ^ (uint32_t)iKCID * 0x85EBCA77u;
+
+    dwHash ^= dwHash >> 16;
+
+    return dwHash & pStateHeap->dwKernelHashMask;
+}
+
+//!
+//! \brief    Reset Kernel Hash
+//! \details  Empty the kernel allocation hash index
+//! \param    PRENDERHAL_STATE_HEAP pStateHeap
+//!           [in] Pointer to State Heap
+//! \param    int32_t iKernelCount
+//!           [in] Number of kernel allocation entries
+//! \return   void
+//!
+static void RenderHal_ResetKernelHash(
+    PRENDERHAL_STATE_HEAP pStateHeap,
+    int32_t               iKernelCount)
+{
+    int32_t i;
+
+    if (pStateHeap->piKernelHashBucket == nullptr ||
+        pStateHeap->piKernelHashNext == nullptr)
+    {
+        return;
+    }
+
+    for (i = 0; i <= (int32_t)pStateHeap->dwKernelHashMask; i++)
+    {
+        pStateHeap->piKernelHashBucket[i] = -1;
+    }
+
+    for (i = 0; i < iKernelCount; i++)
+    {
+        pStateHeap->piKernelHashNext[i] = -1;
+    }
+}
+
+//!
+//! \brief    Add Kernel Hash
+//! \details  Index a loaded kernel allocation by its KUID/KCID
+//! \param    PRENDERHAL_STATE_HEAP pStateHeap
+//!           [in] Pointer to State Heap
+//! \param    int32_t iKernelAllocationID
+//!           [in] Kernel allocation index
+//! \return   void
+//!
+static void RenderHal_AddKernelHash(
+    PRENDERHAL_STATE_HEAP pStateHeap,
+    int32_t               iKernelAllocationID)
+{
+    PRENDERHAL_KRN_ALLOCATION pKernelAllocation;
+    uint32_t                  dwBucket;
+
+    if (pStateHeap->piKernelHashBucket == nullptr ||
+        pStateHeap->piKernelHashNext == nullptr)
+    {
+        return;
+    }
+
+    pKernelAllocation = &pStateHeap->pKernelAllocation[iKernelAllocationID];
+    dwBucket          = RenderHal_GetKernelHashBucket(pStateHeap, pKernelAllocation->iKUID, pKernelAllocation->iKCID);
+
+    pStateHeap->piKernelHashNext[iKernelAllocationID] = pStateHeap->piKernelHashBucket[dwBucket];
+    pStateHeap->piKernelHashBucket[dwBucket]          = iKernelAllocationID;
+}
+
+//!
+//! \brief    Remove Kernel Hash
+//! \details  Remove a kernel allocation from the hash index,
+//!           must be called before KUID/KCID of the allocation are cleared
+//! \param    PRENDERHAL_STATE_HEAP pStateHeap
+//!           [in] Pointer to State Heap
+//! \param    int32_t iKernelAllocationID
+//!           [in] Kernel allocation index
+//! \return   void
+//!
+static void RenderHal_RemoveKernelHash(
+    PRENDERHAL_STATE_HEAP pStateHeap,
+    int32_t               iKernelAllocationID)
+{
+    PRENDERHAL_KRN_ALLOCATION pKernelAllocation;
+    int32_t                   *piLink;
+
+    if (pStateHeap->piKernelHashBucket == nullptr ||
+        pStateHeap->piKernelHashNext == nullptr)
+    {
+        return;
+    }
+
+    pKernelAllocation = &pStateHeap->pKernelAllocation[iKernelAllocationID];
+    piLink            = &pStateHeap->piKernelHashBucket[
+        RenderHal_GetKernelHashBucket(pStateHeap, pKernelAllocation->iKUID, pKernelAllocation->iKCID)];
+
+    while (*piLink >= 0)
+    {
+        if (*piLink == iKernelAllocationID)
+        {
+            *piLink = pStateHeap->piKernelHashNext[iKernelAllocationID];
+            pStateHeap->piKernelHashNext[iKernelAllocationID] = -1;
+            break;
+        }
+        piLink = &pStateHeap->piKernelHashNext[*piLink];
+    }
+}
+
+//!
+//! \brief    Find Kernel Allocation
+//! \details  Find the allocation of a loaded kernel by KUID/KCID
+//! \param    PRENDERHAL_INTERFACE pRenderHal
+//!           [in] Pointer to Hardware Interface Structure
+//! \param    int32_t iKUID
+//!           [in] Kernel unique ID
+//! \param    int32_t iKCID
+//!           [in] Kernel cache ID
+//! \return   int32_t
+//!           Kernel allocation index, -1 if the kernel is not loaded
+//!
+static int32_t RenderHal_FindKernelAllocation(
+    PRENDERHAL_INTERFACE pRenderHal,
+    int32_t              iKUID,
+    int32_t              iKCID)
+{
+    PRENDERHAL_STATE_HEAP     pStateHeap = pRenderHal->pStateHeap;
+    PRENDERHAL_KRN_ALLOCATION pKernelAllocation;
+    int32_t                   iKernelAllocationID;
+
+    if (pStateHeap->piKernelHashBucket == nullptr ||
+        pStateHeap->piKernelHashNext == nullptr)
+    {
+        // No hash index, search the allocation table
+        pKernelAllocation = pStateHeap->pKernelAllocation;
+        for (iKernelAllocationID = 0;
+             iKernelAllocationID < pRenderHal->StateHeapSettings.iKernelCount;
+             iKernelAllocationID++, pKernelAllocation++)
+        {
+            if (pKernelAllocation->iKUID == iKUID &&
+                pKernelAllocation->iKCID == iKCID)
+            {
+                return iKernelAllocationID;
+            }
+        }
+        return -1;
+    }
+
+    iKernelAllocationID = pStateHeap->piKernelHashBucket[RenderHal_GetKernelHashBucket(pStateHeap, iKUID, iKCID)];
+    while (iKernelAllocationID >= 0)
+    {
+        pKernelAllocation = &pStateHeap->pKernelAllocation[iKernelAllocationID];
+        if (pKernelAllocation->iKUID == iKUID &&
+            pKernelAllocation->iKCID == iKCID)
+        {
+            break;
+        }
+        iKernelAllocationID = pStateHeap->piKernelHashNext[iKernelAllocationID];
+    }
+
+    return iKernelAllocationID;
+}
+
 //!
 //! \brief    Allocate GSH, SSH, ISH control structures and heaps
 //! \details  Allocates State Heap control structure (system memory)
@@ -1085,6 +1285,9 @@ void RenderHal_GetPixelsPerSample(
 |  |         |                    .                      |
 |  |         | Kernel Allocation [K-1]                   |
 |  |         |-------------------------------------------|
+|  |         | Kernel Hash Bucket [0] to [H-1]           |
+|  |         | Kernel Hash Next   [0] to [K-1]           |
+|  |         |-------------------------------------------|
 |  |         | Media State Control Structure [0]         |--+
 |  |         | Media State Control Structure [1]         |--|--+
 |  |         |                    .                      |  |  |
@@ -1117,6 +1320,7 @@ void RenderHal_GetPixelsPerSample(
 |            |==============================|
 |
 |     where K  = (sSettings.iKernelCount)     Kernel Allocation Entries
+|           H  = power of 2 >= 2 * K          Kernel Hash Buckets
 |           Q  = (sSettings.iMediaStateHeaps) Media States
 |           M  = (sSettings.iMediaIDs)        Media Interface Descriptors (ID)
 |           P  = (sSettings.iSurfaceStates)   Surface States
@@ -1193,6 +1397,8 @@ MOS_STATUS RenderHal_AllocateStateHeaps(
     // Calculate size of State Heap control structure
     dwSizeAlloc  = MOS_ALIGN_CEIL(stateHeapSize, 16);
     dwSizeAlloc += MOS_ALIGN_CEIL(pSettings->iKernelCount     * sizeof(RENDERHAL_KRN_ALLOCATION)     , 16);
+    dwSizeAlloc += MOS_ALIGN_CEIL(RenderHal_GetKernelHashBuckets(pSettings->iKernelCount) * sizeof(int32_t), 16);
+    dwSizeAlloc += MOS_ALIGN_CEIL(pSettings->iKernelCount     * sizeof(int32_t)                      , 16);
     dwSizeAlloc += MOS_ALIGN_CEIL(pSettings->iMediaStateHeaps * mediaStateSize, 16);
     dwSizeAlloc += MOS_ALIGN_CEIL(pSettings->iMediaStateHeaps * pSettings->iMediaIDs * sizeof(int32_t)   , 16);
     dwSizeAlloc += MOS_ALIGN_CEIL(pSettings->iSurfaceStates   * sizeof(RENDERHAL_SURFACE_STATE_ENTRY), 16);
@@ -1230,6 +1436,13 @@ MOS_STATUS RenderHal_AllocateStateHeaps(
     pStateHeap->pKernelAllocation = (PRENDERHAL_KRN_ALLOCATION) ptr;
     ptr += MOS_ALIGN_CEIL(pSettings->iKernelCount * sizeof(RENDERHAL_KRN_ALLOCATION), 16);
 
+    // Pointer to Kernel allocation hash index
+    pStateHeap->dwKernelHashMask   = RenderHal_GetKernelHashBuckets(pSettings->iKernelCount) - 1;
+    pStateHeap->piKernelHashBucket = (int32_t*) ptr;
+    ptr += MOS_ALIGN_CEIL((pStateHeap->dwKernelHashMask + 1) * sizeof(int32_t), 16);
+    pStateHeap->piKernelHashNext   = (int32_t*) ptr;
+    ptr += MOS_ALIGN_CEIL(pSettings->iKernelCount * sizeof(int32_t), 16);
+
     // Pointer to Media State allocations
     pStateHeap->pMediaStates = (PRENDERHAL_MEDIA_STATE) ptr;
     ptr += MOS_ALIGN_CEIL(pSettings->iMediaStateHeaps * mediaStateSize, 16);
@@ -1579,6 +1792,8 @@ MOS_STATUS RenderHal_ReAllocateStateHeapsforAdvFeature(
     // Calculate size of State Heap control structure
     dwSizeAlloc  = MOS_ALIGN_CEIL(stateHeapSize                                                      , 16);
     dwSizeAlloc += MOS_ALIGN_CEIL(pSettings->iKernelCount     * sizeof(RENDERHAL_KRN_ALLOCATION)     , 16);
+    dwSizeAlloc += MOS_ALIGN_CEIL(RenderHal_GetKernelHashBuckets(pSettings->iKernelCount) * sizeof(int32_t), 16);
+    dwSizeAlloc += MOS_ALIGN_CEIL(pSettings->iKernelCount     * sizeof(int32_t)                      , 16);
     dwSizeAlloc += MOS_ALIGN_CEIL(pSettings->iMediaStateHeaps * mediaStateSize                       , 16);
     dwSizeAlloc += MOS_ALIGN_CEIL(pSettings->iMediaStateHeaps * pSettings->iMediaIDs * sizeof(int32_t)   , 16);
     dwSizeAlloc += MOS_ALIGN_CEIL(pSettings->iSurfaceStates   * sizeof(RENDERHAL_SURFACE_STATE_ENTRY), 16);
@@ -1606,6 +1821,13 @@ MOS_STATUS RenderHal_ReAllocateStateHeapsforAdvFeature(
     pStateHeap->pKernelAllocation = (PRENDERHAL_KRN_ALLOCATION)ptr;
     ptr += MOS_ALIGN_CEIL(pSettings->iKernelCount * sizeof(RENDERHAL_KRN_ALLOCATION), 16);
 
+    // Pointer to Kernel allocation hash index
+    pStateHeap->dwKernelHashMask   = RenderHal_GetKernelHashBuckets(pSettings->iKernelCount) - 1;
+    pStateHeap->piKernelHashBucket = (int32_t *)ptr;
+    ptr += MOS_ALIGN_CEIL((pStateHeap->dwKernelHashMask + 1) * sizeof(int32_t), 16);
+    pStateHeap->piKernelHashNext   = (int32_t *)ptr;
+    ptr += MOS_ALIGN_CEIL(pSettings->iKernelCount * sizeof(int32_t), 16);
+
     // Pointer to Media State allocations
     pStateHeap->pMediaStates = (PRENDERHAL_MEDIA_STATE)ptr;
     ptr += MOS_ALIGN_CEIL(pSettings->iMediaStateHeaps * mediaStateSize, 16);
@@ -1713,6 +1935,9 @@ MOS_STATUS RenderHal_FreeStateHeaps(PRENDERHAL_INTERFACE pRenderHal)
     pOsInterface = pRenderHal->pOsInterface;
     pStateHeap   = pRenderHal->pStateHeap;
 
+    MHW_RENDERHAL_NORMALMESSAGE("Kernel residency: %u hits, %u misses, %u evictions.",
+        pStateHeap->dwKernelLoadHits, pStateHeap->dwKernelLoadMisses, pStateHeap->dwKernelEvictions);
+
     // Free SSH Resource
     if (pStateHeap->pSshBuffer)
     {
@@ -2186,102 +2411,45 @@ int32_t RenderHal_LoadKernel(
         iKernelUniqueID = pKernel->iKUID;
         iKernelCacheID  = pKernel->iKCID;
 
-        // Check if kernel is already loaded; Search free allocation index
-        iSearchIndex      = -1;
-        iMaxKernels       = pRenderHal->StateHeapSettings.iKernelCount;
-        pKernelAllocation = pStateHeap->pKernelAllocation;
-        for (iKernelAllocationID = 0;
-             iKernelAllocationID < iMaxKernels;
-             iKernelAllocationID++, pKernelAllocation++)
+        // Check if kernel is already loaded
+        iMaxKernels         = pRenderHal->StateHeapSettings.iKernelCount;
+        iKernelAllocationID = RenderHal_FindKernelAllocation(pRenderHal, iKernelUniqueID, iKernelCacheID);
+        if (iKernelAllocationID >= 0)
         {
-            if (pKernelAllocation->iKUID == iKernelUniqueID &&
-                pKernelAllocation->iKCID == iKernelCacheID)
-            {
-                if (iKernelAllocationID != RENDERHAL_KERNEL_LOAD_FAIL)
-                {
-                    // Update kernel usage
-                    pRenderHal->pfnTouchKernel(pRenderHal, iKernelAllocationID);
+            pStateHeap->dwKernelLoadHits++;
 
-                    // Increment reference counter
-                    if (pKernelEntry)
-                    {
-                        pKernelEntry->dwLoaded = 1;
-                    }
-                    pRenderHal->iKernelAllocationID = iKernelAllocationID;
-                }
-
-                // Return kernel allocation index
-                return iKernelAllocationID;
-            }
+            // Update kernel usage
+            pRenderHal->pfnTouchKernel(pRenderHal, iKernelAllocationID);
 
-            if (iSearchIndex < 0 &&
-                pKernelAllocation->dwFlags == RENDERHAL_KERNEL_ALLOCATION_FREE)
+            // Increment reference counter
+            if (pKernelEntry)
             {
-                iSearchIndex = iKernelAllocationID;
+                pKernelEntry->dwLoaded = 1;
             }
-        }
+            pRenderHal->iKernelAllocationID = iKernelAllocationID;
 
-        // The kernel size to be dumped in oca buffer.
-        pStateHeap->iKernelUsedForDump = iKernelSize;
-
-        // Kernel already loaded: refresh timer; return allocation index
-        if (iKernelAllocationID < iMaxKernels)
-        {
-            // To reload the kernel forcibly if needed
-            if (pKernel->bForceReload)
-            {
-                dwOffset = pKernelAllocation->dwOffset;
-                MOS_SecureMemcpy(pStateHeap->pIshBuffer + dwOffset, iKernelSize, pKernelPtr, iKernelSize);
-
-                pKernel->bForceReload = false;
-            }
-            break;
+            // Return kernel allocation index
+            return iKernelAllocationID;
         }
+        pStateHeap->dwKernelLoadMisses++;
 
-        // Kernel parameters
-        pKernelPtr      = pKernel->pBinary;
-        iKernelSize     = pKernel->iSize;
-        iKernelUniqueID = pKernel->iKUID;
-        iKernelCacheID  = pKernel->iKCID;
-
-        // Check if kernel is already loaded; Search free allocation index
+        // Search free allocation index
         iSearchIndex      = -1;
-        iMaxKernels       = pRenderHal->StateHeapSettings.iKernelCount;
         pKernelAllocation = pStateHeap->pKernelAllocation;
         for (iKernelAllocationID = 0;
              iKernelAllocationID < iMaxKernels;
              iKernelAllocationID++, pKernelAllocation++)
         {
-            if (pKernelAllocation->iKUID == iKernelUniqueID &&
-                pKernelAllocation->iKCID == iKernelCacheID)
-            {
-                break;
-            }
-
-            if (iSearchIndex < 0 &&
-                pKernelAllocation->dwFlags == RENDERHAL_KERNEL_ALLOCATION_FREE)
+            if (pKernelAllocation->dwFlags == RENDERHAL_KERNEL_ALLOCATION_FREE)
             {
                 iSearchIndex = iKernelAllocationID;
+                break;
             }
         }
 
         // The kernel size to be dumped in oca buffer.
         pStateHeap->iKernelUsedForDump = iKernelSize;
 
-        // Kernel already loaded: refresh timer; return allocation index
-        if (iKernelAllocationID < iMaxKernels)
-        {
-            // To reload the kernel forcibly if needed
-            if (pKernel->bForceReload)
-            {
-                dwOffset = pKernelAllocation->dwOffset;
-                MOS_SecureMemcpy(pStateHeap->pIshBuffer + dwOffset, iKernelSize, pKernelPtr, iKernelSize);
-
-                pKernel->bForceReload = false;
-            }
-            break;
-        }
-
         // Simple allocation: allocation index available, space available
         if ((iSearchIndex >= 0) &&
             (pStateHeap->iKernelUsed + iKernelSize <= pStateHeap->iKernelSize))
@@ -2384,6 +2552,7 @@ int32_t RenderHal_LoadKernel(
                 iKernelAllocationID = RENDERHAL_KERNEL_LOAD_FAIL;
                 break;
             }
+            pStateHeap->dwKernelEvictions++;
         }
 
         // Allocate the entry
@@ -2407,6 +2576,7 @@ int32_t RenderHal_LoadKernel(
         pKernelAllocation->Params       = *pParameters;
         pKernelAllocation->pKernelEntry = pKernelEntry;
         pKernelAllocation->iAllocIndex  = iKernelAllocationID;
+        RenderHal_AddKernelHash(pStateHeap, iKernelAllocationID);
 
         // Copy kernel data
         MOS_SecureMemcpy(pStateHeap->pIshBuffer + dwOffset, iKernelSize, pKernelPtr, iKernelSize);
@@ -2491,6 +2661,7 @@ MOS_STATUS RenderHal_UnloadKernel(
     }
 
     // Release kernel entry (Offset/size may be used for reallocation)
+    RenderHal_RemoveKernelHash(pStateHeap, iKernelAllocationID);
     pKernelAllocation->iKID             = -1;
     pKernelAllocation->iKUID            = -1;
     pKernelAllocation->iKCID            = -1;
@@ -2589,6 +2760,8 @@ void RenderHal_ResetKernels(
         pKernelAllocation->Params           = g_cRenderHal_InitKernelParams;
     }
 
+    RenderHal_ResetKernelHash(pStateHeap, pRenderHal->StateHeapSettings.iKernelCount);
+
     // Free Kernel Heap
     pStateHeap->dwAccessCounter = 0;
     pStateHeap->iKernelSize = pRenderHal->StateHeapSettings.iKernelHeapSize;
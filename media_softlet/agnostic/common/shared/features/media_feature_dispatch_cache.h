@@ -0,0 +1,97 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     media_feature_dispatch_cache.h
+//! \brief    Defines the per-interface feature lists used by SETPAR dispatch
+//!
+
+#ifndef __MEDIA_FEATURE_DISPATCH_CACHE_H__
+#define __MEDIA_FEATURE_DISPATCH_CACHE_H__
+#include <atomic>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+#include "media_class_trace.h"
+
+//!
+//! \brief  Features implementing a given interface (e.g. MHW ParSetting)
+//! \details Features are resolved by dynamic_cast once per interface type and
+//!          cached, so per-command dispatch doesn't cast every feature again.
+//!          Must be cleared whenever the feature set changes.
+//!
+class MediaFeatureDispatchCache
+{
+public:
+    //!
+    //! \brief  Get features implementing interface T
+    //! \param  [in] features
+    //!         Feature container
+    //! \return const std::vector<const void *> &
+    //!         Features as const T *, in container order
+    //!
+    template <typename T, typename Container>
+    const std::vector<const void *> &Get(Container &features)
+    {
+        uint32_t slot = GetSlot<T>();
+        if (slot >= m_lists.size())
+        {
+            m_lists.resize(slot + 1);
+        }
+
+        auto &list = m_lists[slot];
+        if (!list.first)
+        {
+            for (auto &e : features)
+            {
+                auto p = dynamic_cast<const T *>(e.second);
+                if (p)
+                {
+                    list.second.push_back(p);
+                }
+            }
+            list.first = true;
+        }
+        return list.second;
+    }
+
+    void Clear() { m_lists.clear(); }
+
+private:
+    template <typename T>
+    static uint32_t GetSlot()
+    {
+        static const uint32_t slot = NewSlot();
+        return slot;
+    }
+
+    static uint32_t NewSlot()
+    {
+        static std::atomic<uint32_t> nextSlot(0);
+        return nextSlot++;
+    }
+
+    std::vector<std::pair<bool, std::vector<const void *>>> m_lists;  // indexed by interface slot, first: resolved
+
+MEDIA_CLASS_DEFINE_END(MediaFeatureDispatchCache)
+};
+
+#endif  // __MEDIA_FEATURE_DISPATCH_CACHE_H__
@@ -54,6 +54,7 @@ MOS_STATUS MediaFeatureManager::RegisterFeatures(
         };
         iter->second = feature;
     }
+    m_dispatchCache.Clear();
     m_packetIdList[featureID]      = std::move(packetIds);
     m_packetIdListTypes[featureID] = packetIdListType;
 
@@ -120,6 +121,7 @@ MOS_STATUS MediaFeatureManager::Destroy()
         };
     }
     m_features.clear();
+    m_dispatchCache.Clear();
 
     if (m_featureConstSettings != nullptr)
     {
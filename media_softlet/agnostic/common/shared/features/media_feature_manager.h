@@ -38,6 +38,7 @@
 #include "media_utils.h"
 #include "mos_defs.h"
 #include "media_feature_const_settings.h"
+#include "media_feature_dispatch_cache.h"
 
 #define CONSTRUCTFEATUREID(_componentID, _subComponentID, _featureID) \
     (_componentID << 24 | _subComponentID << 16 | _featureID)
@@ -143,8 +144,15 @@ public:
             return iter->second;
         }
 
+        template <typename T>
+        const std::vector<const void *> &GetFeaturesOf()
+        {
+            return m_dispatchCache.Get<T>(m_features);
+        }
+
     private:
-        container_t m_features;
+        container_t               m_features;
+        MediaFeatureDispatchCache m_dispatchCache;
     };
 
 public:
@@ -251,6 +259,18 @@ public:
     //!         actual pass number after feature check
     //!
     uint8_t GetNumPass() { return m_passNum; };
+
+    //!
+    //! \brief  Get features implementing interface T
+    //! \return const std::vector<const void *> &
+    //!         Features as const T *, in feature ID order
+    //!
+    template <typename T>
+    const std::vector<const void *> &GetFeaturesOf()
+    {
+        return m_dispatchCache.Get<T>(m_features);
+    }
+
     MediaFeatureConstSettings *GetFeatureSettings() { return m_featureConstSettings; };
     //!
     //! \brief  Check the conflict between features
@@ -287,6 +307,7 @@ protected:
     uint8_t GetTargetUsage(){return m_targetUsage;}
 
     container_t m_features;
+    MediaFeatureDispatchCache m_dispatchCache;  // must be cleared when m_features changes
     std::map<int, std::vector<int>> m_packetIdList;  // map feature ID to a vector of packet ID
     std::map<int, LIST_TYPE> m_packetIdListTypes;  // map feature ID to a flag, indicates whether packet ID vector is a block list or an allow list
     MediaFeatureConstSettings *m_featureConstSettings = nullptr;
@@ -28,6 +28,7 @@ set(TMP_HEADERS_
     ${TMP_HEADERS_}
     ${CMAKE_CURRENT_LIST_DIR}/media_feature.h
     ${CMAKE_CURRENT_LIST_DIR}/media_feature_manager.h
+    ${CMAKE_CURRENT_LIST_DIR}/media_feature_dispatch_cache.h
     ${CMAKE_CURRENT_LIST_DIR}/media_feature_const_settings.h
 )
 
@@ -27,10 +27,28 @@
 
 #include "media_copy.h"
 #include "media_copy_common.h"
+#include "media_cpu_copy.h"
 #include "media_debug_dumper.h"
 #include "mhw_cp_interface.h"
 #include "mos_utilities.h"
 
+static const char *McpyEngineName(MCPY_ENGINE mcpyEngine)
+{
+    switch (mcpyEngine)
+    {
+        case MCPY_ENGINE_VEBOX:
+            return "VeBox";
+        case MCPY_ENGINE_BLT:
+            return "BLT";
+        case MCPY_ENGINE_RENDER:
+            return "Render";
+        case MCPY_ENGINE_CPU:
+            return "CPU";
+        default:
+            return "Unknown";
+    }
+}
+
 MediaCopyBaseState::MediaCopyBaseState():
     m_osInterface(nullptr)
 {
@@ -123,7 +141,10 @@ MOS_STATUS MediaCopyBaseState::CapabilityCheck(MCPY_STATE_PARAMS& mcpySrc, MCPY_
         caps.engineRender = false;
     }
 
-    if (!caps.engineVebox && !caps.engineBlt && !caps.engineRender)
+    // Cpu cap check.
+    caps.engineCpu = IsCpuCopySupported(mcpySrc, mcpyDst);
+
+    if (!caps.engineVebox && !caps.engineBlt && !caps.engineRender && !caps.engineCpu)
     {
         return MOS_STATUS_INVALID_PARAMETER; // unsupport copy on each hw engine.
     }
@@ -156,6 +177,12 @@ MOS_STATUS MediaCopyBaseState::PreCheckCpCopy(
 //!
 MOS_STATUS MediaCopyBaseState::CopyEnigneSelect(MCPY_METHOD preferMethod, MCPY_ENGINE& mcpyEngine, MCPY_ENGINE_CAPS& caps)
 {
+    if (CpuCopyState::IsPreferred(preferMethod, caps))
+    {
+        mcpyEngine = MCPY_ENGINE_CPU;
+        return MOS_STATUS_SUCCESS;
+    }
+
     // assume perf render > vebox > blt. blt data should be measured.
     // driver should make sure there is at least one he can process copy even customer choice doesn't match caps.
     switch (preferMethod)
@@ -198,7 +225,7 @@ MOS_STATUS MediaCopyBaseState::SurfaceCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst,
     MCPY_STATE_PARAMS     mcpySrc = {nullptr, MOS_MMC_DISABLED, MOS_TILE_LINEAR, MCPY_CPMODE_CLEAR, false};
     MCPY_STATE_PARAMS     mcpyDst = {nullptr, MOS_MMC_DISABLED, MOS_TILE_LINEAR, MCPY_CPMODE_CLEAR, false};
     MCPY_ENGINE           mcpyEngine = MCPY_ENGINE_BLT;
-    MCPY_ENGINE_CAPS      mcpyEngineCaps = {1, 1, 1, 1};
+    MCPY_ENGINE_CAPS      mcpyEngineCaps = {1, 1, 1, 0, 1};
     MCPY_CHK_STATUS_RETURN(m_osInterface->pfnGetResourceInfo(m_osInterface, src, &ResDetails));
     MCPY_CHK_STATUS_RETURN(m_osInterface->pfnGetMemoryCompressionMode(m_osInterface, src, (PMOS_MEMCOMP_STATE)&(mcpySrc.CompressionMode)));
     mcpySrc.CpMode          = src->pGmmResInfo->GetSetCpSurfTag(false, 0)?MCPY_CPMODE_CP:MCPY_CPMODE_CLEAR;
@@ -295,13 +322,16 @@ MOS_STATUS MediaCopyBaseState::TaskDispatch(MCPY_STATE_PARAMS mcpySrc, MCPY_STAT
         case MCPY_ENGINE_RENDER:
             eStatus = MediaRenderCopy(mcpySrc.OsRes, mcpyDst.OsRes);
             break;
+        case MCPY_ENGINE_CPU:
+            eStatus = MediaCpuCopy(mcpySrc.OsRes, mcpyDst.OsRes);
+            break;
         default:
             break;
     }
     MosUtilities::MosUnlockMutex(m_inUseGPUMutex);
 
 #if (_DEBUG || _RELEASE_INTERNAL)
-    std::string copyEngine = mcpyEngine ?(mcpyEngine == MCPY_ENGINE_BLT?"BLT":"Render"):"VeBox";
+    std::string copyEngine = McpyEngineName(mcpyEngine);
     MediaUserSettingSharedPtr userSettingPtr = m_osInterface->pfnGetUserSettingInstance(m_osInterface);
     ReportUserSettingForDebug(
         userSettingPtr,
@@ -326,11 +356,79 @@ MOS_STATUS MediaCopyBaseState::TaskDispatch(MCPY_STATE_PARAMS mcpySrc, MCPY_STAT
         m_surfaceDumper->m_frameNum++;
     }
 #endif
-    MCPY_NORMALMESSAGE("Media Copy works on %s Engine", mcpyEngine ?(mcpyEngine == MCPY_ENGINE_BLT?"BLT":"Render"):"VeBox");
+    MCPY_NORMALMESSAGE("Media Copy works on %s Engine", McpyEngineName(mcpyEngine));
 
     return eStatus;
 }
 
+//!
+//! \brief    cpu copy support.
+//! \details  small linear copies which are cheaper on cpu than a gpu round trip.
+//! \param    mcpySrc
+//!           [in] Pointer to source paramters
+//! \param    mcpyDst
+//!           [in] Pointer to destination paramters
+//! \return   bool
+//!           Return true if support, otherwise return false.
+//!
+bool MediaCopyBaseState::IsCpuCopySupported(MCPY_STATE_PARAMS& mcpySrc, MCPY_STATE_PARAMS& mcpyDst)
+{
+    if (m_osInterface == nullptr ||
+        mcpySrc.OsRes == nullptr || mcpySrc.OsRes->pGmmResInfo == nullptr ||
+        mcpyDst.OsRes == nullptr || mcpyDst.OsRes->pGmmResInfo == nullptr)
+    {
+        return false;
+    }
+
+    MOS_SURFACE srcDetails = {};
+    MOS_SURFACE dstDetails = {};
+    srcDetails.Format = Format_Invalid;
+    dstDetails.Format = Format_Invalid;
+    if (MOS_FAILED(m_osInterface->pfnGetResourceInfo(m_osInterface, mcpySrc.OsRes, &srcDetails)) ||
+        MOS_FAILED(m_osInterface->pfnGetResourceInfo(m_osInterface, mcpyDst.OsRes, &dstDetails)))
+    {
+        return false;
+    }
+
+    GMM_RESOURCE_FLAG &srcFlags = mcpySrc.OsRes->pGmmResInfo->GetResFlags();
+    GMM_RESOURCE_FLAG &dstFlags = mcpyDst.OsRes->pGmmResInfo->GetResFlags();
+    bool sysMem = srcFlags.Info.ExistingSysMem || dstFlags.Info.ExistingSysMem;
+
+    // only integrated parts, or resources kept out of local memory on discrete parts.
+    MEDIA_FEATURE_TABLE *skuTable = m_osInterface->pfnGetSkuTable(m_osInterface);
+    bool localMem = skuTable != nullptr && MEDIA_IS_SKU(skuTable, FtrLocalMemory) &&
+                    !((srcFlags.Info.ExistingSysMem || srcFlags.Info.NonLocalOnly) &&
+                      (dstFlags.Info.ExistingSysMem || dstFlags.Info.NonLocalOnly));
+
+    return CpuCopyState::IsCopySupported(
+        mcpySrc, mcpyDst, srcDetails, dstDetails, sysMem, localMem, mcpySrc.OsRes->pGmmResInfo->GetSizeMainSurface());
+}
+
+//!
+//! \brief    use cpu to do surface copy.
+//! \details  wait for gpu work on both resources, lock them and copy with memcpy.
+//! \param    src
+//!           [in] Pointer to source surface
+//! \param    dst
+//!           [in] Pointer to destination surface
+//! \return   MOS_STATUS
+//!           Return MOS_STATUS_SUCCESS if support, otherwise return unspoort.
+//!
+MOS_STATUS MediaCopyBaseState::MediaCpuCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst)
+{
+    MCPY_CHK_NULL_RETURN(src);
+    MCPY_CHK_NULL_RETURN(dst);
+    MCPY_CHK_NULL_RETURN(src->pGmmResInfo);
+    MCPY_CHK_NULL_RETURN(dst->pGmmResInfo);
+
+    CpuCopyState cpuCopyState(m_osInterface);
+    return cpuCopyState.Copy(
+        src,
+        dst,
+        (size_t)src->pGmmResInfo->GetSizeMainSurface(),
+        (size_t)dst->pGmmResInfo->GetSizeMainSurface());
+}
+
 //!
 //! \brief    aux surface copy.
 //! \details  copy surface.
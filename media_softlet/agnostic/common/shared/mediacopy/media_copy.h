@@ -44,7 +44,8 @@ typedef struct _MCPY_ENGINE_CAPS
     uint32_t engineVebox   :1;
     uint32_t engineBlt     :1;
     uint32_t engineRender  :1;
-    uint32_t reversed      :29;
+    uint32_t engineCpu     :1;
+    uint32_t reversed      :28;
 }MCPY_ENGINE_CAPS;
 
 enum MCPY_ENGINE
@@ -52,6 +53,7 @@ enum MCPY_ENGINE
     MCPY_ENGINE_VEBOX = 0,
     MCPY_ENGINE_BLT,
     MCPY_ENGINE_RENDER,
+    MCPY_ENGINE_CPU,
 };
 
 enum MCPY_CPMODE
@@ -265,6 +267,30 @@ protected:
     virtual MOS_STATUS MediaVeboxCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst)
     {return MOS_STATUS_SUCCESS;}
 
+    //!
+    //! \brief    cpu copy support.
+    //! \details  small linear copies which are cheaper on cpu than a gpu round trip.
+    //! \param    mcpySrc
+    //!           [in] Pointer to source paramters
+    //! \param    mcpyDst
+    //!           [in] Pointer to destination paramters
+    //! \return   bool
+    //!           Return true if support, otherwise return false.
+    //!
+    virtual bool IsCpuCopySupported(MCPY_STATE_PARAMS& mcpySrc, MCPY_STATE_PARAMS& mcpyDst);
+
+    //!
+    //! \brief    use cpu to do surface copy.
+    //! \details  wait for gpu work on both resources, lock them and copy with memcpy.
+    //! \param    src
+    //!           [in] Pointer to source surface
+    //! \param    dst
+    //!           [in] Pointer to destination surface
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if support, otherwise return unspoort.
+    //!
+    virtual MOS_STATUS MediaCpuCopy(PMOS_RESOURCE src, PMOS_RESOURCE dst);
+
 public:
     PMOS_INTERFACE        m_osInterface    = nullptr;
     bool                  m_allowCPBltCopy = false;  // allow cp call media copy only for output clear cases.
@@ -32,6 +32,9 @@
 #define RENDER_COPY_THREADS_MAX  0
 #define RENDER_COPY_NUM          9
 
+#define MCPY_CPU_COPY_THRESHOLD         (64 * 1024)    // linear copies below this size are done on cpu
+#define MCPY_CPU_COPY_SYSMEM_THRESHOLD  (1024 * 1024)  // same for copies from or to existing system memory
+
 #define MCPY_CHK_STATUS(_stmt)               MOS_CHK_STATUS(MOS_COMPONENT_MCPY, MOS_MCPY_SUBCOMP_SELF, _stmt)
 #define MCPY_CHK_STATUS_RETURN(_stmt)        MOS_CHK_STATUS_RETURN(MOS_COMPONENT_MCPY, MOS_MCPY_SUBCOMP_SELF, _stmt)
 #define MCPY_CHK_NULL(_ptr)                  MOS_CHK_NULL(MOS_COMPONENT_MCPY, MOS_MCPY_SUBCOMP_SELF, _ptr)
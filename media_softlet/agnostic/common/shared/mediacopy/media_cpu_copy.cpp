@@ -0,0 +1,116 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     media_cpu_copy.cpp
+//! \brief    Common interface and structure used in cpu copy
+//! \details  Common interface and structure used in cpu copy which are platform independent
+//!
+
+#include "media_cpu_copy.h"
+#include "media_copy_common.h"
+#include "mos_utilities.h"
+
+bool CpuCopyState::IsCopySupported(
+    const MCPY_STATE_PARAMS &mcpySrc,
+    const MCPY_STATE_PARAMS &mcpyDst,
+    const MOS_SURFACE       &srcDetails,
+    const MOS_SURFACE       &dstDetails,
+    bool                     sysMem,
+    bool                     localMem,
+    uint64_t                 size)
+{
+    // tiled, compressed and protected content stays on the hw engines.
+    if (mcpySrc.TileMode != MOS_TILE_LINEAR || mcpyDst.TileMode != MOS_TILE_LINEAR ||
+        mcpySrc.CompressionMode != MOS_MMC_DISABLED || mcpyDst.CompressionMode != MOS_MMC_DISABLED ||
+        mcpySrc.CpMode != MCPY_CPMODE_CLEAR || mcpyDst.CpMode != MCPY_CPMODE_CLEAR ||
+        mcpySrc.bAuxSuface)
+    {
+        return false;
+    }
+
+    // a cpu lock of device local memory reads uncached through the pci bar.
+    if (localMem)
+    {
+        return false;
+    }
+
+    // both resources need the same layout, so that one memcpy covers every plane.
+    if (srcDetails.Format   != dstDetails.Format  ||
+        srcDetails.dwWidth  != dstDetails.dwWidth ||
+        srcDetails.dwHeight != dstDetails.dwHeight ||
+        srcDetails.dwPitch  != dstDetails.dwPitch)
+    {
+        return false;
+    }
+
+    // the copy blocks the caller, so large copies stay on the hw engines even for system memory.
+    return size < (sysMem ? MCPY_CPU_COPY_SYSMEM_THRESHOLD : MCPY_CPU_COPY_THRESHOLD);
+}
+
+bool CpuCopyState::IsPreferred(MCPY_METHOD preferMethod, const MCPY_ENGINE_CAPS &caps)
+{
+    // cpu beats a gpu submission for the copies it supports,
+    // but an explicit engine preference wins unless no hw engine can do the copy.
+    return caps.engineCpu &&
+           (preferMethod == MCPY_METHOD_DEFAULT || !(caps.engineVebox || caps.engineBlt || caps.engineRender));
+}
+
+MOS_STATUS CpuCopyState::WaitForResourceIdle(PMOS_RESOURCE resource)
+{
+    MCPY_CHK_NULL_RETURN(m_osInterface);
+
+    return MosInterface::WaitForResourceIdle(m_osInterface->osStreamState, resource);
+}
+
+MOS_STATUS CpuCopyState::Copy(PMOS_RESOURCE src, PMOS_RESOURCE dst, size_t srcSize, size_t dstSize)
+{
+    MCPY_CHK_NULL_RETURN(m_osInterface);
+    MCPY_CHK_NULL_RETURN(src);
+    MCPY_CHK_NULL_RETURN(dst);
+
+    // gpu may still write the source or access the destination.
+    MCPY_CHK_STATUS_RETURN(WaitForResourceIdle(src));
+    MCPY_CHK_STATUS_RETURN(WaitForResourceIdle(dst));
+
+    MOS_LOCK_PARAMS lockFlags;
+    MOS_ZeroMemory(&lockFlags, sizeof(MOS_LOCK_PARAMS));
+    lockFlags.ReadOnly = 1;
+    uint8_t *srcData = (uint8_t *)m_osInterface->pfnLockResource(m_osInterface, src, &lockFlags);
+    MCPY_CHK_NULL_RETURN(srcData);
+
+    MOS_ZeroMemory(&lockFlags, sizeof(MOS_LOCK_PARAMS));
+    lockFlags.WriteOnly = 1;
+    uint8_t *dstData = (uint8_t *)m_osInterface->pfnLockResource(m_osInterface, dst, &lockFlags);
+    if (dstData == nullptr)
+    {
+        m_osInterface->pfnUnlockResource(m_osInterface, src);
+        MCPY_ASSERTMESSAGE("Failed to lock copy destination");
+        return MOS_STATUS_NULL_POINTER;
+    }
+
+    MOS_STATUS eStatus = MOS_SecureMemcpy(dstData, dstSize, srcData, MOS_MIN(srcSize, dstSize));
+
+    m_osInterface->pfnUnlockResource(m_osInterface, src);
+    m_osInterface->pfnUnlockResource(m_osInterface, dst);
+
+    return eStatus;
+}
@@ -0,0 +1,118 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     media_cpu_copy.h
+//! \brief    Common interface and structure used in cpu copy
+//! \details  Common interface and structure used in cpu copy which are platform independent
+//!
+
+#ifndef __MEDIA_CPU_COPY_H__
+#define __MEDIA_CPU_COPY_H__
+
+#include "media_copy.h"
+
+class CpuCopyState
+{
+public:
+    //!
+    //! \brief    CpuCopyState constructor
+    //! \param    osInterface
+    //!           [in] Pointer to MOS_INTERFACE
+    //!
+    CpuCopyState(PMOS_INTERFACE osInterface) : m_osInterface(osInterface) {}
+
+    virtual ~CpuCopyState() {}
+
+    //!
+    //! \brief    cpu copy support.
+    //! \details  check queried resource attributes, only small linear copies are cheaper on cpu than a gpu round trip.
+    //! \param    mcpySrc
+    //!           [in] source paramters
+    //! \param    mcpyDst
+    //!           [in] destination paramters
+    //! \param    srcDetails
+    //!           [in] source resource info
+    //! \param    dstDetails
+    //!           [in] destination resource info
+    //! \param    sysMem
+    //!           [in] whether source or destination wraps existing system memory
+    //! \param    localMem
+    //!           [in] whether source or destination may be in device local memory
+    //! \param    size
+    //!           [in] size of the source main surface in bytes
+    //! \return   bool
+    //!           Return true if support, otherwise return false.
+    //!
+    static bool IsCopySupported(
+        const MCPY_STATE_PARAMS &mcpySrc,
+        const MCPY_STATE_PARAMS &mcpyDst,
+        const MOS_SURFACE       &srcDetails,
+        const MOS_SURFACE       &dstDetails,
+        bool                     sysMem,
+        bool                     localMem,
+        uint64_t                 size);
+
+    //!
+    //! \brief    cpu copy preference.
+    //! \details  pick cpu over the hw engines for a copy it supports.
+    //! \param    preferMethod
+    //!           [in] copy method
+    //! \param    caps
+    //!           [in] reference of featue supported engine
+    //! \return   bool
+    //!           Return true if cpu should do the copy, otherwise return false.
+    //!
+    static bool IsPreferred(MCPY_METHOD preferMethod, const MCPY_ENGINE_CAPS &caps);
+
+    //!
+    //! \brief    use cpu to do surface copy.
+    //! \details  wait for gpu work on both resources, lock them and copy main surface with memcpy.
+    //! \param    src
+    //!           [in] Pointer to source surface
+    //! \param    dst
+    //!           [in] Pointer to destination surface
+    //! \param    srcSize
+    //!           [in] size of the source main surface in bytes
+    //! \param    dstSize
+    //!           [in] size of the destination main surface in bytes
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if success, otherwise return failed.
+    //!
+    MOS_STATUS Copy(PMOS_RESOURCE src, PMOS_RESOURCE dst, size_t srcSize, size_t dstSize);
+
+protected:
+    //!
+    //! \brief    wait for resource idle.
+    //! \details  lock doesn't wait for gpu on userptr or already mapped resources, so wait explicitly.
+    //! \param    resource
+    //!           [in] Pointer to resource
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if success, otherwise return failed.
+    //!
+    virtual MOS_STATUS WaitForResourceIdle(PMOS_RESOURCE resource);
+
+    PMOS_INTERFACE m_osInterface = nullptr;
+
+MEDIA_CLASS_DEFINE_END(CpuCopyState)
+};
+
+#endif  // __MEDIA_CPU_COPY_H__
@@ -24,6 +24,7 @@ set(TMP_SOURCES_
     ${CMAKE_CURRENT_LIST_DIR}/media_blt_copy_next.cpp
     ${CMAKE_CURRENT_LIST_DIR}/media_vebox_copy_next.cpp
     ${CMAKE_CURRENT_LIST_DIR}/media_render_copy_next.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/media_cpu_copy.cpp
 )
 
 set(TMP_HEADERS_
@@ -33,6 +34,7 @@ set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/media_blt_copy_next.h
     ${CMAKE_CURRENT_LIST_DIR}/media_vebox_copy_next.h
     ${CMAKE_CURRENT_LIST_DIR}/media_render_copy_next.h
+    ${CMAKE_CURRENT_LIST_DIR}/media_cpu_copy.h
 )
 
 set(SOFTLET_COMMON_PRIVATE_INCLUDE_DIRS_
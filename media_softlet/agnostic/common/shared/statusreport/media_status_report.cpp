@@ -56,7 +56,21 @@ MOS_STATUS MediaStatusReport::GetReport(uint16_t requireNum, void *status)
 
     uint32_t completedCount = *m_completedCount;
     uint32_t reportedCount = m_reportedCount;
-    uint32_t reportedCountOrigin = m_reportedCount;
+
+    // Entries older than one ring size have been overwritten by later submissions,
+    // so skip them instead of parsing stale data.
+    if (m_submittedCount - reportedCount >= m_statusNum)
+    {
+        // Entry m_submittedCount - m_statusNum is still intact, but it shares its slot with the next
+        // frame, whose Init() overwrites it before Reset() advances m_submittedCount. Skip it as well,
+        // a query made while the next frame is being prepared would otherwise parse that frame's slot.
+        uint32_t oldestValidCount = m_submittedCount - m_statusNum + 1;
+        if ((int32_t)(completedCount - oldestValidCount) >= 0)
+        {
+            reportedCount = oldestValidCount;
+        }
+    }
+    uint32_t reportedCountOrigin = reportedCount;
     uint32_t availableCount = m_submittedCount - reportedCount;
     uint32_t generatedReportCount = 0;
     uint32_t reportIndex = 0;
@@ -50,10 +50,16 @@ public:
         uint32_t     bufSize;
     };
 
+    static const uint32_t m_defaultStatusNum = 512;
+    static const uint32_t m_maxStatusNum     = 8192;
+
     //!
     //! \brief  Constructor
+    //! \param  [in] statusNum
+    //!         Number of entries in the status report ring, rounded up to power of 2
     //!
-    MediaStatusReport() {};
+    MediaStatusReport(uint32_t statusNum = m_defaultStatusNum) :
+        m_statusNum(RoundUpStatusNum(statusNum)) {};
     virtual ~MediaStatusReport() {};
 
     //!
@@ -134,6 +140,27 @@ public:
     uint32_t GetReportedCount() const { return m_reportedCount; }
 
     uint32_t GetIndex(uint32_t count) { return CounterToIndex(count); }
+
+    //!
+    //! \brief  Get number of entries in the status report ring.
+    //! \return m_statusNum
+    //!
+    uint32_t GetStatusNum() const { return m_statusNum; }
+
+    //!
+    //! \brief  Ring size for a user requested number of entries
+    //! \details Never below the default, which covers the frames a pipeline keeps in flight,
+    //!          so that slots are not reused while their frames are still being processed.
+    //! \param  [in] statusNum
+    //!         Requested number of entries
+    //! \return uint32_t
+    //!         Number of entries to create the status report with
+    //!
+    static uint32_t ClampStatusNum(uint32_t statusNum)
+    {
+        return RoundUpStatusNum(MOS_CLAMP_MIN_MAX(statusNum, m_defaultStatusNum, m_maxStatusNum));
+    }
+
     //!
     //! \brief  Regist observer of complete event.
     //! \param  [in] observer
@@ -188,7 +215,17 @@ protected:
         return counter & (m_statusNum - 1);
     }
 
-    static const uint32_t m_statusNum        = 512;
+    static uint32_t RoundUpStatusNum(uint32_t statusNum)
+    {
+        uint32_t num = 1;
+        while (num < statusNum && num < (1u << 31))
+        {
+            num <<= 1;
+        }
+        return num;
+    }
+
+    const uint32_t   m_statusNum;
 
     PMOS_RESOURCE    m_completedCountBuf     = nullptr;
     uint32_t         *m_completedCount       = nullptr;
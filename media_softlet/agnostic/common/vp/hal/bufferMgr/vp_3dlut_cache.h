@@ -0,0 +1,157 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     vp_3dlut_cache.h
+//! \brief    Defines the HDR 3DLut tables kept for reuse across frames,
+//!           one table per set of HDR metadata the 3DLut kernel consumes.
+//!
+
+#ifndef __VP_3DLUT_CACHE_H__
+#define __VP_3DLUT_CACHE_H__
+
+#include <string.h>
+#include "mos_defs.h"
+#include "media_class_trace.h"
+
+#define VP_NUM_3DLUT_CACHE_ENTRIES      4                                       //!< Number of kernel generated HDR 3DLut tables kept for reuse
+
+struct VP_SURFACE;
+
+namespace vp
+{
+//!
+//! \brief HDR metadata the 3DLut kernel output depends on.
+//!        Only what the 3DLut kernel reads in SetKernelConfigs, so that keys which
+//!        differ in nothing the kernel consumes share one table.
+//!        All members are 32 bits wide so that keys can be compared by memcmp.
+//!
+struct VP_3DLUT_CACHE_KEY
+{
+    uint32_t        maxDisplayLum;
+    uint32_t        maxContentLevelLum;
+    uint32_t        hdrMode;
+};
+
+struct VP_3DLUT_CACHE_ENTRY
+{
+    VP_3DLUT_CACHE_KEY  key;
+    uint32_t            hash;
+    uint32_t            lastUsed;
+    bool                valid;          //!< true once the 3DLut kernel filling the table was submitted
+    VP_SURFACE          *surface;
+};
+
+//!
+//! \brief  3DLut tables generated by 3DLut kernel, looked up by HDR metadata.
+//! \details On miss, the least recently used entry is assigned to the new key. It stays
+//!         invalid until SetFilled is called after the 3DLut kernel has been submitted,
+//!         so a failed submission never leaves a garbage table behind for reuse.
+//!
+class Vp3DLutCache
+{
+public:
+    //!
+    //! \brief  Select the table for key
+    //! \param  [in] key
+    //!         HDR metadata of current frame
+    //! \param  [out] index
+    //!         Index of the selected entry
+    //! \return bool
+    //!         true if the table for key has been generated and 3DLut kernel can be skipped
+    //!
+    bool Select(const VP_3DLUT_CACHE_KEY &key, uint32_t &index)
+    {
+        // Fowler/Noll/Vo FNV-1a hash of the key, used to skip memcmp on mismatch.
+        const uint8_t *data   = (const uint8_t *)&key;
+        uint32_t       hash   = 2166136261u;
+        uint32_t       victim = 0;
+
+        for (uint32_t i = 0; i < sizeof(key); ++i)
+        {
+            hash = (hash ^ data[i]) * 16777619u;
+        }
+
+        ++m_tick;
+
+        for (uint32_t i = 0; i < VP_NUM_3DLUT_CACHE_ENTRIES; ++i)
+        {
+            VP_3DLUT_CACHE_ENTRY &entry = m_entries[i];
+            if (entry.valid && entry.hash == hash && 0 == memcmp(&entry.key, &key, sizeof(key)))
+            {
+                entry.lastUsed = m_tick;
+                index          = i;
+                return true;
+            }
+
+            // Prefer an unused entry, otherwise the least recently used one.
+            if (m_entries[victim].valid &&
+                (!entry.valid || entry.lastUsed < m_entries[victim].lastUsed))
+            {
+                victim = i;
+            }
+        }
+
+        m_entries[victim].key      = key;
+        m_entries[victim].hash     = hash;
+        m_entries[victim].lastUsed = m_tick;
+        m_entries[victim].valid    = false;
+        index                      = victim;
+        return false;
+    }
+
+    //!
+    //! \brief  Mark the table of entry as generated, so it can be reused by its key
+    //!
+    void SetFilled(uint32_t index)
+    {
+        if (index < VP_NUM_3DLUT_CACHE_ENTRIES)
+        {
+            m_entries[index].valid = true;
+        }
+    }
+
+    //!
+    //! \brief  Mark the table of entry as not generated by its key
+    //!
+    void Invalidate(uint32_t index)
+    {
+        if (index < VP_NUM_3DLUT_CACHE_ENTRIES)
+        {
+            m_entries[index].valid = false;
+        }
+    }
+
+    VP_3DLUT_CACHE_ENTRY &GetEntry(uint32_t index)
+    {
+        return m_entries[index];
+    }
+
+protected:
+    VP_3DLUT_CACHE_ENTRY m_entries[VP_NUM_3DLUT_CACHE_ENTRIES] = {};
+    uint32_t             m_tick                                = 0;
+
+MEDIA_CLASS_DEFINE_END(vp__Vp3DLutCache)
+};
+
+}  // namespace vp
+
+#endif // __VP_3DLUT_CACHE_H__
@@ -196,10 +196,14 @@ VpResourceManager::~VpResourceManager()
         m_allocator.DestroyVpSurface(m_veboxDNSpatialConfigSurface);
     }
 
-    if (m_vebox3DLookUpTables)
+    for (uint32_t i = 0; i < VP_NUM_3DLUT_CACHE_ENTRIES; ++i)
     {
-        m_allocator.DestroyVpSurface(m_vebox3DLookUpTables);
+        if (m_3DLutCache.GetEntry(i).surface)
+        {
+            m_allocator.DestroyVpSurface(m_3DLutCache.GetEntry(i).surface);
+        }
     }
+    m_vebox3DLookUpTables = nullptr;
 
     if (m_vebox3DLookUpTables2D)
     {
@@ -600,6 +604,8 @@ void VpResourceManager::OnNewFrameProcessEnd()
     MT_LOG1(MT_VP_HAL_ONNEWFRAME_PROC_END, MT_NORMAL, MT_FUNC_END, 1);
     m_allocator.CleanRecycler();
     m_currentPipeIndex = 0;
+    // Table not committed means the pipe filling it failed, keep it invalid.
+    m_3DLutTablePending = false;
     CleanTempSurfaces();
 }
 
@@ -1908,6 +1914,37 @@ MOS_STATUS VpResourceManager::AllocateVeboxResource(VP_EXECUTE_CAPS& caps, VP_SU
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS VpResourceManager::Select3DLutTable(const VP_3DLUT_CACHE_KEY &key, bool &isTableFilled)
+{
+    VP_FUNC_CALL();
+
+    isTableFilled = m_3DLutCache.Select(key, m_current3DLutIndex);
+    if (isTableFilled)
+    {
+        m_3DLutTablePending = false;
+        VP_PUBLIC_NORMALMESSAGE("3DLut table %d reused.", m_current3DLutIndex);
+    }
+    else
+    {
+        // The table will be filled by 3DLut kernel before vebox uses it in current pipe.
+        m_3DLutTablePending = true;
+        VP_PUBLIC_NORMALMESSAGE("3DLut table %d assigned for new HDR metadata.", m_current3DLutIndex);
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+void VpResourceManager::Commit3DLutTable()
+{
+    VP_FUNC_CALL();
+
+    if (m_3DLutTablePending)
+    {
+        m_3DLutCache.SetFilled(m_current3DLutIndex);
+        m_3DLutTablePending = false;
+    }
+}
+
 MOS_STATUS VpResourceManager::Allocate3DLut(VP_EXECUTE_CAPS& caps)
 {
     VP_FUNC_CALL();
@@ -1916,12 +1953,21 @@ MOS_STATUS VpResourceManager::Allocate3DLut(VP_EXECUTE_CAPS& caps)
 
     if (caps.bHDR3DLUT || caps.b3DLutCalc)
     {
+        if (m_current3DLutIndex >= VP_NUM_3DLUT_CACHE_ENTRIES)
+        {
+            // No table selected by Select3DLutTable. Content is not generated by
+            // 3DLut kernel in this case, so the entry cannot be reused by key.
+            m_current3DLutIndex = 0;
+            m_3DLutCache.Invalidate(0);
+        }
+        VP_3DLUT_CACHE_ENTRY &entry = m_3DLutCache.GetEntry(m_current3DLutIndex);
+
         // HDR
         uint32_t lutWidth = 0;
         uint32_t lutHeight = 0;
         size = Get3DLutSize(lutWidth, lutHeight);
         VP_PUBLIC_CHK_STATUS_RETURN(m_allocator.ReAllocateSurface(
-            m_vebox3DLookUpTables,
+            entry.surface,
             "Vebox3DLutTableSurface",
             Format_Buffer,
             MOS_GFXRES_BUFFER,
@@ -1935,6 +1981,7 @@ MOS_STATUS VpResourceManager::Allocate3DLut(VP_EXECUTE_CAPS& caps)
             IsDeferredResourceDestroyNeeded(),
             MOS_HW_RESOURCE_USAGE_VP_INTERNAL_READ_WRITE_RENDER));
 
+        m_vebox3DLookUpTables = entry.surface;
     }
 
     return MOS_STATUS_SUCCESS;
@@ -33,6 +33,7 @@
 #include "vp_pipeline_common.h"
 #include "vp_utils.h"
 #include "vp_hdr_resource_manager.h"
+#include "vp_3dlut_cache.h"
 #include "media_copy.h"
 
 #define VP_MAX_NUM_VEBOX_SURFACES     4                                       //!< Vebox output surface creation, also can be reuse for DI usage:
@@ -352,6 +353,27 @@ public:
 
     virtual MOS_STATUS FillLinearBufferWithEncZero(VP_SURFACE *surface, uint32_t width, uint32_t height);
 
+    //!
+    //! \brief    Select the 3DLut table used by current frame
+    //! \details  Look up the 3DLut tables generated by 3DLut kernel for previous frames.
+    //!           On miss, the least recently used table is assigned to the key and need
+    //!           be filled by 3DLut kernel before being used by vebox. It can only be
+    //!           reused after Commit3DLutTable.
+    //! \param    [in] key
+    //!           HDR metadata of current frame
+    //! \param    [out] isTableFilled
+    //!           true if the table for key has been generated and 3DLut kernel can be skipped
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    MOS_STATUS Select3DLutTable(const VP_3DLUT_CACHE_KEY &key, bool &isTableFilled);
+
+    //!
+    //! \brief    Mark the 3DLut table selected for current frame as filled
+    //! \details  Called after the pipe running 3DLut kernel has been submitted successfully.
+    //!
+    void Commit3DLutTable();
+
     bool IsSameSamples()
     {
         return m_sameSamples;
@@ -532,11 +554,14 @@ protected:
     VP_SURFACE *m_veboxRgbHistogram                          = nullptr;       //!< RGB Histogram surface for Vebox
     VP_SURFACE *m_veboxDNTempSurface                         = nullptr;       //!< Vebox DN Update kernels temp surface
     VP_SURFACE *m_veboxDNSpatialConfigSurface                = nullptr;       //!< Spatial Attributes Configuration Surface for DN kernel
-    VP_SURFACE *m_vebox3DLookUpTables                        = nullptr;
+    VP_SURFACE *m_vebox3DLookUpTables                        = nullptr;       //!< 3DLut table of current frame, owned by m_3DLutCache.
     VP_SURFACE *m_vebox3DLookUpTables2D                      = nullptr;
     VP_SURFACE *m_vebox1DLookUpTables                        = nullptr;
     VP_SURFACE *m_veboxDnHVSTables                           = nullptr;
     VP_SURFACE *m_3DLutKernelCoefSurface                     = nullptr;       //!< Coef surface for 3DLut kernel.
+    Vp3DLutCache m_3DLutCache;                                                 //!< 3DLut tables generated by 3DLut kernel.
+    uint32_t    m_current3DLutIndex                          = VP_NUM_3DLUT_CACHE_ENTRIES;
+    bool        m_3DLutTablePending                          = false;         //!< true if 3DLut kernel fills the current table in this frame
     uint32_t    m_currentDnOutput                            = 0;
     uint32_t    m_currentStmmIndex                           = 0;
     uint32_t    m_veboxOutputCount                           = 2;             //!< PE on: 4 used. PE off: 2 used
@@ -46,6 +46,11 @@ Policy::Policy(VpInterface &vpInterface) : m_vpInterface(vpInterface)
 
 Policy::~Policy()
 {
+    VP_PUBLIC_NORMALMESSAGE("Engine caps cache: %u hits, %u misses.",
+        m_engineCapsCacheStatistics.hitCount, m_engineCapsCacheStatistics.missCount);
+
+    // The clones are returned to the sw filter handlers, so this must run before they are destroyed.
+    ClearEngineCapsCache();
     UnregisterFeatures();
 }
 
@@ -354,14 +359,55 @@ MOS_STATUS Policy::GetExecuteCaps(SwFilterPipe& subSwFilterPipe, HW_FILTER_PARAM
 
     engineCapsCombinedAllPipes.value = 0;
 
-    for (index = 0; index < inputSurfCount; ++index)
+    std::vector<SwFilter *>  filters;
+    bool                     capsCacheable = GetEngineCapsCacheFilters(subSwFilterPipe, filters);
+    ENGINE_CAPS_CACHE_ENTRY *cachedEntry   = capsCacheable ? FindEngineCapsCacheEntry(inputSurfCount, outputSurfCount, filters) : nullptr;
+
+    if (cachedEntry)
     {
-        VP_PUBLIC_CHK_STATUS_RETURN(BuildExecutionEngines(subSwFilterPipe, true, index, engineCapsCombinedAllPipes));
+        VP_PUBLIC_CHK_STATUS_RETURN(RestoreEngineCaps(*cachedEntry, filters));
+        ++m_engineCapsCacheStatistics.hitCount;
     }
-
-    for (index = 0; index < outputSurfCount; ++index)
+    else
     {
-        VP_PUBLIC_CHK_STATUS_RETURN(BuildExecutionEngines(subSwFilterPipe, false, index, engineCapsCombinedAllPipes));
+        ENGINE_CAPS_CACHE_ENTRY newEntry = {};
+        MOS_STATUS              status   = MOS_STATUS_SUCCESS;
+
+        newEntry.inputPipeCount  = inputSurfCount;
+        newEntry.outputPipeCount = outputSurfCount;
+
+        if (capsCacheable)
+        {
+            status = CloneEngineCapsCacheFilters(filters, newEntry.key, false);
+        }
+
+        for (index = 0; MOS_SUCCEEDED(status) && index < inputSurfCount; ++index)
+        {
+            status = BuildExecutionEngines(subSwFilterPipe, true, index, engineCapsCombinedAllPipes);
+        }
+
+        for (index = 0; MOS_SUCCEEDED(status) && index < outputSurfCount; ++index)
+        {
+            status = BuildExecutionEngines(subSwFilterPipe, false, index, engineCapsCombinedAllPipes);
+        }
+
+        if (capsCacheable && MOS_SUCCEEDED(status))
+        {
+            status = CloneEngineCapsCacheFilters(filters, newEntry.evaluated, true);
+        }
+
+        if (capsCacheable && MOS_SUCCEEDED(status))
+        {
+            AddEngineCapsCacheEntry(newEntry);
+            ++m_engineCapsCacheStatistics.missCount;
+        }
+        else
+        {
+            ReleaseEngineCapsCacheFilters(newEntry.key);
+            ReleaseEngineCapsCacheFilters(newEntry.evaluated);
+        }
+
+        VP_PUBLIC_CHK_STATUS_RETURN(status);
     }
 
     VP_PUBLIC_CHK_STATUS_RETURN(BuildFilters(subSwFilterPipe, params));
@@ -369,6 +415,209 @@ MOS_STATUS Policy::GetExecuteCaps(SwFilterPipe& subSwFilterPipe, HW_FILTER_PARAM
     return MOS_STATUS_SUCCESS;
 }
 
+bool Policy::GetEngineCapsCacheFilters(SwFilterPipe &swFilterPipe, std::vector<SwFilter *> &filters)
+{
+    VP_FUNC_CALL();
+
+    uint32_t inputSurfCount  = swFilterPipe.GetSurfaceCount(true);
+    uint32_t outputSurfCount = swFilterPipe.GetSurfaceCount(false);
+
+    filters.clear();
+
+    // Single layer pipes are covered by VpPacketReuseManager.
+    if (inputSurfCount <= 1)
+    {
+        return false;
+    }
+
+    for (uint32_t pipeIndex = 0; pipeIndex < inputSurfCount + outputSurfCount; ++pipeIndex)
+    {
+        bool             isInputPipe = pipeIndex < inputSurfCount;
+        SwFilterSubPipe *pipe        = swFilterPipe.GetSwFilterSubPipe(isInputPipe, isInputPipe ? pipeIndex : pipeIndex - inputSurfCount);
+
+        for (auto filterID : m_featurePool)
+        {
+            SwFilter *feature = pipe ? pipe->GetSwFilter(filterID) : nullptr;
+            if (feature)
+            {
+                // Only composition features are cached. Their caps only depend on the filter
+                // params, the hw caps and the sfc/vebox output user settings. Hdr, di and dn
+                // caps also depend on resource manager state or change render target types.
+                switch (filterID)
+                {
+                case FeatureTypeCsc:
+                case FeatureTypeScaling:
+                case FeatureTypeRotMir:
+                case FeatureTypeProcamp:
+                case FeatureTypeLumakey:
+                case FeatureTypeBlending:
+                case FeatureTypeColorFill:
+                case FeatureTypeAlpha:
+                    break;
+                default:
+                    filters.clear();
+                    return false;
+                }
+
+                // Engine caps already assigned means a later pass of the same frame.
+                if (feature->GetFilterEngineCaps().value != 0)
+                {
+                    filters.clear();
+                    return false;
+                }
+            }
+            filters.push_back(feature);
+        }
+    }
+
+    return true;
+}
+
+Policy::ENGINE_CAPS_CACHE_ENTRY *Policy::FindEngineCapsCacheEntry(uint32_t inputPipeCount, uint32_t outputPipeCount, std::vector<SwFilter *> &filters)
+{
+    VP_FUNC_CALL();
+
+    for (auto it = m_engineCapsCache.begin(); it != m_engineCapsCache.end(); ++it)
+    {
+        if (it->inputPipeCount != inputPipeCount || it->outputPipeCount != outputPipeCount ||
+            it->key.size() != filters.size())
+        {
+            continue;
+        }
+
+        bool matched = true;
+        for (uint32_t i = 0; i < filters.size() && matched; ++i)
+        {
+            if (nullptr == filters[i] || nullptr == it->key[i])
+            {
+                matched = filters[i] == it->key[i];
+            }
+            else
+            {
+                matched = *it->key[i] == *filters[i];
+            }
+        }
+
+        if (matched)
+        {
+            if (it != m_engineCapsCache.begin())
+            {
+                ENGINE_CAPS_CACHE_ENTRY entry = *it;
+                m_engineCapsCache.erase(it);
+                m_engineCapsCache.insert(m_engineCapsCache.begin(), entry);
+            }
+            return &m_engineCapsCache.front();
+        }
+    }
+
+    return nullptr;
+}
+
+MOS_STATUS Policy::RestoreEngineCaps(ENGINE_CAPS_CACHE_ENTRY &entry, std::vector<SwFilter *> &filters)
+{
+    VP_FUNC_CALL();
+
+    VP_PUBLIC_CHK_VALUE_RETURN(entry.evaluated.size(), filters.size());
+
+    for (uint32_t i = 0; i < filters.size(); ++i)
+    {
+        if (nullptr == filters[i])
+        {
+            continue;
+        }
+        VP_PUBLIC_CHK_NULL_RETURN(entry.evaluated[i]);
+
+        filters[i]->GetFilterEngineCaps() = entry.evaluated[i]->GetFilterEngineCaps();
+
+        // GetScalingExecutionCaps is the only cached caps query which updates the filter params.
+        if (FeatureTypeScaling == filters[i]->GetFeatureType())
+        {
+            SwFilterScaling *scaling       = dynamic_cast<SwFilterScaling *>(filters[i]);
+            SwFilterScaling *scalingCached = dynamic_cast<SwFilterScaling *>(entry.evaluated[i]);
+            VP_PUBLIC_CHK_NULL_RETURN(scaling);
+            VP_PUBLIC_CHK_NULL_RETURN(scalingCached);
+            scaling->GetSwFilterParams() = scalingCached->GetSwFilterParams();
+        }
+
+        PrintFeatureExecutionCaps(__FUNCTION__, filters[i]->GetFilterEngineCaps());
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS Policy::CloneEngineCapsCacheFilters(std::vector<SwFilter *> &filters, std::vector<SwFilter *> &clones, bool withEngineCaps)
+{
+    VP_FUNC_CALL();
+
+    clones.clear();
+
+    for (auto feature : filters)
+    {
+        SwFilter *clone = nullptr;
+        if (feature)
+        {
+            clone = feature->Clone();
+            if (nullptr == clone)
+            {
+                ReleaseEngineCapsCacheFilters(clones);
+                VP_PUBLIC_ASSERTMESSAGE("Clone filter failed for engine caps cache.");
+                return MOS_STATUS_NO_SPACE;
+            }
+            if (withEngineCaps)
+            {
+                clone->GetFilterEngineCaps() = feature->GetFilterEngineCaps();
+            }
+        }
+        clones.push_back(clone);
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+void Policy::ReleaseEngineCapsCacheFilters(std::vector<SwFilter *> &clones)
+{
+    VP_FUNC_CALL();
+
+    for (auto clone : clones)
+    {
+        if (clone)
+        {
+            SwFilterFeatureHandler *handler = m_vpInterface.GetSwFilterHandler(clone->GetFeatureType());
+            if (handler)
+            {
+                handler->Destory(clone);
+            }
+        }
+    }
+    clones.clear();
+}
+
+void Policy::AddEngineCapsCacheEntry(ENGINE_CAPS_CACHE_ENTRY &entry)
+{
+    VP_FUNC_CALL();
+
+    if (m_engineCapsCache.size() >= m_engineCapsCacheSize)
+    {
+        ReleaseEngineCapsCacheFilters(m_engineCapsCache.back().key);
+        ReleaseEngineCapsCacheFilters(m_engineCapsCache.back().evaluated);
+        m_engineCapsCache.pop_back();
+    }
+
+    m_engineCapsCache.insert(m_engineCapsCache.begin(), entry);
+}
+
+void Policy::ClearEngineCapsCache()
+{
+    VP_FUNC_CALL();
+
+    for (auto &entry : m_engineCapsCache)
+    {
+        ReleaseEngineCapsCacheFilters(entry.key);
+        ReleaseEngineCapsCacheFilters(entry.evaluated);
+    }
+    m_engineCapsCache.clear();
+}
+
 MOS_STATUS Policy::GetExecutionCapsForSingleFeature(FeatureType featureType, SwFilterSubPipe& swFilterPipe, VP_EngineEntry& engineCapsCombined)
 {
     VP_FUNC_CALL();
@@ -1747,13 +1996,18 @@ MOS_STATUS Policy::GetHdrExecutionCaps(SwFilter *feature)
 
     if (Is3DLutKernelSupported())
     {
-        if (hdrParams->uiMaxContentLevelLum != m_savedMaxCLL || hdrParams->uiMaxDisplayLum != m_savedMaxDLL ||
-            hdrParams->hdrMode != m_savedHdrMode)
-        {
-            m_savedMaxCLL = hdrParams->uiMaxContentLevelLum;
-            m_savedMaxDLL = hdrParams->uiMaxDisplayLum;
-            m_savedHdrMode = hdrParams->hdrMode;
+        VP_3DLUT_CACHE_KEY lutKey = {};
+        bool is3DLutTableFilled   = false;
+
+        lutKey.maxDisplayLum      = hdrParams->uiMaxDisplayLum;
+        lutKey.maxContentLevelLum = hdrParams->uiMaxContentLevelLum;
+        lutKey.hdrMode            = hdrParams->hdrMode;
 
+        VP_PUBLIC_CHK_NULL_RETURN(m_vpInterface.GetResourceManager());
+        VP_PUBLIC_CHK_STATUS_RETURN(m_vpInterface.GetResourceManager()->Select3DLutTable(lutKey, is3DLutTableFilled));
+
+        if (!is3DLutTableFilled)
+        {
             hdrParams->stage         = HDR_STAGE_3DLUT_KERNEL;
             pHDREngine->bEnabled     = 1;
             pHDREngine->isolated     = 1;
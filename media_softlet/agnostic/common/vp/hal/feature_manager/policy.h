@@ -49,6 +49,12 @@ namespace vp
 
 class VpInterface;
 
+struct VP_ENGINE_CAPS_CACHE_STATISTICS
+{
+    uint32_t hitCount  = 0;    //!< Multi-layer pipes which reused cached engine caps.
+    uint32_t missCount = 0;    //!< Multi-layer pipes which went through BuildExecutionEngines.
+};
+
 class Policy
 {
 public:
@@ -73,6 +79,11 @@ public:
         return m_featurePool;
     }
 
+    const VP_ENGINE_CAPS_CACHE_STATISTICS &GetEngineCapsCacheStatistics() const
+    {
+        return m_engineCapsCacheStatistics;
+    }
+
 protected:
     virtual MOS_STATUS RegisterFeatures();
     virtual void UnregisterFeatures();
@@ -85,6 +96,27 @@ protected:
     MOS_STATUS ReleaseHwFilterParam(HW_FILTER_PARAMS &params);
     MOS_STATUS InitExecuteCaps(VP_EXECUTE_CAPS &caps, VP_EngineEntry &engineCapsInputPipe, VP_EngineEntry &engineCapsOutputPipe);
     MOS_STATUS GetExecuteCaps(SwFilterPipe& subSwFilterPipe, HW_FILTER_PARAMS& params);
+
+    //!
+    //! \brief    Engine caps evaluated for one multi-layer pipe
+    //! \details  Filters are stored per sub pipe in m_featurePool order, with nullptr
+    //!           for features not in the sub pipe. Surfaces are not part of the key.
+    //!
+    struct ENGINE_CAPS_CACHE_ENTRY
+    {
+        uint32_t                inputPipeCount  = 0;
+        uint32_t                outputPipeCount = 0;
+        std::vector<SwFilter *> key;          //!< Filter clones taken before BuildExecutionEngines.
+        std::vector<SwFilter *> evaluated;    //!< Filter clones with params and engine caps after BuildExecutionEngines.
+    };
+
+    bool GetEngineCapsCacheFilters(SwFilterPipe &swFilterPipe, std::vector<SwFilter *> &filters);
+    ENGINE_CAPS_CACHE_ENTRY *FindEngineCapsCacheEntry(uint32_t inputPipeCount, uint32_t outputPipeCount, std::vector<SwFilter *> &filters);
+    MOS_STATUS RestoreEngineCaps(ENGINE_CAPS_CACHE_ENTRY &entry, std::vector<SwFilter *> &filters);
+    MOS_STATUS CloneEngineCapsCacheFilters(std::vector<SwFilter *> &filters, std::vector<SwFilter *> &clones, bool withEngineCaps);
+    void ReleaseEngineCapsCacheFilters(std::vector<SwFilter *> &clones);
+    void AddEngineCapsCacheEntry(ENGINE_CAPS_CACHE_ENTRY &entry);
+    void ClearEngineCapsCache();
     MOS_STATUS Update3DLutoutputColorAndFormat(FeatureParamCsc *cscParams, FeatureParamHdr *hdrParams, MOS_FORMAT Format, VPHAL_CSPACE CSpace);
     MOS_STATUS GetCSCExecutionCapsHdr(SwFilter *hdr, SwFilter *csc);
     MOS_STATUS GetCSCExecutionCapsDi(SwFilter* feature);
@@ -188,10 +220,10 @@ protected:
     VP_HW_CAPS          m_hwCaps = {};
     bool                m_initialized = false;
 
-    // HDR 3DLut Parameters
-    uint32_t            m_savedMaxDLL   = 1000;
-    uint32_t            m_savedMaxCLL   = 4000;
-    VPHAL_HDR_MODE      m_savedHdrMode  = VPHAL_HDR_MODE_NONE;
+    // Most recently used entry first.
+    std::vector<ENGINE_CAPS_CACHE_ENTRY> m_engineCapsCache;
+    VP_ENGINE_CAPS_CACHE_STATISTICS      m_engineCapsCacheStatistics = {};
+    static const uint32_t                m_engineCapsCacheSize = 4;
 
     //!
     //! \brief    Check whether Alpha Supported
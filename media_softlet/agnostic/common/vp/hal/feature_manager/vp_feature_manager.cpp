@@ -42,8 +42,9 @@ VpFeatureManagerNext::VpFeatureManagerNext(VpInterface &vpInterface) :
 
 VpFeatureManagerNext::~VpFeatureManagerNext()
 {
-    UnregisterFeatures();
+    // Policy returns its cached filters to the sw filter handlers.
     MOS_Delete(m_policy);
+    UnregisterFeatures();
 }
 
 MOS_STATUS VpFeatureManagerNext::Init(void* settings)
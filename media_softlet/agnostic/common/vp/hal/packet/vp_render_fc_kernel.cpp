@@ -1263,6 +1263,12 @@ MOS_STATUS VpRenderFcKernel::GetKernelEntry(Kdll_CacheEntry &entry)
         }
     }
 
+    if (!kernelEntry)
+    {
+        // Try persistent kernel cache before searching and building the kernel
+        kernelEntry = KernelDll_LoadCombinedKernel(kernelDllState, &m_kernelSearch, m_searchFilter, filterSize, kernelHash);
+    }
+
     if (!kernelEntry || kernelEntryUpdate)
     {
         Kdll_SearchState *pSearchState = &m_kernelSearch;
@@ -35,6 +35,7 @@ set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/vp_feature_report.h
     ${CMAKE_CURRENT_LIST_DIR}/vp_base.h
     ${CMAKE_CURRENT_LIST_DIR}/vp_packet_reuse_manager.h
+    ${CMAKE_CURRENT_LIST_DIR}/vp_packet_pipe_cache.h
 )
 
 set(SOFTLET_VP_SOURCES_
@@ -69,6 +69,8 @@ public:
         bool                          diScdMode           = false;                        //!< Scene change detection
         VPHAL_HDR_MODE                hdrMode             = VPHAL_HDR_MODE_NONE;          //!< HDR mode
         bool                          packetReused        = false;                        //!< true if packet reused.
+        uint32_t                      packetReuseHits     = 0;                            //!< Frames which reused the cached packet pipe.
+        uint32_t                      packetReuseMisses   = 0;                            //!< Frames which went through policy evaluation.
     };
 
     virtual ~VpFeatureReport(){};
@@ -0,0 +1,149 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     vp_packet_pipe_cache.h
+//! \brief    Defines the slots of packet pipes kept for reuse
+//!           by Teams and 1:N workloads, one slot per set of feature params.
+//!
+
+#ifndef __VP_PACKET_PIPE_CACHE_H__
+#define __VP_PACKET_PIPE_CACHE_H__
+
+#include <map>
+#include "mos_defs.h"
+#include "media_class_trace.h"
+
+namespace vp
+{
+
+class PacketPipe;
+
+//!
+//! \brief  Packet pipes cached by slot index.
+//! \details The feature params of each slot are kept by the feature reuse objects
+//!          under the same index. Slots are filled and replaced round robin.
+//!
+class VpPacketPipeCache
+{
+public:
+    VpPacketPipeCache(uint32_t maxSize) : m_maxSize(maxSize) {}
+
+    //!
+    //! \brief  Find the first slot whose feature params match
+    //! \param  [in] match
+    //!         Called with each slot index, returns true if the params of the slot match
+    //! \param  [out] index
+    //!         Index of the matched slot
+    //! \return bool
+    //!         true if a slot matched
+    //!
+    template <typename Match>
+    bool Find(Match match, uint32_t &index) const
+    {
+        for (auto &it : m_pipes)
+        {
+            if (match(it.first))
+            {
+                index = it.first;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //!
+    //! \brief  Slot which params of a new pipe are stored to
+    //!
+    uint32_t GetNextIndex() const
+    {
+        return m_nextIndex;
+    }
+
+    PacketPipe *GetPipe(uint32_t index) const
+    {
+        auto it = m_pipes.find(index);
+        return it == m_pipes.end() ? nullptr : it->second;
+    }
+
+    //!
+    //! \brief  Store pipe to the next slot
+    //! \param  [in] pipe
+    //!         Pipe to be cached
+    //! \return PacketPipe *
+    //!         Pipe which was in the slot before, to be returned to the factory by caller
+    //!
+    PacketPipe *Add(PacketPipe *pipe)
+    {
+        PacketPipe *replaced = GetPipe(m_nextIndex);
+        m_pipes[m_nextIndex] = pipe;
+
+        if (++m_nextIndex >= m_maxSize)
+        {
+            m_nextIndex = 0;
+        }
+        return replaced;
+    }
+
+    bool Contains(PacketPipe *pipe) const
+    {
+        for (auto &it : m_pipes)
+        {
+            if (it.second == pipe)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //!
+    //! \brief  Remove all pipes
+    //! \param  [in] release
+    //!         Called with each cached pipe
+    //!
+    template <typename Release>
+    void Clear(Release release)
+    {
+        for (auto &it : m_pipes)
+        {
+            release(it.second);
+        }
+        m_pipes.clear();
+        m_nextIndex = 0;
+    }
+
+    uint32_t GetSize() const
+    {
+        return (uint32_t)m_pipes.size();
+    }
+
+protected:
+    std::map<uint32_t, PacketPipe *> m_pipes;
+    uint32_t                         m_nextIndex = 0;
+    uint32_t                         m_maxSize   = 0;
+
+MEDIA_CLASS_DEFINE_END(vp__VpPacketPipeCache)
+};
+
+}  // namespace vp
+
+#endif // __VP_PACKET_PIPE_CACHE_H__
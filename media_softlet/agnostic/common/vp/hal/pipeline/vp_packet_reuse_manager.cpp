@@ -687,22 +687,23 @@ MOS_STATUS VpProcampReuse::UpdateFeatureParams(FeatureParamProcamp &params)
 /*******************************************************************/
 
 VpPacketReuseManager::VpPacketReuseManager(PacketPipeFactory &packetPipeFactory, VpUserFeatureControl &userFeatureControl) :
-    m_packetPipeFactory(packetPipeFactory), m_disablePacketReuse(userFeatureControl.IsPacketReuseDisabled())
+    m_packetPipeFactory(packetPipeFactory), m_disablePacketReuse(userFeatureControl.IsPacketReuseDisabled()),
+    m_pipeReusedCache(MaxTeamsPacketSize)
 {
-    m_pipeReused_TeamsPacket.clear();
     m_enablePacketReuseTeamsAlways = userFeatureControl.IsPacketReuseEnabledTeamsAlways();
 }
 
 VpPacketReuseManager::~VpPacketReuseManager()
 {
-    for (uint32_t index = 0; index < m_pipeReused_TeamsPacket.size(); index++)
-    {
-        if (m_pipeReused_TeamsPacket.find(index)->second != m_pipeReused)
+    VP_PUBLIC_NORMALMESSAGE("Packet reuse statistics: hit %u, miss %u, multi-layer %u.",
+        m_statistics.hitCount, m_statistics.missCount, m_statistics.multiLayerCount);
+
+    m_pipeReusedCache.Clear([&](PacketPipe *pipe) {
+        if (pipe != m_pipeReused)
         {
-            m_packetPipeFactory.ReturnPacketPipe(m_pipeReused_TeamsPacket.find(index)->second);
+            m_packetPipeFactory.ReturnPacketPipe(pipe);
         }
-    }
-    m_pipeReused_TeamsPacket.clear();
+    });
 
     if (m_pipeReused)
     {
@@ -769,7 +770,6 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
 {
     VP_FUNC_CALL();
     bool reusableOfLastPipe = m_reusable;
-    bool foundPipe          = false;
     uint32_t index          = 0;
 
     m_reusable = true;
@@ -786,10 +786,9 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
         m_reusable = false;
         VP_PUBLIC_NORMALMESSAGE("Not reusable for multi-layer cases.");
 
-        if (m_pipeReused)
-        {
-            m_packetPipeFactory.ReturnPacketPipe(m_pipeReused);
-        }
+        ReleasePipeReused();
+        ++m_statistics.missCount;
+        ++m_statistics.multiLayerCount;
 
         return MOS_STATUS_SUCCESS;
     }
@@ -811,6 +810,7 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
         {
             m_reusable = false;
             isPacketPipeReused = false;
+            ++m_statistics.missCount;
             return MOS_STATUS_SUCCESS;
         }
         bool reused = false;
@@ -866,74 +866,48 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
         SwFilter *csc     = pipe.GetSwFilter(true, 0, FeatureTypeCsc);
         SwFilter *rot     = pipe.GetSwFilter(true, 0, FeatureTypeRotMir);
 
-        bool reused = false;
-
         auto scalingreuse = m_features.find(FeatureTypeScaling);
         auto cscreuse     = m_features.find(FeatureTypeCsc);
         auto rotreuse     = m_features.find(FeatureTypeRotMir);
 
-        for (index = 0; index < m_pipeReused_TeamsPacket.size(); index++)
-        {
-            scalingreuse->second->CheckTeamsParams(reusableOfLastPipe, reused, scaling, index);
-            if (!reused)
-            {
-                continue;
-            }
-
-            cscreuse->second->CheckTeamsParams(reusableOfLastPipe, reused, csc, index);
-            if (!reused)
+        auto match = [&](uint32_t slot) {
+            bool reused = false;
+            scalingreuse->second->CheckTeamsParams(reusableOfLastPipe, reused, scaling, slot);
+            if (reused)
             {
-                continue;
+                cscreuse->second->CheckTeamsParams(reusableOfLastPipe, reused, csc, slot);
             }
-
-            rotreuse->second->CheckTeamsParams(reusableOfLastPipe, reused, rot, index);
             if (reused)
             {
-                break;
+                rotreuse->second->CheckTeamsParams(reusableOfLastPipe, reused, rot, slot);
             }
-        }
+            return reused;
+        };
+
         // if not found, store the new params and packet
-        if (!reused)
+        if (!m_pipeReusedCache.Find(match, index))
         {
-            scalingreuse->second->StoreTeamsParams(scaling, curIndex);
-            cscreuse->second->StoreTeamsParams(csc, curIndex);
-            rotreuse->second->StoreTeamsParams(rot, curIndex);
+            uint32_t nextIndex = m_pipeReusedCache.GetNextIndex();
+            scalingreuse->second->StoreTeamsParams(scaling, nextIndex);
+            cscreuse->second->StoreTeamsParams(csc, nextIndex);
+            rotreuse->second->StoreTeamsParams(rot, nextIndex);
 
             m_TeamsPacket_reuse = false;
 
-            foundPipe = false;
-            for (index = 0; index < m_pipeReused_TeamsPacket.size(); index++)
-            {
-                if (m_pipeReused == m_pipeReused_TeamsPacket.find(index)->second)
-                {
-                    foundPipe = true;
-                    break;
-                }
-            }
-
-            if (foundPipe == false)
-            {
-                if (m_pipeReused)
-                {
-                    m_packetPipeFactory.ReturnPacketPipe(m_pipeReused);
-                }
-            }
-            else
-            {
-                m_pipeReused = nullptr;
-            }
+            ReleasePipeReused();
+            ++m_statistics.missCount;
 
             return MOS_STATUS_SUCCESS;
         }
         else
         {
-            auto pipe_TeamsPacket = m_pipeReused_TeamsPacket.find(index);
+            PacketPipe *pipe_TeamsPacket = m_pipeReusedCache.GetPipe(index);
+            VP_PUBLIC_CHK_NULL_RETURN(pipe_TeamsPacket);
 
-            VpCmdPacket *packet = pipe_TeamsPacket->second->GetPacket(0);
+            VpCmdPacket *packet = pipe_TeamsPacket->GetPacket(0);
             VP_PUBLIC_CHK_NULL_RETURN(packet);
 
-
-            m_pipeReused = pipe_TeamsPacket->second;
+            m_pipeReused = pipe_TeamsPacket;
 
             VP_SURFACE_SETTING surfSetting = {};
             VP_EXECUTE_CAPS    caps        = packet->GetExecuteCaps();
@@ -956,6 +930,7 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
 
             m_TeamsPacket_reuse = true;
             isPacketPipeReused  = true;
+            ++m_statistics.hitCount;
             return MOS_STATUS_SUCCESS;
         }
     }
@@ -965,27 +940,8 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
         // m_pipeReused will be udpated in UpdatePacketPipeConfig.
         VP_PUBLIC_NORMALMESSAGE("Packet cannot be reused.");
 
-        foundPipe = false;
-        for (index = 0; index < m_pipeReused_TeamsPacket.size(); index++)
-        {
-            if (m_pipeReused == m_pipeReused_TeamsPacket.find(index)->second)
-            {
-                foundPipe = true;
-                break;
-            }
-        }
-
-        if (foundPipe == false)
-        {
-            if (m_pipeReused)
-            {
-                m_packetPipeFactory.ReturnPacketPipe(m_pipeReused);
-            }
-        }
-        else
-        {
-            m_pipeReused = nullptr;
-        }
+        ReleasePipeReused();
+        ++m_statistics.missCount;
 
         return MOS_STATUS_SUCCESS;
     }
@@ -1020,9 +976,26 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
         VP_PUBLIC_CHK_STATUS_RETURN(it.second->UpdatePacket(swfilter, packet));
     }
 
+    ++m_statistics.hitCount;
+
     return MOS_STATUS_SUCCESS;
 }
 
+void VpPacketReuseManager::ReleasePipeReused()
+{
+    if (m_pipeReusedCache.Contains(m_pipeReused))
+    {
+        // Owned by the Teams packet cache, which releases it on destruction.
+        m_pipeReused = nullptr;
+        return;
+    }
+
+    if (m_pipeReused)
+    {
+        m_packetPipeFactory.ReturnPacketPipe(m_pipeReused);
+    }
+}
+
 // Be called for not reused case before packet pipe execution.
 MOS_STATUS VpPacketReuseManager::UpdatePacketPipeConfig(PacketPipe *&pipe)
 {
@@ -1057,20 +1030,8 @@ MOS_STATUS VpPacketReuseManager::UpdatePacketPipeConfig(PacketPipe *&pipe)
 
     if (m_TeamsPacket && !m_TeamsPacket_reuse)
     {
-        auto it = m_pipeReused_TeamsPacket.find(curIndex);
-        if (it != m_pipeReused_TeamsPacket.end())
-        {
-            m_packetPipeFactory.ReturnPacketPipe(it->second);
-            m_pipeReused_TeamsPacket.erase(curIndex);
-        }
-
-        m_pipeReused_TeamsPacket.insert(std::make_pair(curIndex, pipe));
-
-        curIndex++;
-        if (curIndex >= MaxTeamsPacketSize)
-        {
-            curIndex = 0;
-        }
+        PacketPipe *replaced = m_pipeReusedCache.Add(pipe);
+        m_packetPipeFactory.ReturnPacketPipe(replaced);
     }
 
     if (!m_TeamsPacket)
@@ -32,6 +32,7 @@
 #include "media_class_trace.h"
 #include "sw_filter.h"
 #include "vp_packet_pipe.h"
+#include "vp_packet_pipe_cache.h"
 
 namespace vp
 {
@@ -222,6 +223,13 @@ protected:
     MEDIA_CLASS_DEFINE_END(vp__VpProcampReuse)
 };
 
+struct VP_PACKET_REUSE_STATISTICS
+{
+    uint32_t hitCount        = 0;    //!< Frames executed with the cached packet pipe.
+    uint32_t missCount       = 0;    //!< Frames which went through policy and packet creation.
+    uint32_t multiLayerCount = 0;    //!< Misses caused by multi-layer pipes, which are never cached.
+};
+
 class VpPacketReuseManager
 {
 public:
@@ -235,19 +243,26 @@ public:
     {
         return m_pipeReused;
     }
+    const VP_PACKET_REUSE_STATISTICS &GetStatistics() const
+    {
+        return m_statistics;
+    }
 
 protected:
+    // Drop m_pipeReused if it is not owned by the Teams packet cache.
+    void ReleasePipeReused();
+
     bool m_reusable = false;    // Current parameter can be reused.
     PacketPipe *m_pipeReused = nullptr;
     std::map<FeatureType, VpFeatureReuseBase *> m_features;
     PacketPipeFactory &m_packetPipeFactory;
     bool m_disablePacketReuse = false;
-    uint32_t curIndex = 0;
-    uint32_t MaxTeamsPacketSize = 16;    // max 16 Teams Packet stored
+    static const uint32_t MaxTeamsPacketSize = 16;    // max 16 Teams Packet stored
     bool m_TeamsPacket = false;
     bool m_TeamsPacket_reuse = false;
     bool m_enablePacketReuseTeamsAlways = false;
-    std::map<uint32_t, PacketPipe *> m_pipeReused_TeamsPacket;
+    VpPacketPipeCache m_pipeReusedCache;    // Packets of Teams and 1:N workloads, one per output.
+    VP_PACKET_REUSE_STATISTICS m_statistics = {};
 MEDIA_CLASS_DEFINE_END(vp__VpPacketReuseManager)
 };
 
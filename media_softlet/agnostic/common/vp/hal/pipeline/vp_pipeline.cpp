@@ -162,6 +162,13 @@ MOS_STATUS VpPipeline::UserFeatureReport()
             m_reporting->GetFeatures().outputPipeMode = m_vpPipeContexts[0]->GetOutputPipe();
             m_reporting->GetFeatures().veFeatureInUse = m_vpPipeContexts[0]->IsVeboxInUse();
             m_reporting->GetFeatures().packetReused   = m_vpPipeContexts[0]->IsPacketReUsed();
+
+            VpPacketReuseManager *packetReuseMgr = m_vpPipeContexts[0]->GetPacketReUseManager();
+            if (packetReuseMgr)
+            {
+                m_reporting->GetFeatures().packetReuseHits   = packetReuseMgr->GetStatistics().hitCount;
+                m_reporting->GetFeatures().packetReuseMisses = packetReuseMgr->GetStatistics().missCount;
+            }
         }
 
         if (m_mmc)
@@ -462,7 +469,9 @@ MOS_STATUS VpPipeline::ExecuteSingleswFilterPipe(VpSinglePipeContext *singlePipe
 
     bool isPacketPipeReused = false;
     VP_PUBLIC_CHK_NULL_RETURN(m_pvpParams.renderParams);
-    VP_PUBLIC_CHK_STATUS_RETURN(chkStatusHandler(packetReuseMgr->PreparePacketPipeReuse(pipe, *policy, *resourceManager, isPacketPipeReused, m_pvpParams.renderParams->bOptimizeCpuTiming)));
+    // 1:N outputs use the same multi-packet cache as Teams workloads.
+    bool isMultiPacketReuse = m_pvpParams.renderParams->bOptimizeCpuTiming || m_pvpParams.renderParams->bMultiOutput;
+    VP_PUBLIC_CHK_STATUS_RETURN(chkStatusHandler(packetReuseMgr->PreparePacketPipeReuse(pipe, *policy, *resourceManager, isPacketPipeReused, isMultiPacketReuse)));
 
     if (isPacketPipeReused)
     {
@@ -482,6 +491,7 @@ MOS_STATUS VpPipeline::ExecuteSingleswFilterPipe(VpSinglePipeContext *singlePipe
 
         if (MOS_SUCCEEDED(eStatus))
         {
+            resourceManager->Commit3DLutTable();
             VP_PUBLIC_CHK_STATUS_RETURN(chkStatusHandler(UpdateExecuteStatus(frameCounter)));
         }
 
@@ -515,6 +525,8 @@ MOS_STATUS VpPipeline::ExecuteSingleswFilterPipe(VpSinglePipeContext *singlePipe
 
     if (MOS_SUCCEEDED(eStatus))
     {
+        // 3DLut table generated in this pipe can be reused from now on.
+        resourceManager->Commit3DLutTable();
         VP_PUBLIC_CHK_STATUS_RETURN(chkStatusHandler(packetReuseMgr->UpdatePacketPipeConfig(pPacketPipe)));
         VP_PUBLIC_CHK_STATUS_RETURN(chkStatusHandler(UpdateExecuteStatus(frameCounter)));
     }
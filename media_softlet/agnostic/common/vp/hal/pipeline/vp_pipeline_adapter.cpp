@@ -159,6 +159,10 @@ MOS_STATUS VpPipelineAdapter::Render(PCVPHAL_RENDER_PARAMS pcRenderParams)
             }
             // default render of video
             params.bIsDefaultStream = true;
+            // Outputs of the same source alternate every frame, which keeps
+            // the single packet cache from ever hitting. Let the packet reuse
+            // manager keep one packet per output instead.
+            params.bMultiOutput = true;
 
             eStatus = Execute(&params);
             if (MOS_FAILED(eStatus))
@@ -40,6 +40,9 @@
 
 #endif  // EMUL | VPHAL_LIB
 
+#include <fcntl.h>  // for persistent kernel cache
+#include <stdio.h>
+#include <string.h>
 #include "hal_kerneldll_next.h"
 #include "vp_utils.h"
 
@@ -3321,6 +3324,209 @@ bool KernelDll_SortRuleTable(Kdll_State *pState)
     return true;
 }
 
+//---------------------------------------------------------------------------------------
+// Persistent combined kernel cache
+//
+//    Combined kernels are saved one per file, named after the signature of the
+//    component kernels/rules and one of DL_DISK_CACHE_MAX_FILES slots picked by the
+//    filter hash, so the cache holds at most DL_DISK_CACHE_MAX_FILES files per driver
+//    build. Files are written to a thread private temporary file and renamed into
+//    place, so concurrent writers either see a complete file or no file at all.
+//    The cache directory must be private to the current user, and only files owned
+//    by the current user are loaded. Every file is validated (magic, version,
+//    layout, signature, checksum and original filter) before use.
+//-----------------------------------------------------------------------------------------
+#define DL_DISK_CACHE_MAGIC   0x4c4c444b  // 'KDLL'
+#define DL_DISK_CACHE_VERSION 1
+#define DL_DISK_CACHE_LAYOUT  ((uint32_t)((sizeof(Kdll_FilterEntry) << 16) | sizeof(Kdll_CSC_Params)))
+
+typedef struct tagKdll_DiskCacheHeader
+{
+    uint32_t dwMagic;           // DL_DISK_CACHE_MAGIC
+    uint32_t dwVersion;         // DL_DISK_CACHE_VERSION
+    uint32_t dwLayout;          // DL_DISK_CACHE_LAYOUT
+    uint32_t dwSignature;       // Signature of component kernels and rules
+    uint32_t dwHash;            // Original filter hash
+    int32_t  iFilterSize;       // Original filter size
+    int32_t  iModifiedSize;     // Modified filter size
+    int32_t  iKernelSize;       // Kernel size
+    int32_t  iColorfillCspace;  // Intermediate color space for colorfill
+    uint32_t dwChecksum;        // Checksum of the data following the header
+} Kdll_DiskCacheHeader;
+
+//--------------------------------------------------------------
+// KernelDll_InitDiskCache - Setup persistent combined kernel cache
+//--------------------------------------------------------------
+static void KernelDll_InitDiskCache(
+    Kdll_State           *pState,
+    void                 *pKernelBin,
+    uint32_t              uKernelSize,
+    void                 *pFcPatchCache,
+    uint32_t              uFcPatchCacheSize,
+    const Kdll_RuleEntry *pDefaultRules)
+{
+    const char           *pPath = getenv(DL_DISK_CACHE_ENV);
+    const Kdll_RuleEntry *pRule;
+    uint32_t              dwSignature;
+
+    pState->bDiskCacheEnabled = false;
+
+    // Leave room for the file name
+    if (pPath == nullptr || pPath[0] == '\0' ||
+        strlen(pPath) + 40 >= DL_DISK_CACHE_PATH_LENGTH)
+    {
+        return;
+    }
+
+    // Kernels are loaded from this directory, so nobody else may be able to write to it
+    if (MOS_SecureStrcpy(pState->szDiskCachePath, DL_DISK_CACHE_PATH_LENGTH, pPath) != MOS_STATUS_SUCCESS ||
+        MosUtilities::MosCreatePrivateDirectory(pState->szDiskCachePath) != MOS_STATUS_SUCCESS)
+    {
+        VP_RENDER_NORMALMESSAGE("Persistent kernel cache disabled, '%s' is not a directory private to the current user.", pPath);
+        return;
+    }
+
+    // Kernels built by a different driver (component kernels, patches or rules) must not be reused
+    dwSignature = KernelDll_SimpleHash(pKernelBin, (int32_t)uKernelSize);
+    if (pFcPatchCache && uFcPatchCacheSize)
+    {
+        dwSignature = (dwSignature * 0x1000193) ^ KernelDll_SimpleHash(pFcPatchCache, (int32_t)uFcPatchCacheSize);
+    }
+
+    for (pRule = pDefaultRules; pRule && pRule->id != RID_Op_EOF; pRule++)
+    {
+        // Skip extended rules (variable length)
+        if (RID_IS_EXTENDED(pRule->id))
+        {
+            pRule += pRule->value;
+        }
+    }
+    if (pRule)
+    {
+        dwSignature = (dwSignature * 0x1000193) ^
+                      KernelDll_SimpleHash((void *)pDefaultRules, (int32_t)((pRule - pDefaultRules) * sizeof(Kdll_RuleEntry)));
+    }
+
+    pState->dwDiskCacheSignature = dwSignature ^ DL_DISK_CACHE_VERSION;
+    pState->bDiskCacheEnabled    = true;
+}
+
+//--------------------------------------------------------------
+// KernelDll_GetDiskCacheFileName - Get persistent cache file name for a filter hash
+//--------------------------------------------------------------
+static bool KernelDll_GetDiskCacheFileName(
+    Kdll_State *pState,
+    uint32_t    dwHash,
+    bool        bTemp,
+    char       *pFileName)
+{
+    uint32_t folded_hash;
+    uint32_t slot;
+
+    FOLD_HASH(folded_hash, dwHash)
+    slot = folded_hash % DL_DISK_CACHE_MAX_FILES;
+
+    // Threads of one process may save the same slot at the same time
+    if (bTemp)
+    {
+        return MOS_SecureStringPrint(pFileName, DL_DISK_CACHE_PATH_LENGTH, DL_DISK_CACHE_PATH_LENGTH,
+                   "%s/kdll_%08x_%02x.%d.%u.tmp", pState->szDiskCachePath, pState->dwDiskCacheSignature, slot,
+                   MosUtilities::MosGetPid(), MosUtilities::MosGetCurrentThreadId()) > 0;
+    }
+
+    return MOS_SecureStringPrint(pFileName, DL_DISK_CACHE_PATH_LENGTH, DL_DISK_CACHE_PATH_LENGTH,
+               "%s/kdll_%08x_%02x.bin", pState->szDiskCachePath, pState->dwDiskCacheSignature, slot) > 0;
+}
+
+//--------------------------------------------------------------
+// KernelDll_SaveCombinedKernel - Save kernel into persistent cache
+//--------------------------------------------------------------
+static void KernelDll_SaveCombinedKernel(
+    Kdll_State       *pState,
+    Kdll_CacheEntry  *pCacheEntry,
+    Kdll_FilterEntry *pFilter,
+    int32_t           iFilterSize,
+    uint32_t          dwHash)
+{
+    Kdll_DiskCacheHeader *pHeader;
+    Kdll_CSC_Matrix      *pMatrix;
+    uint8_t              *pData;
+    uint8_t              *ptr;
+    uint32_t              dwDataSize;
+    uint32_t              dwWritten = 0;
+    HANDLE                hFile;
+    char                  szFileName[DL_DISK_CACHE_PATH_LENGTH];
+    char                  szTempName[DL_DISK_CACHE_PATH_LENGTH];
+    int32_t               i;
+
+    if (!pState->bDiskCacheEnabled)
+    {
+        return;
+    }
+
+    // Kernels using procamp are rebuilt whenever procamp parameters change - don't persist them
+    for (i = 0, pMatrix = pCacheEntry->pCscParams->Matrix; i < DL_CSC_MAX; i++, pMatrix++)
+    {
+        if (pMatrix->bInUse && pMatrix->iProcampID != DL_PROCAMP_DISABLED)
+        {
+            return;
+        }
+    }
+
+    if (!KernelDll_GetDiskCacheFileName(pState, dwHash, false, szFileName) ||
+        !KernelDll_GetDiskCacheFileName(pState, dwHash, true, szTempName))
+    {
+        return;
+    }
+
+    dwDataSize = (iFilterSize + pCacheEntry->iFilterSize) * sizeof(Kdll_FilterEntry) +
+                 sizeof(Kdll_CSC_Params) +
+                 pCacheEntry->iSize;
+
+    pData = (uint8_t *)MOS_AllocAndZeroMemory(sizeof(Kdll_DiskCacheHeader) + dwDataSize);
+    if (!pData)
+    {
+        return;
+    }
+
+    // Original filter, modified filter, CSC parameters, kernel
+    ptr = pData + sizeof(Kdll_DiskCacheHeader);
+    MOS_SecureMemcpy(ptr, iFilterSize * sizeof(Kdll_FilterEntry), pFilter, iFilterSize * sizeof(Kdll_FilterEntry));
+    ptr += iFilterSize * sizeof(Kdll_FilterEntry);
+    MOS_SecureMemcpy(ptr, pCacheEntry->iFilterSize * sizeof(Kdll_FilterEntry), pCacheEntry->pFilter, pCacheEntry->iFilterSize * sizeof(Kdll_FilterEntry));
+    ptr += pCacheEntry->iFilterSize * sizeof(Kdll_FilterEntry);
+    MOS_SecureMemcpy(ptr, sizeof(Kdll_CSC_Params), pCacheEntry->pCscParams, sizeof(Kdll_CSC_Params));
+    ptr += sizeof(Kdll_CSC_Params);
+    MOS_SecureMemcpy(ptr, pCacheEntry->iSize, pCacheEntry->pBinary, pCacheEntry->iSize);
+
+    pHeader                   = (Kdll_DiskCacheHeader *)pData;
+    pHeader->dwMagic          = DL_DISK_CACHE_MAGIC;
+    pHeader->dwVersion        = DL_DISK_CACHE_VERSION;
+    pHeader->dwLayout         = DL_DISK_CACHE_LAYOUT;
+    pHeader->dwSignature      = pState->dwDiskCacheSignature;
+    pHeader->dwHash           = dwHash;
+    pHeader->iFilterSize      = iFilterSize;
+    pHeader->iModifiedSize    = pCacheEntry->iFilterSize;
+    pHeader->iKernelSize      = pCacheEntry->iSize;
+    pHeader->iColorfillCspace = pCacheEntry->colorfill_cspace;
+    pHeader->dwChecksum       = KernelDll_SimpleHash(pHeader + 1, (int32_t)dwDataSize);
+
+    // Write thread private file, then atomically replace the cache file
+    if (MosUtilities::MosCreateFile(&hFile, szTempName, O_WRONLY | O_CREAT | O_EXCL) == MOS_STATUS_SUCCESS)
+    {
+        MosUtilities::MosWriteFile(hFile, pData, sizeof(Kdll_DiskCacheHeader) + dwDataSize, &dwWritten, nullptr);
+        MosUtilities::MosCloseHandle(hFile);
+
+        if (dwWritten != sizeof(Kdll_DiskCacheHeader) + dwDataSize ||
+            rename(szTempName, szFileName) != 0)
+        {
+            remove(szTempName);
+        }
+    }
+
+    MOS_FreeMemory(pData);
+}
+
 //---------------------------------------------------------------------------------------
 // KernelDll_AllocateStates - Allocate Kernel Dynamic Linking/Loading (Dll) States
 //
@@ -3416,6 +3622,9 @@ Kdll_State *KernelDll_AllocateStates(
     // Integrate and sort rule tables
     KernelDll_SortRuleTable(pState);
 
+    // Setup persistent combined kernel cache (optional)
+    KernelDll_InitDiskCache(pState, pKernelBin, uKernelSize, pFcPatchCache, uFcPatchCacheSize, pDefaultRules);
+
     // Setup component kernel cache
     pKernelCache->pCache           = (uint8_t *)pKernelBin;
     pKernelCache->iCacheSize       = (int32_t)uKernelSize;
@@ -4217,14 +4426,14 @@ KernelDll_AllocateAdditionalCacheEntries(Kdll_KernelCache *pCache)
 }
 
 //--------------------------------------------------------------
-// KernelDll_AddKernel - Add kernel into hash table and kernel cache
+// KernelDll_CacheKernel - Store kernel into hash table and kernel cache
 //--------------------------------------------------------------
-Kdll_CacheEntry *
-KernelDll_AddKernel(Kdll_State       *pState,           // Kernel Dll state
-                    Kdll_SearchState *pSearchState,     // Search state
-                    Kdll_FilterEntry *pFilter,          // Original filter
-                    int32_t           iFilterSize,      // Original filter size
-                    uint32_t          dwHash)
+static Kdll_CacheEntry *
+KernelDll_CacheKernel(Kdll_State       *pState,           // Kernel Dll state
+                      Kdll_SearchState *pSearchState,     // Search state
+                      Kdll_FilterEntry *pFilter,          // Original filter
+                      int32_t           iFilterSize,      // Original filter size
+                      uint32_t          dwHash)
 {
     Kdll_CacheEntry      *pCacheEntry;
     Kdll_KernelHashTable *pHashTable;
@@ -4311,6 +4520,132 @@ KernelDll_AddKernel(Kdll_State       *pState,           // Kernel Dll state
     return pCacheEntry;
 }
 
+//--------------------------------------------------------------
+// KernelDll_AddKernel - Add kernel into hash table and kernel cache
+//--------------------------------------------------------------
+Kdll_CacheEntry *
+KernelDll_AddKernel(Kdll_State       *pState,           // Kernel Dll state
+                    Kdll_SearchState *pSearchState,     // Search state
+                    Kdll_FilterEntry *pFilter,          // Original filter
+                    int32_t           iFilterSize,      // Original filter size
+                    uint32_t          dwHash)
+{
+    Kdll_CacheEntry *pCacheEntry;
+
+    VP_RENDER_FUNCTION_ENTER;
+
+    pCacheEntry = KernelDll_CacheKernel(pState, pSearchState, pFilter, iFilterSize, dwHash);
+    if (pCacheEntry)
+    {
+        KernelDll_SaveCombinedKernel(pState, pCacheEntry, pFilter, iFilterSize, dwHash);
+    }
+
+    return pCacheEntry;
+}
+
+//--------------------------------------------------------------
+// KernelDll_LoadCombinedKernel - Load kernel from persistent cache
+//                                into hash table and kernel cache
+//--------------------------------------------------------------
+Kdll_CacheEntry *
+KernelDll_LoadCombinedKernel(Kdll_State       *pState,           // Kernel Dll state
+                             Kdll_SearchState *pSearchState,     // Search state (output)
+                             Kdll_FilterEntry *pFilter,          // Original filter
+                             int32_t           iFilterSize,      // Original filter size
+                             uint32_t          dwHash)
+{
+    Kdll_DiskCacheHeader *pHeader;
+    Kdll_CacheEntry      *pCacheEntry = nullptr;
+    uint8_t              *pData       = nullptr;
+    uint8_t              *ptr;
+    uint32_t              dwFileSize  = 0;
+    uint32_t              dwRead      = 0;
+    uint32_t              dwDataSize;
+    HANDLE                hFile;
+    char                  szFileName[DL_DISK_CACHE_PATH_LENGTH];
+
+    VP_RENDER_FUNCTION_ENTER;
+
+    if (!pState || !pSearchState || !pFilter ||
+        !pState->bDiskCacheEnabled ||
+        iFilterSize <= 0 || iFilterSize > DL_MAX_SEARCH_FILTER_SIZE ||
+        !KernelDll_GetDiskCacheFileName(pState, dwHash, false, szFileName))
+    {
+        return nullptr;
+    }
+
+    // Cache miss - file not present
+    if (MosUtilities::MosCreateFile(&hFile, szFileName, O_RDONLY) != MOS_STATUS_SUCCESS)
+    {
+        return nullptr;
+    }
+
+    // Only load regular files written by the current user
+    if (MosUtilities::MosIsFileOwnedByCurrentUser(hFile) &&
+        MosUtilities::MosGetFileSize(hFile, &dwFileSize, nullptr) == MOS_STATUS_SUCCESS &&
+        dwFileSize > sizeof(Kdll_DiskCacheHeader) &&
+        dwFileSize <= sizeof(Kdll_DiskCacheHeader) + 2 * sizeof(Kdll_FilterDesc) + sizeof(Kdll_CSC_Params) + DL_MAX_KERNEL_SIZE)
+    {
+        pData = (uint8_t *)MOS_AllocMemory(dwFileSize);
+        if (pData)
+        {
+            MosUtilities::MosReadFile(hFile, pData, dwFileSize, &dwRead, nullptr);
+        }
+    }
+    MosUtilities::MosCloseHandle(hFile);
+
+    if (!pData || dwRead != dwFileSize)
+    {
+        goto finish;
+    }
+
+    // Validate file
+    pHeader    = (Kdll_DiskCacheHeader *)pData;
+    dwDataSize = dwFileSize - sizeof(Kdll_DiskCacheHeader);
+    if (pHeader->dwMagic != DL_DISK_CACHE_MAGIC ||
+        pHeader->dwVersion != DL_DISK_CACHE_VERSION ||
+        pHeader->dwLayout != DL_DISK_CACHE_LAYOUT ||
+        pHeader->dwSignature != pState->dwDiskCacheSignature ||
+        pHeader->dwHash != dwHash ||
+        pHeader->iFilterSize != iFilterSize ||
+        pHeader->iModifiedSize <= 0 || pHeader->iModifiedSize > DL_MAX_SEARCH_FILTER_SIZE ||
+        pHeader->iKernelSize <= 0 || pHeader->iKernelSize > DL_MAX_KERNEL_SIZE ||
+        dwDataSize != (pHeader->iFilterSize + pHeader->iModifiedSize) * sizeof(Kdll_FilterEntry) +
+                      sizeof(Kdll_CSC_Params) + pHeader->iKernelSize ||
+        pHeader->dwChecksum != KernelDll_SimpleHash(pHeader + 1, (int32_t)dwDataSize))
+    {
+        VP_RENDER_NORMALMESSAGE("Invalid persistent kernel cache file '%s'.", szFileName);
+        goto finish;
+    }
+
+    // Different filter with the same folded hash
+    ptr = (uint8_t *)(pHeader + 1);
+    if (memcmp(ptr, pFilter, iFilterSize * sizeof(Kdll_FilterEntry)) != 0)
+    {
+        goto finish;
+    }
+    ptr += iFilterSize * sizeof(Kdll_FilterEntry);
+
+    // Restore search state as produced by the kernel search/build
+    pSearchState->iFilterSize = pHeader->iModifiedSize;
+    MOS_SecureMemcpy(pSearchState->Filter, sizeof(pSearchState->Filter), ptr, pHeader->iModifiedSize * sizeof(Kdll_FilterEntry));
+    ptr += pHeader->iModifiedSize * sizeof(Kdll_FilterEntry);
+
+    MOS_SecureMemcpy(&pSearchState->CscParams, sizeof(Kdll_CSC_Params), ptr, sizeof(Kdll_CSC_Params));
+    ptr += sizeof(Kdll_CSC_Params);
+
+    pSearchState->KernelSize = pHeader->iKernelSize;
+    MOS_SecureMemcpy(pSearchState->Kernel, sizeof(pSearchState->Kernel), ptr, pHeader->iKernelSize);
+
+    pState->colorfill_cspace = (VPHAL_CSPACE)pHeader->iColorfillCspace;
+
+    pCacheEntry = KernelDll_CacheKernel(pState, pSearchState, pFilter, iFilterSize, dwHash);
+
+finish:
+    MOS_FreeMemory(pData);
+    return pCacheEntry;
+}
+
 //--------------------------------------------------------------
 // KernelDll_ReleaseHashEntry - Release hash table entry
 //--------------------------------------------------------------
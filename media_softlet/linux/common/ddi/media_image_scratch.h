@@ -0,0 +1,136 @@
+/*
+* Copyright (c) 2026, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file     media_image_scratch.h
+//! \brief    Defines the scratch buffer vaGetImage deswizzles surfaces into
+//!
+
+#ifndef __MEDIA_IMAGE_SCRATCH_H__
+#define __MEDIA_IMAGE_SCRATCH_H__
+
+#include <mutex>
+#include <utility>
+#include "mos_utilities.h"
+#include "media_class_trace.h"
+
+//!
+//! \brief  Scratch buffer kept in media context for reuse across image copies
+//! \details The buffer is taken out of the cache while in use, so a concurrent
+//!          caller finds the cache empty and allocates its own buffer instead
+//!          of waiting. On release the larger buffer is kept.
+//!
+class MediaImageScratch
+{
+public:
+    MediaImageScratch() {}
+
+    ~MediaImageScratch()
+    {
+        Free();
+    }
+
+    //!
+    //! \brief  Get a scratch buffer of at least size bytes
+    //! \param  [in] size
+    //!         Required buffer size
+    //! \param  [out] capacity
+    //!         Actual size of the returned buffer, to be passed to Release
+    //! \return uint8_t*
+    //!         Pointer to scratch buffer, nullptr if allocation failed
+    //!
+    uint8_t *Acquire(uint32_t size, uint32_t &capacity)
+    {
+        uint8_t *scratch     = nullptr;
+        uint32_t scratchSize = 0;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            scratch     = m_buffer;
+            scratchSize = m_capacity;
+            m_buffer    = nullptr;
+            m_capacity  = 0;
+        }
+
+        if (scratch != nullptr && scratchSize >= size)
+        {
+            capacity = scratchSize;
+            return scratch;
+        }
+
+        MOS_FreeMemory(scratch);
+        scratch  = (uint8_t *)MOS_AllocMemory(size);
+        capacity = (scratch != nullptr) ? size : 0;
+        return scratch;
+    }
+
+    //!
+    //! \brief  Return a buffer got from Acquire
+    //! \param  [in] scratch
+    //!         Scratch buffer
+    //! \param  [in] capacity
+    //!         Capacity reported by Acquire for this buffer
+    //!
+    void Release(uint8_t *scratch, uint32_t capacity)
+    {
+        if (scratch == nullptr)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_capacity < capacity)
+            {
+                std::swap(m_buffer, scratch);
+                m_capacity = capacity;
+            }
+        }
+
+        MOS_FreeMemory(scratch);
+    }
+
+    //!
+    //! \brief  Free the cached buffer
+    //!
+    void Free()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        MOS_FreeMemory(m_buffer);
+        m_buffer   = nullptr;
+        m_capacity = 0;
+    }
+
+    uint32_t GetCachedCapacity()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_capacity;
+    }
+
+protected:
+    std::mutex m_mutex;
+    uint8_t   *m_buffer   = nullptr;
+    uint32_t   m_capacity = 0;
+
+MEDIA_CLASS_DEFINE_END(MediaImageScratch)
+};
+
+#endif  // __MEDIA_IMAGE_SCRATCH_H__
@@ -44,12 +44,9 @@ DDI_MEDIA_SURFACE* MediaLibvaCommonNext::GetSurfaceFromVASurfaceID(PDDI_MEDIA_CO
     bool validSurface = (id != VA_INVALID_SURFACE);
     if(validSurface)
     {
-        DDI_CHK_LESS(id, mediaCtx->pSurfaceHeap->uiAllocatedHeapElements, "invalid surface id", nullptr);
-        MosUtilities::MosLockMutex(&mediaCtx->SurfaceMutex);
-        surfaceElement  = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)mediaCtx->pSurfaceHeap->pHeapBase;
-        surfaceElement += id;
-        surface         = surfaceElement->pSurface;
-        MosUtilities::MosUnlockMutex(&mediaCtx->SurfaceMutex);
+        surfaceElement = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)GetHeapElement(mediaCtx->pSurfaceHeap, id);
+        DDI_CHK_NULL(surfaceElement, "invalid surface id", nullptr);
+        surface        = __atomic_load_n(&surfaceElement->pSurface, __ATOMIC_ACQUIRE);
     }
 
     return surface;
@@ -286,38 +283,124 @@ DDI_MEDIA_BUFFER* MediaLibvaCommonNext::GetBufferFromVABufferID(
     PDDI_MEDIA_BUFFER              buf = nullptr;
 
     i = (uint32_t)bufferID;
-    DDI_CHK_LESS(i, mediaCtx->pBufferHeap->uiAllocatedHeapElements, "invalid buffer id", nullptr);
-
-    MosUtilities::MosLockMutex(&mediaCtx->BufferMutex);
-    bufHeapElement  = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)mediaCtx->pBufferHeap->pHeapBase;
-    bufHeapElement += i;
-    buf             = bufHeapElement->pBuffer;
-    MosUtilities::MosUnlockMutex(&mediaCtx->BufferMutex);
+    bufHeapElement = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)GetHeapElement(mediaCtx->pBufferHeap, i);
+    DDI_CHK_NULL(bufHeapElement, "invalid buffer id", nullptr);
+    buf            = __atomic_load_n(&bufHeapElement->pBuffer, __ATOMIC_ACQUIRE);
 
     return buf;
 }
 
 void* MediaLibvaCommonNext::GetVaContextFromHeap(
     PDDI_MEDIA_HEAP  mediaHeap,
-    uint32_t         index,
-    PMOS_MUTEX       mutex)
+    uint32_t         index)
 {
     PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT vaCtxHeapElmt = nullptr;
-    void                              *context      = nullptr;
     DDI_FUNC_ENTER;
 
-    MosUtilities::MosLockMutex(mutex);
-    if(nullptr == mediaHeap || index >= mediaHeap->uiAllocatedHeapElements)
+    vaCtxHeapElmt = (PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT)GetHeapElement(mediaHeap, index);
+    if (nullptr == vaCtxHeapElmt)
     {
-        MosUtilities::MosUnlockMutex(mutex);
         return nullptr;
     }
-    vaCtxHeapElmt  = (PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT)mediaHeap->pHeapBase;
-    vaCtxHeapElmt  += index;
-    context        = vaCtxHeapElmt->pVaContext;
-    MosUtilities::MosUnlockMutex(mutex);
 
-    return context;
+    return __atomic_load_n(&vaCtxHeapElmt->pVaContext, __ATOMIC_ACQUIRE);
+}
+
+void* MediaLibvaCommonNext::GetHeapElement(
+    PDDI_MEDIA_HEAP  mediaHeap,
+    uint32_t         index)
+{
+    if (nullptr == mediaHeap)
+    {
+        return nullptr;
+    }
+
+    // GrowHeap stores the new base before the new size, so a base loaded after the
+    // size always covers index. Old bases stay valid until DestroyHeap.
+    uint32_t allocatedHeapElements = __atomic_load_n(&mediaHeap->uiAllocatedHeapElements, __ATOMIC_ACQUIRE);
+    if (index >= allocatedHeapElements)
+    {
+        return nullptr;
+    }
+
+    uint8_t *heapBase = (uint8_t *)__atomic_load_n(&mediaHeap->pHeapBase, __ATOMIC_ACQUIRE);
+    if (nullptr == heapBase)
+    {
+        return nullptr;
+    }
+
+    return heapBase + (size_t)index * mediaHeap->uiHeapElementSize;
+}
+
+void* MediaLibvaCommonNext::GrowHeap(
+    PDDI_MEDIA_HEAP  mediaHeap,
+    uint32_t         &incrementalSize)
+{
+    DDI_CHK_NULL(mediaHeap, "nullptr mediaHeap", nullptr);
+
+    // Doubling keeps the retired bases smaller than the current one in total.
+    incrementalSize = MOS_MAX(mediaHeap->uiAllocatedHeapElements, DDI_MEDIA_HEAP_INCREMENTAL_SIZE);
+
+    size_t oldHeapSize = (size_t)mediaHeap->uiAllocatedHeapElements * mediaHeap->uiHeapElementSize;
+    size_t newHeapSize = oldHeapSize + (size_t)incrementalSize * mediaHeap->uiHeapElementSize;
+
+    PDDI_MEDIA_RETIRED_HEAP_BASE retiredHeapBase = nullptr;
+    if (mediaHeap->pHeapBase)
+    {
+        retiredHeapBase = (PDDI_MEDIA_RETIRED_HEAP_BASE)MOS_AllocAndZeroMemory(sizeof(DDI_MEDIA_RETIRED_HEAP_BASE));
+        DDI_CHK_NULL(retiredHeapBase, "DDI: retired heap allocation failed.", nullptr);
+    }
+
+    void *newHeapBase = MOS_AllocAndZeroMemory(newHeapSize);
+    if (nullptr == newHeapBase)
+    {
+        MOS_FreeMemory(retiredHeapBase);
+        DDI_ASSERTMESSAGE("DDI: heap allocation failed.");
+        return nullptr;
+    }
+
+    if (mediaHeap->pHeapBase)
+    {
+        // The heap only grows once its free list is empty, so no free link points
+        // into the old base and the elements can be copied as they are.
+        MOS_SecureMemcpy(newHeapBase, newHeapSize, mediaHeap->pHeapBase, oldHeapSize);
+
+        retiredHeapBase->pHeapBase   = mediaHeap->pHeapBase;
+        retiredHeapBase->pNext       = mediaHeap->pRetiredHeapBases;
+        mediaHeap->pRetiredHeapBases = retiredHeapBase;
+    }
+
+    __atomic_store_n(&mediaHeap->pHeapBase, newHeapBase, __ATOMIC_RELEASE);
+
+    return newHeapBase;
+}
+
+void MediaLibvaCommonNext::SetHeapSize(
+    PDDI_MEDIA_HEAP  mediaHeap,
+    uint32_t         allocatedHeapElements)
+{
+    DDI_CHK_NULL(mediaHeap, "nullptr mediaHeap", );
+
+    __atomic_store_n(&mediaHeap->uiAllocatedHeapElements, allocatedHeapElements, __ATOMIC_RELEASE);
+}
+
+void MediaLibvaCommonNext::DestroyHeap(PDDI_MEDIA_HEAP mediaHeap)
+{
+    if (nullptr == mediaHeap)
+    {
+        return;
+    }
+
+    while (mediaHeap->pRetiredHeapBases)
+    {
+        PDDI_MEDIA_RETIRED_HEAP_BASE retiredHeapBase = mediaHeap->pRetiredHeapBases;
+        mediaHeap->pRetiredHeapBases                 = retiredHeapBase->pNext;
+        MOS_FreeMemory(retiredHeapBase->pHeapBase);
+        MOS_FreeMemory(retiredHeapBase);
+    }
+
+    MOS_FreeMemory(mediaHeap->pHeapBase);
+    MOS_FreeMemory(mediaHeap);
 }
 
 void* MediaLibvaCommonNext::GetContextFromContextID(
@@ -348,24 +431,24 @@ void* MediaLibvaCommonNext::GetContextFromContextID(
     {
         DDI_VERBOSEMESSAGE("Decode context detected: 0x%x", vaCtxID);
         *ctxType = DDI_MEDIA_CONTEXT_TYPE_DECODER;
-        return GetVaContextFromHeap(mediaCtx->pDecoderCtxHeap, index, &mediaCtx->DecoderMutex);
+        return GetVaContextFromHeap(mediaCtx->pDecoderCtxHeap, index);
     }
     else if ((vaCtxID & DDI_MEDIA_MASK_VACONTEXT_TYPE) == DDI_MEDIA_SOFTLET_VACONTEXTID_ENCODER_OFFSET)
     {
         *ctxType = DDI_MEDIA_CONTEXT_TYPE_ENCODER;
-        return GetVaContextFromHeap(mediaCtx->pEncoderCtxHeap, index, &mediaCtx->EncoderMutex);
+        return GetVaContextFromHeap(mediaCtx->pEncoderCtxHeap, index);
     }
     else if ((vaCtxID & DDI_MEDIA_MASK_VACONTEXT_TYPE) == DDI_MEDIA_SOFTLET_VACONTEXTID_VP_OFFSET)
     {
         *ctxType = DDI_MEDIA_CONTEXT_TYPE_VP;
-        return GetVaContextFromHeap(mediaCtx->pVpCtxHeap, index, &mediaCtx->VpMutex);
+        return GetVaContextFromHeap(mediaCtx->pVpCtxHeap, index);
     }
     else if ((vaCtxID & DDI_MEDIA_MASK_VACONTEXT_TYPE) == DDI_MEDIA_SOFTLET_VACONTEXTID_CP_OFFSET)
     {
         DDI_VERBOSEMESSAGE("Protected session detected: 0x%x", vaCtxID);
         *ctxType = DDI_MEDIA_CONTEXT_TYPE_PROTECTED;
         index = index & DDI_MEDIA_MASK_VAPROTECTEDSESSION_ID;
-        return GetVaContextFromHeap(mediaCtx->pProtCtxHeap, index, &mediaCtx->ProtMutex);
+        return GetVaContextFromHeap(mediaCtx->pProtCtxHeap, index);
     }
     else
     {
@@ -386,12 +469,9 @@ uint32_t MediaLibvaCommonNext::GetCtxTypeFromVABufferID(PDDI_MEDIA_CONTEXT media
     DDI_CHK_NULL(mediaCtx->pBufferHeap, "nullptr mediaCtx->pBufferHeap", VA_STATUS_ERROR_INVALID_PARAMETER);
 
     i = (uint32_t)bufferID;
-    DDI_CHK_LESS(i, mediaCtx->pBufferHeap->uiAllocatedHeapElements, "invalid buffer id", DDI_MEDIA_CONTEXT_TYPE_NONE);
-    MosUtilities::MosLockMutex(&mediaCtx->BufferMutex);
-    bufHeapElement  = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)mediaCtx->pBufferHeap->pHeapBase;
-    bufHeapElement  += i;
-    ctxType = bufHeapElement->uiCtxType;
-    MosUtilities::MosUnlockMutex(&mediaCtx->BufferMutex);
+    bufHeapElement = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)GetHeapElement(mediaCtx->pBufferHeap, i);
+    DDI_CHK_NULL(bufHeapElement, "invalid buffer id", DDI_MEDIA_CONTEXT_TYPE_NONE);
+    ctxType        = __atomic_load_n(&bufHeapElement->uiCtxType, __ATOMIC_ACQUIRE);
 
     return ctxType;
 }
@@ -405,14 +485,10 @@ void* MediaLibvaCommonNext::GetCtxFromVABufferID(PDDI_MEDIA_CONTEXT mediaCtx, VA
     DDI_CHK_NULL(mediaCtx->pBufferHeap, "nullptr mediaCtx->pBufferHeap", nullptr);
 
     i = (uint32_t)bufferID;
-    DDI_CHK_LESS(i, mediaCtx->pBufferHeap->uiAllocatedHeapElements, "invalid buffer id", nullptr);
-    MosUtilities::MosLockMutex(&mediaCtx->BufferMutex);
-    bufHeapElement  = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)mediaCtx->pBufferHeap->pHeapBase;
-    bufHeapElement += i;
-    void *temp      = bufHeapElement->pCtx;
-    MosUtilities::MosUnlockMutex(&mediaCtx->BufferMutex);
-
-    return temp;
+    bufHeapElement = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)GetHeapElement(mediaCtx->pBufferHeap, i);
+    DDI_CHK_NULL(bufHeapElement, "invalid buffer id", nullptr);
+
+    return __atomic_load_n(&bufHeapElement->pCtx, __ATOMIC_ACQUIRE);
 }
 
 int32_t MediaLibvaCommonNext::GetGpuPriority(
@@ -317,12 +317,21 @@ typedef struct _DDI_MEDIA_VACONTEXT_HEAP_ELEMENT
     struct _DDI_MEDIA_VACONTEXT_HEAP_ELEMENT   *pNextFree;
 }DDI_MEDIA_VACONTEXT_HEAP_ELEMENT, *PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT;
 
+// Heap bases replaced by a heap growth. They are kept until the heap is destroyed,
+// so a lookup which loaded the old base without the heap mutex never reads freed memory.
+typedef struct _DDI_MEDIA_RETIRED_HEAP_BASE
+{
+    void                                   *pHeapBase;
+    struct _DDI_MEDIA_RETIRED_HEAP_BASE    *pNext;
+}DDI_MEDIA_RETIRED_HEAP_BASE, *PDDI_MEDIA_RETIRED_HEAP_BASE;
+
 typedef struct _DDI_MEDIA_HEAP
 {
     void               *pHeapBase;
     uint32_t           uiHeapElementSize;
     uint32_t           uiAllocatedHeapElements;
     void               *pFirstFreeHeapElement;
+    PDDI_MEDIA_RETIRED_HEAP_BASE pRetiredHeapBases;
 }DDI_MEDIA_HEAP, *PDDI_MEDIA_HEAP;
 
 #ifndef ANDROID
@@ -460,10 +469,57 @@ public:
     //!         Pointer to ddi media heap
     //! \param  [in] index
     //!         the index
-    //! \param  [in] mutex
-    //!         the mutex
     //!
-    static void* GetVaContextFromHeap(PDDI_MEDIA_HEAP mediaHeap, uint32_t index, PMOS_MUTEX mutex);
+    static void* GetVaContextFromHeap(PDDI_MEDIA_HEAP mediaHeap, uint32_t index);
+
+    //!
+    //! \brief  Get heap element from index without taking the heap mutex
+    //! \details The heap base only changes in GrowHeap, which keeps the old base alive
+    //!          until DestroyHeap. Callers still need the heap mutex to modify the element.
+    //!
+    //! \param  [in] mediaHeap
+    //!         Pointer to ddi media heap
+    //! \param  [in] index
+    //!         Element index, which is the VA ID of the element
+    //!
+    //! \return void*
+    //!     Pointer to the heap element, nullptr if index is out of range
+    //!
+    static void* GetHeapElement(PDDI_MEDIA_HEAP mediaHeap, uint32_t index);
+
+    //!
+    //! \brief  Grow heap when it runs out of free elements
+    //! \details Must be called with the heap mutex held. The heap size doubles, existing
+    //!          elements are copied to the new base and the old base is retired. The caller
+    //!          initializes the new elements and then publishes them with SetHeapSize.
+    //!
+    //! \param  [in] mediaHeap
+    //!         Pointer to ddi media heap
+    //! \param  [out] incrementalSize
+    //!         Number of elements added
+    //!
+    //! \return void*
+    //!     New heap base, nullptr if allocation failed
+    //!
+    static void* GrowHeap(PDDI_MEDIA_HEAP mediaHeap, uint32_t &incrementalSize);
+
+    //!
+    //! \brief  Publish the number of initialized heap elements to lock free lookups
+    //!
+    //! \param  [in] mediaHeap
+    //!         Pointer to ddi media heap
+    //! \param  [in] allocatedHeapElements
+    //!         Number of allocated and initialized elements
+    //!
+    static void SetHeapSize(PDDI_MEDIA_HEAP mediaHeap, uint32_t allocatedHeapElements);
+
+    //!
+    //! \brief  Free heap, its current base and all retired bases
+    //!
+    //! \param  [in] mediaHeap
+    //!         Pointer to ddi media heap
+    //!
+    static void DestroyHeap(PDDI_MEDIA_HEAP mediaHeap);
 
     //!
     //! \brief  Get context from context ID
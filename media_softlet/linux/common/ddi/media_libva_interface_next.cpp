@@ -677,26 +677,13 @@ VAStatus MediaLibvaInterfaceNext::HeapDestroy(PDDI_MEDIA_CONTEXT mediaCtx)
 
     DDI_CHK_NULL(mediaCtx, "nullptr ctx", VA_STATUS_ERROR_INVALID_CONTEXT);
     // destroy heaps
-    MOS_FreeMemory(mediaCtx->pSurfaceHeap->pHeapBase);
-    MOS_FreeMemory(mediaCtx->pSurfaceHeap);
-
-    MOS_FreeMemory(mediaCtx->pBufferHeap->pHeapBase);
-    MOS_FreeMemory(mediaCtx->pBufferHeap);
-
-    MOS_FreeMemory(mediaCtx->pImageHeap->pHeapBase);
-    MOS_FreeMemory(mediaCtx->pImageHeap);
-
-    MOS_FreeMemory(mediaCtx->pDecoderCtxHeap->pHeapBase);
-    MOS_FreeMemory(mediaCtx->pDecoderCtxHeap);
-
-    MOS_FreeMemory(mediaCtx->pEncoderCtxHeap->pHeapBase);
-    MOS_FreeMemory(mediaCtx->pEncoderCtxHeap);
-
-    MOS_FreeMemory(mediaCtx->pVpCtxHeap->pHeapBase);
-    MOS_FreeMemory(mediaCtx->pVpCtxHeap);
-
-    MOS_FreeMemory(mediaCtx->pProtCtxHeap->pHeapBase);
-    MOS_FreeMemory(mediaCtx->pProtCtxHeap);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pSurfaceHeap);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pBufferHeap);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pImageHeap);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pDecoderCtxHeap);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pEncoderCtxHeap);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pVpCtxHeap);
+    MediaLibvaCommonNext::DestroyHeap(mediaCtx->pProtCtxHeap);
 
     // destroy the mutexs
     MediaLibvaUtilNext::DestroyMutex(&mediaCtx->SurfaceMutex);
@@ -707,6 +694,8 @@ VAStatus MediaLibvaInterfaceNext::HeapDestroy(PDDI_MEDIA_CONTEXT mediaCtx)
     MediaLibvaUtilNext::DestroyMutex(&mediaCtx->VpMutex);
     MediaLibvaUtilNext::DestroyMutex(&mediaCtx->ProtMutex);
 
+    mediaCtx->ImageScratch.Free();
+
     //resource checking
     if (mediaCtx->uiNumSurfaces != 0)
     {
@@ -1419,12 +1408,11 @@ VAStatus MediaLibvaInterfaceNext::SyncSurface(
     }
 
     MOS_TraceEventExt(EVENT_VA_SYNC, EVENT_TYPE_INFO, surface->bo? &surface->bo->handle:nullptr, sizeof(uint32_t), nullptr, 0);
-    // check the bo here?
     // zero is a expected return value
-    uint32_t timeout_NS = 100000000;
-    while (0 != mos_gem_bo_wait(surface->bo, timeout_NS))
+    if (0 != MediaLibvaUtilNext::WaitBo(surface->bo, UINT64_MAX))
     {
-        // Just loop while gem_bo_wait times-out.
+        DDI_ASSERTMESSAGE("vaSyncSurface: failed to wait for surface\n\r");
+        return VA_STATUS_ERROR_TIMEDOUT;
     }
 
     MOS_TraceEventExt(EVENT_VA_SYNC, EVENT_TYPE_END, nullptr, 0, nullptr, 0);
@@ -1490,16 +1478,10 @@ VAImage* MediaLibvaInterfaceNext::GetVAImageFromVAImageID(PDDI_MEDIA_CONTEXT med
     DDI_CHK_NULL(mediaCtx, "nullptr mediaCtx", nullptr);
 
     uint32_t i       = (uint32_t)imageID;
-    DDI_CHK_LESS(i, mediaCtx->pImageHeap->uiAllocatedHeapElements, "invalid image id", nullptr);
-    MosUtilities::MosLockMutex(&mediaCtx->ImageMutex);
-
-    PDDI_MEDIA_IMAGE_HEAP_ELEMENT imageElement = (PDDI_MEDIA_IMAGE_HEAP_ELEMENT)mediaCtx->pImageHeap->pHeapBase;
-    imageElement    += i;
-    VAImage *vaImage = imageElement->pImage;
-
-    MosUtilities::MosUnlockMutex(&mediaCtx->ImageMutex);
+    PDDI_MEDIA_IMAGE_HEAP_ELEMENT imageElement = (PDDI_MEDIA_IMAGE_HEAP_ELEMENT)MediaLibvaCommonNext::GetHeapElement(mediaCtx->pImageHeap, i);
+    DDI_CHK_NULL(imageElement, "invalid image id", nullptr);
 
-    return vaImage;
+    return __atomic_load_n(&imageElement->pImage, __ATOMIC_ACQUIRE);
 }
 
 bool MediaLibvaInterfaceNext::DestroyImageFromVAImageID(PDDI_MEDIA_CONTEXT mediaCtx, VAImageID imageID)
@@ -1553,6 +1535,14 @@ void MediaLibvaInterfaceNext::CopyPlane(
     uint32_t srcPitch,
     uint32_t height)
 {
+    if (dstPitch == srcPitch)
+    {
+        // Same stride on both sides, the plane is one contiguous block
+        uint32_t planeSize = dstPitch * height;
+        MOS_SecureMemcpy(dst, planeSize, src, planeSize);
+        return;
+    }
+
     uint32_t rowSize = std::min(dstPitch, srcPitch);
     for (int y = 0; y < height; y += 1)
     {
@@ -1562,6 +1552,30 @@ void MediaLibvaInterfaceNext::CopyPlane(
     }
 }
 
+uint8_t* MediaLibvaInterfaceNext::AcquireImageScratch(
+    PDDI_MEDIA_CONTEXT mediaCtx,
+    uint32_t           size,
+    uint32_t           &capacity)
+{
+    DDI_CHK_NULL(mediaCtx, "nullptr mediaCtx.", nullptr);
+
+    return mediaCtx->ImageScratch.Acquire(size, capacity);
+}
+
+void MediaLibvaInterfaceNext::ReleaseImageScratch(
+    PDDI_MEDIA_CONTEXT mediaCtx,
+    uint8_t            *scratch,
+    uint32_t           capacity)
+{
+    if (mediaCtx == nullptr)
+    {
+        MOS_FreeMemory(scratch);
+        return;
+    }
+
+    mediaCtx->ImageScratch.Release(scratch, capacity);
+}
+
 VAStatus MediaLibvaInterfaceNext::CopySurfaceToImage(
     VADriverContextP  ctx,
     DDI_MEDIA_SURFACE *surface,
@@ -1611,10 +1625,11 @@ VAStatus MediaLibvaInterfaceNext::CopySurfaceToImage(
     uint8_t *ySrc = nullptr;
     uint8_t *yDst = (uint8_t*)imageData;
     uint8_t *swizzleData = nullptr;
+    uint32_t swizzleSize = 0;
 
     if (!surface->pMediaCtx->bIsAtomSOC && surface->TileType != I915_TILING_NONE && image->format.fourcc != VA_FOURCC_NV12)
     {
-        swizzleData = (uint8_t*)MOS_AllocMemory(surface->data_size);
+        swizzleData = AcquireImageScratch(mediaCtx, surface->data_size, swizzleSize);
         if (nullptr != swizzleData)
         {
             MediaLibvaUtilNext::SwizzleSurface(surface->pMediaCtx, surface->pGmmResourceInfo, surfData, (MOS_TILE_TYPE)surface->TileType, (uint8_t*)swizzleData, false);
@@ -1656,7 +1671,7 @@ VAStatus MediaLibvaInterfaceNext::CopySurfaceToImage(
 
     if (nullptr != swizzleData)
     {
-        MOS_FreeMemory(swizzleData);
+        ReleaseImageScratch(mediaCtx, swizzleData, swizzleSize);
         swizzleData = nullptr;
     }
     vaStatus = UnmapBuffer(ctx, image->buf);
@@ -2907,44 +2922,11 @@ VAStatus MediaLibvaInterfaceNext::SyncSurface2 (
     }
     MOS_TraceEventExt(EVENT_VA_SYNC, EVENT_TYPE_INFO, surface->bo? &surface->bo->handle:nullptr, sizeof(uint32_t), nullptr, 0);
 
-    if (timeoutNs == VA_TIMEOUT_INFINITE)
-    {
-        // zero is an expected return value when not hit timeout
-        auto ret = mos_gem_bo_wait(surface->bo, DDI_BO_INFINITE_TIMEOUT);
-        if (0 != ret)
-        {
-            DDI_NORMALMESSAGE("vaSyncSurface2: surface is still used by HW\n\r");
-            return VA_STATUS_ERROR_TIMEDOUT;
-        }
-    }
-    else
+    // zero is an expected return value when not hit timeout
+    if (0 != MediaLibvaUtilNext::WaitBo(surface->bo, timeoutNs))
     {
-        int64_t timeoutBoWait1 = 0;
-        int64_t timeoutBoWait2 = 0;
-        if (timeoutNs >= DDI_BO_MAX_TIMEOUT)
-        {
-            timeoutBoWait1 = DDI_BO_MAX_TIMEOUT - 1;
-            timeoutBoWait2 = timeoutNs - DDI_BO_MAX_TIMEOUT + 1;
-        }
-        else
-        {
-            timeoutBoWait1 = (int64_t)timeoutNs;
-        }
-        
-        // zero is an expected return value when not hit timeout
-        auto ret = mos_gem_bo_wait(surface->bo, timeoutBoWait1);
-        if (0 != ret)
-        {
-            if (timeoutBoWait2)
-            {
-                ret = mos_gem_bo_wait(surface->bo, timeoutBoWait2); 
-            }
-            if (0 != ret)
-            {
-                DDI_NORMALMESSAGE("vaSyncSurface2: surface is still used by HW\n\r");
-                return VA_STATUS_ERROR_TIMEDOUT;
-            }
-        }
+        DDI_NORMALMESSAGE("vaSyncSurface2: surface is still used by HW\n\r");
+        return VA_STATUS_ERROR_TIMEDOUT;
     }
     MOS_TraceEventExt(EVENT_VA_SYNC, EVENT_TYPE_END, nullptr, 0, nullptr, 0);
 
@@ -2985,44 +2967,11 @@ VAStatus MediaLibvaInterfaceNext::SyncBuffer (
     DDI_CHK_NULL(buffer,  "nullptr buffer", VA_STATUS_ERROR_INVALID_CONTEXT);
 
     MOS_TraceEventExt(EVENT_VA_SYNC, EVENT_TYPE_INFO, buffer->bo? &buffer->bo->handle:nullptr, sizeof(uint32_t), nullptr, 0);
-    if (timeoutNs == VA_TIMEOUT_INFINITE)
+    // zero is a expected return value when not hit timeout
+    if (0 != MediaLibvaUtilNext::WaitBo(buffer->bo, timeoutNs))
     {
-        // zero is a expected return value when not hit timeout
-        auto ret = mos_gem_bo_wait(buffer->bo, DDI_BO_INFINITE_TIMEOUT);
-        if (0 != ret)
-        {
-            DDI_NORMALMESSAGE("vaSyncBuffer: buffer is still used by HW\n\r");
-            return VA_STATUS_ERROR_TIMEDOUT;
-        }
-    }
-    else
-    {
-        int64_t timeoutBoWait1 = 0;
-        int64_t timeoutBoWait2 = 0;
-        if (timeoutNs >= DDI_BO_MAX_TIMEOUT)
-        {
-            timeoutBoWait1 = DDI_BO_MAX_TIMEOUT - 1;
-            timeoutBoWait2 = timeoutNs - DDI_BO_MAX_TIMEOUT + 1;
-        }
-        else
-        {
-            timeoutBoWait1 = (int64_t)timeoutNs;
-        }
-
-        // zero is a expected return value when not hit timeout
-        auto ret = mos_gem_bo_wait(buffer->bo, timeoutBoWait1);
-        if (0 != ret)
-        {
-            if (timeoutBoWait2)
-            {
-                ret = mos_gem_bo_wait(buffer->bo, timeoutBoWait2);
-            }
-            if (0 != ret)
-            {
-                DDI_NORMALMESSAGE("vaSyncBuffer: buffer is still used by HW\n\r");
-                return VA_STATUS_ERROR_TIMEDOUT;
-            }
-        }
+        DDI_NORMALMESSAGE("vaSyncBuffer: buffer is still used by HW\n\r");
+        return VA_STATUS_ERROR_TIMEDOUT;
     }
     MOS_TraceEventExt(EVENT_VA_SYNC, EVENT_TYPE_END, nullptr, 0, nullptr, 0);
     return VA_STATUS_SUCCESS;
@@ -5176,10 +5125,13 @@ VAStatus MediaLibvaInterfaceNext::Copy(
 
     if ((option.bits.va_copy_sync == VA_EXEC_SYNC) && dst_surface)
     {
-        uint32_t timeout_NS = 100000000;
-        while (0 != mos_gem_bo_wait(dst_surface->bo, timeout_NS))
+        if (0 != MediaLibvaUtilNext::WaitBo(dst_surface->bo, UINT64_MAX))
         {
-            // Just loop while gem_bo_wait times-out.
+            DDI_ASSERTMESSAGE("vaCopy: failed to wait for destination surface\n\r");
+            if (VA_STATUS_SUCCESS == vaStatus)
+            {
+                vaStatus = VA_STATUS_ERROR_TIMEDOUT;
+            }
         }
     }
 
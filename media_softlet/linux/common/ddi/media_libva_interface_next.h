@@ -1549,6 +1549,43 @@ private:
         uint32_t srcPitch,
         uint32_t height);
 
+    //!
+    //! \brief  Get a scratch buffer of at least size bytes for image copy
+    //! \details Reuses the buffer cached in media context when it is big enough,
+    //!          otherwise allocates a new one
+    //!
+    //! \param  [in] mediaCtx
+    //!         Pointer to media context
+    //! \param  [in] size
+    //!         Required buffer size
+    //! \param  [out] capacity
+    //!         Actual size of the returned buffer, to be passed to ReleaseImageScratch
+    //!
+    //! \return uint8_t*
+    //!     Pointer to scratch buffer, nullptr if allocation failed
+    //!
+    static uint8_t* AcquireImageScratch(
+        PDDI_MEDIA_CONTEXT mediaCtx,
+        uint32_t           size,
+        uint32_t           &capacity);
+
+    //!
+    //! \brief  Return a scratch buffer got from AcquireImageScratch
+    //! \details The buffer is cached in media context for next image copy,
+    //!          or freed if a larger one is already cached
+    //!
+    //! \param  [in] mediaCtx
+    //!         Pointer to media context
+    //! \param  [in] scratch
+    //!         Scratch buffer
+    //! \param  [in] capacity
+    //!         Capacity AcquireImageScratch reported for the buffer
+    //!
+    static void ReleaseImageScratch(
+        PDDI_MEDIA_CONTEXT mediaCtx,
+        uint8_t            *scratch,
+        uint32_t           capacity);
+
     //!
     //! \brief  Map CompType from entrypoint
     //! 
@@ -23,6 +23,7 @@
 //! \file     media_libva_util_next.cpp
 //! \brief    libva util next implementaion.
 //!
+#include <errno.h>
 #include <sys/time.h>
 #include "media_libva_util_next.h"
 #include "mos_utilities.h"
@@ -818,23 +819,23 @@ PDDI_MEDIA_SURFACE_HEAP_ELEMENT MediaLibvaUtilNext::AllocPMediaSurfaceFromHeap(P
 
     if (nullptr == surfaceHeap->pFirstFreeHeapElement)
     {
-        void *newHeapBase = MOS_ReallocMemory(surfaceHeap->pHeapBase, (surfaceHeap->uiAllocatedHeapElements + DDI_MEDIA_HEAP_INCREMENTAL_SIZE) * sizeof(DDI_MEDIA_SURFACE_HEAP_ELEMENT));
+        uint32_t incrementalSize = 0;
+        void *newHeapBase = MediaLibvaCommonNext::GrowHeap(surfaceHeap, incrementalSize);
 
         if (nullptr == newHeapBase)
         {
-            DDI_ASSERTMESSAGE("DDI: realloc failed.");
+            DDI_ASSERTMESSAGE("DDI: heap growth failed.");
             return nullptr;
         }
-        surfaceHeap->pHeapBase                    = newHeapBase;
         PDDI_MEDIA_SURFACE_HEAP_ELEMENT surfaceHeapBase  = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)surfaceHeap->pHeapBase;
         surfaceHeap->pFirstFreeHeapElement        = (void*)(&surfaceHeapBase[surfaceHeap->uiAllocatedHeapElements]);
-        for (int32_t i = 0; i < (DDI_MEDIA_HEAP_INCREMENTAL_SIZE); i++)
+        for (uint32_t i = 0; i < incrementalSize; i++)
         {
             mediaSurfaceHeapElmt                  = &surfaceHeapBase[surfaceHeap->uiAllocatedHeapElements + i];
-            mediaSurfaceHeapElmt->pNextFree       = (i == (DDI_MEDIA_HEAP_INCREMENTAL_SIZE - 1))? nullptr : &surfaceHeapBase[surfaceHeap->uiAllocatedHeapElements + i + 1];
+            mediaSurfaceHeapElmt->pNextFree       = (i == (incrementalSize - 1))? nullptr : &surfaceHeapBase[surfaceHeap->uiAllocatedHeapElements + i + 1];
             mediaSurfaceHeapElmt->uiVaSurfaceID   = surfaceHeap->uiAllocatedHeapElements + i;
         }
-        surfaceHeap->uiAllocatedHeapElements     += DDI_MEDIA_HEAP_INCREMENTAL_SIZE;
+        MediaLibvaCommonNext::SetHeapSize(surfaceHeap, surfaceHeap->uiAllocatedHeapElements + incrementalSize);
     }
 
     mediaSurfaceHeapElmt                          = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)surfaceHeap->pFirstFreeHeapElement;
@@ -964,6 +965,15 @@ void MediaLibvaUtilNext::PostSemaphore(PMEDIA_SEM_T sem)
     }
 }
 
+int32_t MediaLibvaUtilNext::WaitBo(MOS_LINUX_BO *bo, uint64_t timeoutNs)
+{
+    DDI_CHK_NULL(bo, "nullptr bo", -EINVAL);
+
+    // One wait with the exact timeout, gem wait treats a negative timeout as infinite.
+    int64_t timeout = timeoutNs > (uint64_t)INT64_MAX ? -1 : (int64_t)timeoutNs;
+    return mos_gem_bo_wait(bo, timeout);
+}
+
 void MediaLibvaUtilNext::DestroySemaphore(PMEDIA_SEM_T sem)
 {
     int32_t ret = sem_destroy(sem);
@@ -1744,22 +1754,22 @@ PDDI_MEDIA_BUFFER_HEAP_ELEMENT MediaLibvaUtilNext::AllocPMediaBufferFromHeap(PDD
     PDDI_MEDIA_BUFFER_HEAP_ELEMENT  mediaBufferHeapElmt = nullptr;
     if (nullptr == bufferHeap->pFirstFreeHeapElement)
     {
-        void *newHeapBase = MOS_ReallocMemory(bufferHeap->pHeapBase, (bufferHeap->uiAllocatedHeapElements + DDI_MEDIA_HEAP_INCREMENTAL_SIZE) * sizeof(DDI_MEDIA_BUFFER_HEAP_ELEMENT));
+        uint32_t incrementalSize = 0;
+        void *newHeapBase = MediaLibvaCommonNext::GrowHeap(bufferHeap, incrementalSize);
         if (nullptr == newHeapBase)
         {
-            DDI_ASSERTMESSAGE("DDI: realloc failed.");
+            DDI_ASSERTMESSAGE("DDI: heap growth failed.");
             return nullptr;
         }
-        bufferHeap->pHeapBase                                 = newHeapBase;
         PDDI_MEDIA_BUFFER_HEAP_ELEMENT mediaBufferHeapBase    = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)bufferHeap->pHeapBase;
         bufferHeap->pFirstFreeHeapElement     = (void*)(&mediaBufferHeapBase[bufferHeap->uiAllocatedHeapElements]);
-        for (int32_t i = 0; i < (DDI_MEDIA_HEAP_INCREMENTAL_SIZE); i++)
+        for (uint32_t i = 0; i < incrementalSize; i++)
         {
             mediaBufferHeapElmt               = &mediaBufferHeapBase[bufferHeap->uiAllocatedHeapElements + i];
-            mediaBufferHeapElmt->pNextFree    = (i == (DDI_MEDIA_HEAP_INCREMENTAL_SIZE - 1))? nullptr : &mediaBufferHeapBase[bufferHeap->uiAllocatedHeapElements + i + 1];
+            mediaBufferHeapElmt->pNextFree    = (i == (incrementalSize - 1))? nullptr : &mediaBufferHeapBase[bufferHeap->uiAllocatedHeapElements + i + 1];
             mediaBufferHeapElmt->uiVaBufferID = bufferHeap->uiAllocatedHeapElements + i;
         }
-        bufferHeap->uiAllocatedHeapElements  += DDI_MEDIA_HEAP_INCREMENTAL_SIZE;
+        MediaLibvaCommonNext::SetHeapSize(bufferHeap, bufferHeap->uiAllocatedHeapElements + incrementalSize);
     }
 
     mediaBufferHeapElmt                       = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)bufferHeap->pFirstFreeHeapElement;
@@ -1775,23 +1785,23 @@ PDDI_MEDIA_IMAGE_HEAP_ELEMENT MediaLibvaUtilNext::AllocPVAImageFromHeap(PDDI_MED
 
     if (nullptr == imageHeap->pFirstFreeHeapElement)
     {
-        void *newHeapBase = MOS_ReallocMemory(imageHeap->pHeapBase, (imageHeap->uiAllocatedHeapElements + DDI_MEDIA_HEAP_INCREMENTAL_SIZE) * sizeof(DDI_MEDIA_IMAGE_HEAP_ELEMENT));
+        uint32_t incrementalSize = 0;
+        void *newHeapBase = MediaLibvaCommonNext::GrowHeap(imageHeap, incrementalSize);
 
         if (nullptr == newHeapBase)
         {
-            DDI_ASSERTMESSAGE("DDI: realloc failed.");
+            DDI_ASSERTMESSAGE("DDI: heap growth failed.");
             return nullptr;
         }
-        imageHeap->pHeapBase                           = newHeapBase;
         PDDI_MEDIA_IMAGE_HEAP_ELEMENT vaimageHeapBase  = (PDDI_MEDIA_IMAGE_HEAP_ELEMENT)imageHeap->pHeapBase;
         imageHeap->pFirstFreeHeapElement               = (void*)(&vaimageHeapBase[imageHeap->uiAllocatedHeapElements]);
-        for (int32_t i = 0; i < (DDI_MEDIA_HEAP_INCREMENTAL_SIZE); i++)
+        for (uint32_t i = 0; i < incrementalSize; i++)
         {
             vaimageHeapElmt                   = &vaimageHeapBase[imageHeap->uiAllocatedHeapElements + i];
-            vaimageHeapElmt->pNextFree        = (i == (DDI_MEDIA_HEAP_INCREMENTAL_SIZE - 1))? nullptr : &vaimageHeapBase[imageHeap->uiAllocatedHeapElements + i + 1];
+            vaimageHeapElmt->pNextFree        = (i == (incrementalSize - 1))? nullptr : &vaimageHeapBase[imageHeap->uiAllocatedHeapElements + i + 1];
             vaimageHeapElmt->uiVaImageID      = imageHeap->uiAllocatedHeapElements + i;
         }
-        imageHeap->uiAllocatedHeapElements   += DDI_MEDIA_HEAP_INCREMENTAL_SIZE;
+        MediaLibvaCommonNext::SetHeapSize(imageHeap, imageHeap->uiAllocatedHeapElements + incrementalSize);
 
     }
 
@@ -1990,21 +2000,21 @@ PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT MediaLibvaUtilNext::DdiAllocPVAContextFromHeap
 
     if (nullptr == vaContextHeap->pFirstFreeHeapElement)
     {
-        void *newHeapBase = MOS_ReallocMemory(vaContextHeap->pHeapBase, (vaContextHeap->uiAllocatedHeapElements + DDI_MEDIA_HEAP_INCREMENTAL_SIZE) * sizeof(DDI_MEDIA_VACONTEXT_HEAP_ELEMENT));
-        DDI_CHK_NULL(newHeapBase, "DDI: realloc failed.", nullptr);
+        uint32_t incrementalSize = 0;
+        void *newHeapBase = MediaLibvaCommonNext::GrowHeap(vaContextHeap, incrementalSize);
+        DDI_CHK_NULL(newHeapBase, "DDI: heap growth failed.", nullptr);
 
-        vaContextHeap->pHeapBase                            = newHeapBase;
         PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT vacontextHeapBase = (PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT)vaContextHeap->pHeapBase;
         DDI_CHK_NULL(vacontextHeapBase, "nullptr vacontextHeapBase.", nullptr);
         vaContextHeap->pFirstFreeHeapElement        = (void*)(&(vacontextHeapBase[vaContextHeap->uiAllocatedHeapElements]));
-        for (int32_t i = 0; i < (DDI_MEDIA_HEAP_INCREMENTAL_SIZE); i++)
+        for (uint32_t i = 0; i < incrementalSize; i++)
         {
             vacontextHeapElmt                       = &vacontextHeapBase[vaContextHeap->uiAllocatedHeapElements + i];
-            vacontextHeapElmt->pNextFree            = (i == (DDI_MEDIA_HEAP_INCREMENTAL_SIZE - 1))? nullptr : &vacontextHeapBase[vaContextHeap->uiAllocatedHeapElements + i + 1];
+            vacontextHeapElmt->pNextFree            = (i == (incrementalSize - 1))? nullptr : &vacontextHeapBase[vaContextHeap->uiAllocatedHeapElements + i + 1];
             vacontextHeapElmt->uiVaContextID        = vaContextHeap->uiAllocatedHeapElements + i;
             vacontextHeapElmt->pVaContext           = nullptr;
         }
-        vaContextHeap->uiAllocatedHeapElements     += DDI_MEDIA_HEAP_INCREMENTAL_SIZE;
+        MediaLibvaCommonNext::SetHeapSize(vaContextHeap, vaContextHeap->uiAllocatedHeapElements + incrementalSize);
     }
 
     vacontextHeapElmt                    = (PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT)vaContextHeap->pFirstFreeHeapElement;
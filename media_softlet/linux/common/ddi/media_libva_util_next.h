@@ -540,6 +540,19 @@ public:
     //!
     static void DestroySemaphore(PMEDIA_SEM_T sem);
 
+    //!
+    //! \brief  Wait for the gpu to finish with a bo
+    //!
+    //! \param  [in] bo
+    //!         Pointer to the bo
+    //! \param  [in] timeoutNs
+    //!         Timeout in ns, values beyond INT64_MAX wait infinitely
+    //!
+    //! \return int32_t
+    //!     0 if the bo is idle, -ETIME if the timeout expired, else other negative errno
+    //!
+    static int32_t WaitBo(MOS_LINUX_BO *bo, uint64_t timeoutNs);
+
     //!
     //! \brief  Unregister RT surfaces
     //!
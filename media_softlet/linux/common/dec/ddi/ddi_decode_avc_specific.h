@@ -75,6 +75,11 @@ public:
     virtual uint8_t* GetPicParamBuf(
     DDI_CODEC_COM_BUFFER_MGR *bufMgr) override;
 
+    virtual bool IsBitstreamSegmentSupported() override
+    {
+        return true;
+    }
+
 private:
     //!
     //! \brief   ParaSliceParam for Avc
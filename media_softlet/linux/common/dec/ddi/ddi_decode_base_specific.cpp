@@ -275,6 +275,8 @@ VAStatus DdiDecodeBase::BeginPicture(
     m_decodeCtx->DecodeParams.m_deblockDataSize  = 0;
     m_decodeCtx->DecodeParams.m_executeCallIndex = 0;
     m_decodeCtx->DecodeParams.m_cencBuf          = nullptr;
+    m_decodeCtx->DecodeParams.m_bitstreamSegments    = nullptr;
+    m_decodeCtx->DecodeParams.m_numBitstreamSegments = 0;
     m_groupIndex                                 = 0;
 
     // register render targets
@@ -307,6 +309,41 @@ VAStatus DdiDecodeBase::DecodeCombineBitstream(DDI_MEDIA_CONTEXT *mediaCtx)
         return VA_STATUS_SUCCESS;
     }
 
+    if (IsBitstreamSegmentSupported())
+    {
+        // pass oversized slices down in their own buffers, decode pipeline catenates them on GPU
+        ReleaseBitstreamSegments();
+        for (uint32_t slcInd = 0; slcInd < bufMgr->dwNumSliceData; slcInd++)
+        {
+            DDI_CODEC_BITSTREAM_BUFFER_INFO &sliceData = bufMgr->pSliceData[slcInd];
+            if (sliceData.bIsUseExtBuf == true && sliceData.pSliceBufObj)
+            {
+                MediaLibvaUtilNext::UnlockBuffer(sliceData.pSliceBufObj);
+
+                CodechalDecodeBitstreamSegment segment;
+                segment.m_size       = sliceData.uiLength;
+                segment.m_destOffset = sliceData.uiOffset;
+                m_bitstreamSegments.push_back(segment);
+                m_bitstreamSegmentBuffers.push_back(sliceData.pSliceBufObj);
+
+                sliceData.pSliceBufObj = nullptr;
+                sliceData.pSliceBuf    = nullptr;
+                sliceData.bIsUseExtBuf = false;
+            }
+        }
+
+        m_bitstreamSegmentResources.resize(m_bitstreamSegmentBuffers.size());
+        for (uint32_t i = 0; i < m_bitstreamSegmentBuffers.size(); i++)
+        {
+            MediaLibvaCommonNext::MediaBufferToMosResource(m_bitstreamSegmentBuffers[i], &m_bitstreamSegmentResources[i]);
+            m_bitstreamSegments[i].m_resource = &m_bitstreamSegmentResources[i];
+        }
+
+        m_decodeCtx->DecodeParams.m_bitstreamSegments    = m_bitstreamSegments.empty() ? nullptr : m_bitstreamSegments.data();
+        m_decodeCtx->DecodeParams.m_numBitstreamSegments = (uint32_t)m_bitstreamSegments.size();
+        return VA_STATUS_SUCCESS;
+    }
+
     PDDI_MEDIA_BUFFER newBitstreamBuffer;
     // allocate a new bit stream buffer
     newBitstreamBuffer = (DDI_MEDIA_BUFFER *)MOS_AllocAndZeroMemory(sizeof(DDI_MEDIA_BUFFER));
@@ -391,6 +428,18 @@ VAStatus DdiDecodeBase::DecodeCombineBitstream(DDI_MEDIA_CONTEXT *mediaCtx)
     return VA_STATUS_SUCCESS;
 }
 
+void DdiDecodeBase::ReleaseBitstreamSegments()
+{
+    for (auto buffer : m_bitstreamSegmentBuffers)
+    {
+        MediaLibvaUtilNext::FreeBuffer(buffer);
+        MOS_FreeMemory(buffer);
+    }
+    m_bitstreamSegmentBuffers.clear();
+    m_bitstreamSegmentResources.clear();
+    m_bitstreamSegments.clear();
+}
+
 void DdiDecodeBase::DestroyContext(VADriverContextP ctx)
 {
     DDI_CODEC_FUNC_ENTER;
@@ -495,6 +544,7 @@ VAStatus DdiDecodeBase::AllocBsBuffer(
     uint32_t         index = 0, i = 0;
     VAStatus         vaStatus  = VA_STATUS_SUCCESS;
     uint8_t          *sliceBuf = nullptr;
+    DDI_MEDIA_BUFFER *sliceBufObj = nullptr;
     DDI_MEDIA_BUFFER *bsBufObj = nullptr;
     uint8_t          *bsBufBaseAddr = nullptr;
     bool             createBsBuffer = false;
@@ -534,11 +584,41 @@ VAStatus DdiDecodeBase::AllocBsBuffer(
         buf->uiOffset = bufMgr->pSliceData[index-1].uiOffset + bufMgr->pSliceData[index-1].uiLength;
         if ((buf->uiOffset + buf->iSize) > bufMgr->pBitStreamBuffObject[bufMgr->dwBitstreamIndex]->iSize)
         {
-            sliceBuf = (uint8_t*)MOS_AllocAndZeroMemory(buf->iSize);
-            if (sliceBuf == nullptr)
+            if (IsBitstreamSegmentSupported())
             {
-                DDI_CODEC_ASSERTMESSAGE("DDI:AllocAndZeroMem return failure.")
-                return VA_STATUS_ERROR_ALLOCATION_FAILED;
+                // the application writes the slice into its own GPU buffer, no CPU combine later
+                sliceBufObj = (DDI_MEDIA_BUFFER *)MOS_AllocAndZeroMemory(sizeof(DDI_MEDIA_BUFFER));
+                if (sliceBufObj == nullptr)
+                {
+                    DDI_CODEC_ASSERTMESSAGE("DDI:AllocAndZeroMem return failure.")
+                    return VA_STATUS_ERROR_ALLOCATION_FAILED;
+                }
+                sliceBufObj->iSize     = buf->iSize;
+                sliceBufObj->uiType    = VASliceDataBufferType;
+                sliceBufObj->format    = Media_Format_Buffer;
+                sliceBufObj->pMediaCtx = m_decodeCtx->pMediaCtx;
+                if (VA_STATUS_SUCCESS != MediaLibvaUtilNext::CreateBuffer(sliceBufObj, m_decodeCtx->pMediaCtx->pDrmBufMgr))
+                {
+                    MOS_FreeMemory(sliceBufObj);
+                    return VA_STATUS_ERROR_ALLOCATION_FAILED;
+                }
+
+                sliceBuf = (uint8_t*)MediaLibvaUtilNext::LockBuffer(sliceBufObj, MOS_LOCKFLAG_WRITEONLY);
+                if (sliceBuf == nullptr)
+                {
+                    MediaLibvaUtilNext::FreeBuffer(sliceBufObj);
+                    MOS_FreeMemory(sliceBufObj);
+                    return VA_STATUS_ERROR_ALLOCATION_FAILED;
+                }
+            }
+            else
+            {
+                sliceBuf = (uint8_t*)MOS_AllocAndZeroMemory(buf->iSize);
+                if (sliceBuf == nullptr)
+                {
+                    DDI_CODEC_ASSERTMESSAGE("DDI:AllocAndZeroMem return failure.")
+                    return VA_STATUS_ERROR_ALLOCATION_FAILED;
+                }
             }
             bufMgr->bIsSliceOverSize = true;
         }
@@ -634,6 +714,7 @@ VAStatus DdiDecodeBase::AllocBsBuffer(
         buf->uiOffset                           = 0;
         bufMgr->pSliceData[index].bIsUseExtBuf  = true;
         bufMgr->pSliceData[index].pSliceBuf     = sliceBuf;
+        bufMgr->pSliceData[index].pSliceBufObj  = sliceBufObj;
         buf->bCFlushReq                         = false;
     }
     else
@@ -641,6 +722,7 @@ VAStatus DdiDecodeBase::AllocBsBuffer(
         buf->pData                              = (uint8_t*)(bufMgr->pBitStreamBase[bufMgr->dwBitstreamIndex]);
         bufMgr->pSliceData[index].bIsUseExtBuf  = false;
         bufMgr->pSliceData[index].pSliceBuf     = nullptr;
+        bufMgr->pSliceData[index].pSliceBufObj  = nullptr;
         buf->bCFlushReq                         = true;
     }
 
@@ -937,6 +1019,12 @@ VAStatus DdiDecodeBase::EndPicture(
     }
 
     MOS_STATUS status = m_decodeCtx->pCodecHal->Execute((void *)(&m_decodeCtx->DecodeParams));
+
+    // The segment copy has been submitted, the GPU keeps the buffers alive until it completes
+    ReleaseBitstreamSegments();
+    m_decodeCtx->DecodeParams.m_bitstreamSegments    = nullptr;
+    m_decodeCtx->DecodeParams.m_numBitstreamSegments = 0;
+
     if (status != MOS_STATUS_SUCCESS)
     {
         DDI_CODEC_ASSERTMESSAGE("DDI:DdiDecode_DecodeInCodecHal return failure.");
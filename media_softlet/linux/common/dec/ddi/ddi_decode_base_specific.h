@@ -28,6 +28,7 @@
 #define _DDI_DECODE_BASE_SPECIFIC_H_
 
 #include <stdint.h>
+#include <vector>
 #include <va/va.h>
 #include "media_ddi_base.h"
 #include "decode_pipeline_adapter.h"
@@ -58,6 +59,7 @@ public:
         m_ddiDecodeAttr = nullptr;
         MOS_Delete(m_codechalSettings);
         m_codechalSettings = nullptr;
+        ReleaseBitstreamSegments();
 #ifdef _DECODE_PROCESSING_SUPPORTED
         MOS_FreeMemory(m_procBuf);
         m_procBuf = nullptr;
@@ -298,6 +300,18 @@ public:
         return false;
     }
 
+    //!
+    //! \brief    if oversized slice data can be passed down as bitstream segments
+    //! \details  The segments are catenated on GPU, so the codec must not parse
+    //!           the bitstream on CPU before the decode pipeline copies them.
+    //!
+    //! \return   true or false
+    //!
+    virtual bool IsBitstreamSegmentSupported()
+    {
+        return false;
+    }
+
     //! \brief    Combine the Bitstream Before decoding execution
     //! \details  Help to refine and combine the decoded input bitstream if
     //!           required. It is decided by the flag of IsSliceOverSize.
@@ -309,6 +323,12 @@ public:
     //!
     VAStatus DecodeCombineBitstream(DDI_MEDIA_CONTEXT *mediaCtx);
 
+    //! \brief    Release the slice data buffers passed down as bitstream segments
+    //! \details  Called once the picture is submitted. The GPU keeps its own
+    //!           reference to the buffers until the segment copy completes.
+    //!
+    void ReleaseBitstreamSegments();
+
     //!
     //! \brief    Check if the resolution is valid for a given decode codec mode
     //!
@@ -474,6 +494,9 @@ protected:
     uint32_t              m_sliceCtrlBufNum;      //!<Slice control Buffer Number
     uint32_t              m_decProcessingType;    //!<Decode Processing type
     CodechalSetting      *m_codechalSettings = nullptr;    //!<Codechal Settings
+    std::vector<CodechalDecodeBitstreamSegment> m_bitstreamSegments;         //!<Bitstream segments of current picture
+    std::vector<MOS_RESOURCE>                   m_bitstreamSegmentResources; //!<Resources of bitstream segments
+    std::vector<PDDI_MEDIA_BUFFER>              m_bitstreamSegmentBuffers;   //!<Slice data buffers of bitstream segments
     static const uint32_t m_decDefaultMaxWidth = 4096;
     static const uint32_t m_decDefaultMaxHeight = 4096;
 
@@ -79,6 +79,11 @@ public:
 
     virtual bool IsRextProfile() override;
 
+    virtual bool IsBitstreamSegmentSupported() override
+    {
+        return true;
+    }
+
 protected:
     //!
     //! \brief   ParaSliceParam for HEVC
@@ -233,6 +233,11 @@ struct mos_linux_bo *mos_bo_gem_create_from_name(struct mos_bufmgr *bufmgr,
                         const char *name,
                         unsigned int handle);
 void mos_bufmgr_gem_enable_reuse(struct mos_bufmgr *bufmgr);
+void mos_bufmgr_gem_get_bo_cache_stats(struct mos_bufmgr *bufmgr,
+                        uint64_t *hits,
+                        uint64_t *misses,
+                        uint64_t *evictions,
+                        uint64_t *cached_bytes);
 void mos_bufmgr_gem_enable_fenced_relocs(struct mos_bufmgr *bufmgr);
 void mos_bufmgr_gem_enable_softpin(struct mos_bufmgr *bufmgr, bool va1m_align);
 void mos_bufmgr_gem_enable_vmbind(struct mos_bufmgr *bufmgr);
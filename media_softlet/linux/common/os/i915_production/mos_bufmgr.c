@@ -111,6 +111,9 @@
 
 #define INITIAL_SOFTPIN_TARGET_COUNT  1024
 
+/* Default reuse cache budget, overridden in MB by MEDIA_BO_CACHE_MAX_SIZE */
+#define BO_CACHE_DEFAULT_MAX_SIZE     (512ull * 1024 * 1024)
+
 struct mos_gem_bo_bucket {
     drmMMListHead head;
     unsigned long size;
@@ -138,6 +141,15 @@ typedef struct mos_bufmgr_gem {
     int num_buckets;
     time_t time;
 
+    /** Bytes held by the reuse cache, and its budget (0 means unbounded) */
+    uint64_t cache_size;
+    uint64_t cache_max_size;
+
+    /** Reuse cache statistics */
+    uint64_t cache_hits;
+    uint64_t cache_misses;
+    uint64_t cache_evictions;
+
     drmMMListHead managers;
 
     drmMMListHead named;
@@ -851,6 +863,15 @@ mos_gem_bo_madvise(struct mos_linux_bo *bo, int madv)
          madv);
 }
 
+/* take a cached BO out of its bucket */
+static void
+mos_gem_bo_cache_remove(struct mos_bufmgr_gem *bufmgr_gem,
+                    struct mos_bo_gem *bo_gem)
+{
+    DRMLISTDEL(&bo_gem->head);
+    bufmgr_gem->cache_size -= bo_gem->bo.size;
+}
+
 /* drop the oldest entries that have been purged by the kernel */
 static void
 mos_gem_bo_cache_purge_bucket(struct mos_bufmgr_gem *bufmgr_gem,
@@ -865,11 +886,73 @@ mos_gem_bo_cache_purge_bucket(struct mos_bufmgr_gem *bufmgr_gem,
             (bufmgr_gem, bo_gem, I915_MADV_DONTNEED))
             break;
 
-        DRMLISTDEL(&bo_gem->head);
+        mos_gem_bo_cache_remove(bufmgr_gem, bo_gem);
         mos_gem_bo_free(&bo_gem->bo);
     }
 }
 
+/*
+ * Find a cached BO in @bucket that lives in the memory region @mem_type asks
+ * for, so that BOs of the other region stay cached instead of being freed.
+ * Search starts from the MRU end when @from_tail is set.
+ */
+static struct mos_bo_gem *
+mos_gem_bo_cache_find(struct mos_bufmgr_gem *bufmgr_gem,
+                    struct mos_gem_bo_bucket *bucket,
+                    int mem_type,
+                    bool from_tail)
+{
+    drmMMListHead *entry;
+
+    for (entry = from_tail ? bucket->head.prev : bucket->head.next;
+         entry != &bucket->head;
+         entry = from_tail ? entry->prev : entry->next) {
+        struct mos_bo_gem *bo_gem = DRMLISTENTRY(struct mos_bo_gem, entry, head);
+
+        if (!bufmgr_gem->has_lmem ||
+            !mos_gem_bo_check_mem_region_internal(&bo_gem->bo, mem_type))
+            return bo_gem;
+    }
+
+    return nullptr;
+}
+
+/* free the least recently cached BOs until the cache fits in its budget */
+static void
+mos_gem_bo_cache_evict(struct mos_bufmgr_gem *bufmgr_gem)
+{
+    int i;
+
+    if (bufmgr_gem->cache_max_size == 0)
+        return;
+
+    while (bufmgr_gem->cache_size > bufmgr_gem->cache_max_size) {
+        struct mos_bo_gem *oldest = nullptr;
+
+        /* each bucket is ordered by free time, so its head is its oldest BO */
+        for (i = 0; i < bufmgr_gem->num_buckets; i++) {
+            struct mos_gem_bo_bucket *bucket =
+                &bufmgr_gem->cache_bucket[i];
+            struct mos_bo_gem *bo_gem;
+
+            if (DRMLISTEMPTY(&bucket->head))
+                continue;
+
+            bo_gem = DRMLISTENTRY(struct mos_bo_gem,
+                          bucket->head.next, head);
+            if (oldest == nullptr || bo_gem->free_time < oldest->free_time)
+                oldest = bo_gem;
+        }
+
+        if (oldest == nullptr)
+            break;
+
+        mos_gem_bo_cache_remove(bufmgr_gem, oldest);
+        mos_gem_bo_free(&oldest->bo);
+        bufmgr_gem->cache_evictions++;
+    }
+}
+
 static int
 mos_gem_query_items(int fd, struct drm_i915_query_item *items, uint32_t n_items)
 {
@@ -1081,11 +1164,13 @@ retry:
              * of the list, as it will likely be hot in the GPU
              * cache and in the aperture for us.
              */
-            bo_gem = DRMLISTENTRY(struct mos_bo_gem,
-                          bucket->head.prev, head);
-            DRMLISTDEL(&bo_gem->head);
-            alloc_from_cache = true;
-            bo_gem->bo.align = alignment;
+            bo_gem = mos_gem_bo_cache_find(bufmgr_gem, bucket,
+                          mem_type, true);
+            if (bo_gem) {
+                mos_gem_bo_cache_remove(bufmgr_gem, bo_gem);
+                alloc_from_cache = true;
+                bo_gem->bo.align = alignment;
+            }
         } else {
             assert(alignment == 0);
             /* For non-render-target BOs (where we're probably
@@ -1095,11 +1180,11 @@ retry:
              * allocating a new buffer is probably faster than
              * waiting for the GPU to finish.
              */
-            bo_gem = DRMLISTENTRY(struct mos_bo_gem,
-                          bucket->head.next, head);
-            if (!mos_gem_bo_busy(&bo_gem->bo)) {
+            bo_gem = mos_gem_bo_cache_find(bufmgr_gem, bucket,
+                          mem_type, false);
+            if (bo_gem && !mos_gem_bo_busy(&bo_gem->bo)) {
                 alloc_from_cache = true;
-                DRMLISTDEL(&bo_gem->head);
+                mos_gem_bo_cache_remove(bufmgr_gem, bo_gem);
             }
         }
 
@@ -1128,6 +1213,11 @@ retry:
             }
         }
     }
+
+    if (alloc_from_cache)
+        bufmgr_gem->cache_hits++;
+    else if (bucket != nullptr)
+        bufmgr_gem->cache_misses++;
     pthread_mutex_unlock(&bufmgr_gem->lock);
 
     if (!alloc_from_cache) {
@@ -1655,7 +1745,7 @@ mos_gem_cleanup_bo_cache(struct mos_bufmgr_gem *bufmgr_gem, time_t time)
             if (time - bo_gem->free_time <= 1)
                 break;
 
-            DRMLISTDEL(&bo_gem->head);
+            mos_gem_bo_cache_remove(bufmgr_gem, bo_gem);
 
             mos_gem_bo_free(&bo_gem->bo);
         }
@@ -1727,6 +1817,9 @@ mos_gem_bo_unreference_final(struct mos_linux_bo *bo, time_t time)
         bo_gem->validate_index = -1;
 
         DRMLISTADDTAIL(&bo_gem->head, &bucket->head);
+        bufmgr_gem->cache_size += bo->size;
+
+        mos_gem_bo_cache_evict(bufmgr_gem);
     } else {
         mos_gem_bo_free(bo);
     }
@@ -2432,6 +2525,10 @@ mos_gem_bo_wait_rendering(struct mos_linux_bo *bo)
  *
  * Note that some kernels have broken the inifite wait for negative values
  * promise, upgrade to latest stable kernels if this is the case.
+ *
+ * A reusable buffer that is known to be idle since its last execbuffer
+ * returns immediately without entering the kernel, and a successful wait
+ * marks it idle until it is executed again.
  */
 drm_export int
 mos_gem_bo_wait(struct mos_linux_bo *bo, int64_t timeout_ns)
@@ -2453,6 +2550,9 @@ mos_gem_bo_wait(struct mos_linux_bo *bo, int64_t timeout_ns)
         }
     }
 
+    if (bo_gem->reusable && bo_gem->idle)
+        return 0;
+
     memclear(wait);
     wait.bo_handle = bo_gem->gem_handle;
     wait.timeout_ns = timeout_ns;
@@ -2460,6 +2560,9 @@ mos_gem_bo_wait(struct mos_linux_bo *bo, int64_t timeout_ns)
     if (ret == -1)
         return -errno;
 
+    if (ret == 0)
+        bo_gem->idle = true;
+
     return ret;
 }
 
@@ -2518,6 +2621,11 @@ mos_bufmgr_gem_destroy(struct mos_bufmgr *bufmgr)
     free(bufmgr_gem->exec_bos);
     pthread_mutex_destroy(&bufmgr_gem->lock);
 
+    MOS_DBG("bo cache: %llu hits, %llu misses, %llu evictions\n",
+        (unsigned long long)bufmgr_gem->cache_hits,
+        (unsigned long long)bufmgr_gem->cache_misses,
+        (unsigned long long)bufmgr_gem->cache_evictions);
+
     /* Free any cached buffer objects we were going to reuse */
     for (i = 0; i < bufmgr_gem->num_buckets; i++) {
         struct mos_gem_bo_bucket *bucket =
@@ -2527,7 +2635,7 @@ mos_bufmgr_gem_destroy(struct mos_bufmgr *bufmgr)
         while (!DRMLISTEMPTY(&bucket->head)) {
             bo_gem = DRMLISTENTRY(struct mos_bo_gem,
                           bucket->head.next, head);
-            DRMLISTDEL(&bo_gem->head);
+            mos_gem_bo_cache_remove(bufmgr_gem, bo_gem);
 
             mos_gem_bo_free(&bo_gem->bo);
         }
@@ -3941,6 +4049,32 @@ mos_bufmgr_gem_enable_reuse(struct mos_bufmgr *bufmgr)
     bufmgr_gem->bo_reuse = true;
 }
 
+/**
+ * Reports buffer object reuse cache statistics.
+ *
+ * Any of the output pointers may be nullptr.
+ */
+void
+mos_bufmgr_gem_get_bo_cache_stats(struct mos_bufmgr *bufmgr,
+                    uint64_t *hits,
+                    uint64_t *misses,
+                    uint64_t *evictions,
+                    uint64_t *cached_bytes)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *) bufmgr;
+
+    pthread_mutex_lock(&bufmgr_gem->lock);
+    if (hits)
+        *hits = bufmgr_gem->cache_hits;
+    if (misses)
+        *misses = bufmgr_gem->cache_misses;
+    if (evictions)
+        *evictions = bufmgr_gem->cache_evictions;
+    if (cached_bytes)
+        *cached_bytes = bufmgr_gem->cache_size;
+    pthread_mutex_unlock(&bufmgr_gem->lock);
+}
+
 /**
  * Enable use of fenced reloc type.
  *
@@ -4758,6 +4892,7 @@ mos_bufmgr_gem_init(int fd, int batch_size)
     drm_i915_getparam_t gp;
     int ret, tmp;
     bool exec2 = false;
+    char *cache_max_size_env;
 
     pthread_mutex_lock(&bufmgr_list_mutex);
 
@@ -4974,6 +5109,12 @@ mos_bufmgr_gem_init(int fd, int batch_size)
     DRMINITLISTHEAD(&bufmgr_gem->named);
     init_cache_buckets(bufmgr_gem);
 
+    /* Reuse cache budget, MEDIA_BO_CACHE_MAX_SIZE=0 removes the limit */
+    bufmgr_gem->cache_max_size = BO_CACHE_DEFAULT_MAX_SIZE;
+    cache_max_size_env = getenv("MEDIA_BO_CACHE_MAX_SIZE");
+    if (cache_max_size_env != nullptr)
+        bufmgr_gem->cache_max_size = strtoull(cache_max_size_env, nullptr, 0) * 1024 * 1024;
+
     DRMLISTADD(&bufmgr_gem->managers, &bufmgr_list);
 
     bufmgr_gem->use_softpin = false;
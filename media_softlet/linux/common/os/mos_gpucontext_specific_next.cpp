@@ -453,6 +453,7 @@ void GpuContextSpecificNext::Clear()
     MOS_SafeFreeMemory(m_attachedResources);
     MOS_SafeFreeMemory(m_writeModeList);
     MOS_SafeFreeMemory(m_createOptionEnhanced);
+    m_attachedResIndex.clear();
 
     for (int i=0; i<MAX_ENGINE_INSTANCE_NUM; i++)
     {
@@ -476,15 +477,11 @@ MOS_STATUS GpuContextSpecificNext::RegisterResource(
 
     MOS_OS_CHK_NULL_RETURN(m_attachedResources);
 
-    PMOS_RESOURCE registeredResources = m_attachedResources;
-    uint32_t      allocationIndex     = 0;
-
-    for ( allocationIndex = 0; allocationIndex < m_resCount; allocationIndex++, registeredResources++)
+    uint32_t allocationIndex = m_resCount;
+    auto     registeredIndex = m_attachedResIndex.find(osResource->bo);
+    if (registeredIndex != m_attachedResIndex.end())
     {
-        if (osResource->bo == registeredResources->bo)
-        {
-            break;
-        }
+        allocationIndex = registeredIndex->second;
     }
 
     // Allocation list to be updated
@@ -493,6 +490,7 @@ MOS_STATUS GpuContextSpecificNext::RegisterResource(
         // New buffer
         if (allocationIndex == m_resCount)
         {
+            m_attachedResIndex.emplace(osResource->bo, allocationIndex);
             m_resCount++;
         }
 
@@ -977,47 +975,21 @@ MOS_STATUS GpuContextSpecificNext::MapResourcesToAuxTable(mos_linux_bo *cmd_bo)
     return MOS_STATUS_SUCCESS;
 }
 
-MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
+MOS_STATUS GpuContextSpecificNext::PatchCommandBuffers(
     MOS_STREAM_HANDLE   streamState,
+    PMOS_CONTEXT        perStreamParameters,
     PMOS_COMMAND_BUFFER cmdBuffer,
-    bool                nullRendering)
+    bool                scalaEnabled)
 {
     MOS_OS_FUNCTION_ENTER;
 
-    MOS_TraceEventExt(EVENT_MOS_BATCH_SUBMIT, EVENT_TYPE_START, nullptr, 0, nullptr, 0);
-
-    MOS_OS_CHK_NULL_RETURN(streamState);
-    auto perStreamParameters = (PMOS_CONTEXT)streamState->perStreamParameters;
-    MOS_OS_CHK_NULL_RETURN(perStreamParameters);
-    MOS_OS_CHK_NULL_RETURN(cmdBuffer);
-    MOS_OS_CHK_NULL_RETURN(m_patchLocationList);
-
-    MOS_GPU_NODE gpuNode  = OSKMGetGpuNode(m_gpuContext);
-    uint32_t     execFlag = gpuNode;
-    MOS_STATUS   eStatus  = MOS_STATUS_SUCCESS;
-    int32_t      ret      = 0;
-    bool         scalaEnabled = false;
-    auto         it           = m_secondaryCmdBufs.begin();
-
-    // Command buffer object DRM pointer
-    m_cmdBufFlushed = true;
-    auto cmd_bo     = cmdBuffer->OsResource.bo;
-
-    // Map Resource to Aux if needed
-    MapResourcesToAuxTable(cmd_bo);
-    for(auto it : m_secondaryCmdBufs)
-    {
-        MapResourcesToAuxTable(it.second->OsResource.bo);
-    }
-
-    if (m_secondaryCmdBufs.size() >= 2)
-    {
-        scalaEnabled = true;
-        cmdBuffer->iSubmissionType = SUBMISSION_TYPE_MULTI_PIPE_MASTER;
-    }
-
-    std::vector<PMOS_RESOURCE> mappedResList;
-    std::vector<MOS_LINUX_BO *> skipSyncBoList;
+    auto          cmd_bo                = cmdBuffer->OsResource.bo;
+    auto          it                    = m_secondaryCmdBufs.begin();
+    auto          &mappedResList        = m_mappedResList;
+    auto          &skipSyncBoList       = m_skipSyncBoList;
+    int32_t       ret                   = 0;
+    MOS_LINUX_BO *lockedNestedBo        = nullptr;
+    bool          contextOffsetsIndexed = false;
 
     // Now, the patching will be done, based on the patch list.
     for (uint32_t patchIndex = 0; patchIndex < m_currentNumPatchLocations; patchIndex++)
@@ -1028,7 +1000,7 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
         auto tempCmdBo = currentPatch->cmdBo == nullptr ? cmd_bo : currentPatch->cmdBo;
 
         // Following are for Nested BB buffer, if it's nested BB, we need to ensure it's locked.
-        if (tempCmdBo != cmd_bo)
+        if (tempCmdBo != cmd_bo && tempCmdBo != lockedNestedBo)
         {
             bool isSecondaryCmdBuf = false;
             it = m_secondaryCmdBufs.begin();
@@ -1042,18 +1014,18 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
                 it++;
             }
 
-            for(auto allocIdx = 0; allocIdx < m_numAllocations && (!isSecondaryCmdBuf); allocIdx++)
+            auto registeredIndex = m_attachedResIndex.find(tempCmdBo);
+            if (!isSecondaryCmdBuf && registeredIndex != m_attachedResIndex.end())
             {
-                auto tempRes = (PMOS_RESOURCE)m_allocationList[allocIdx].hAllocation;
-                if (tempCmdBo == tempRes->bo)
-                {
-                    GraphicsResourceNext::LockParams param;
-                    param.m_writeRequest = true;
-                    tempRes->pGfxResourceNext->Lock(m_osContext, param);
-                    mappedResList.push_back(tempRes);
-                    break;
-                }
+                auto tempRes = (PMOS_RESOURCE)m_allocationList[registeredIndex->second].hAllocation;
+                MOS_OS_CHK_NULL_RETURN(tempRes);
+                GraphicsResourceNext::LockParams param;
+                param.m_writeRequest = true;
+                tempRes->pGfxResourceNext->Lock(m_osContext, param);
+                mappedResList.push_back(tempRes);
             }
+            // Patches of one nested batch buffer are consecutive, lock it only once
+            lockedNestedBo = tempCmdBo;
         }
 
         // This is the resource for which patching will be done
@@ -1078,14 +1050,24 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
         {
             if (alloc_bo != tempCmdBo)
             {
-                auto item_ctx = perStreamParameters->contextOffsetList.begin();
-                for (; item_ctx != perStreamParameters->contextOffsetList.end(); item_ctx++)
+                // Index the offsets of this context once per submission instead of scanning per patch
+                if (!contextOffsetsIndexed)
                 {
-                    if (item_ctx->intel_context == perStreamParameters->intel_context && item_ctx->target_bo == alloc_bo)
+                    m_contextOffsets.clear();
+                    for (auto &item_ctx : perStreamParameters->contextOffsetList)
                     {
-                        boOffset = item_ctx->offset64;
-                        break;
+                        if (item_ctx.intel_context == perStreamParameters->intel_context)
+                        {
+                            m_contextOffsets.emplace(item_ctx.target_bo, item_ctx.offset64);
+                        }
                     }
+                    contextOffsetsIndexed = true;
+                }
+
+                auto contextOffset = m_contextOffsets.find(alloc_bo);
+                if (contextOffset != m_contextOffsets.end())
+                {
+                    boOffset = contextOffset->second;
                 }
             }
         }
@@ -1161,11 +1143,62 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
         }
     }
 
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
+    MOS_STREAM_HANDLE   streamState,
+    PMOS_COMMAND_BUFFER cmdBuffer,
+    bool                nullRendering)
+{
+    MOS_OS_FUNCTION_ENTER;
+
+    MOS_TraceEventExt(EVENT_MOS_BATCH_SUBMIT, EVENT_TYPE_START, nullptr, 0, nullptr, 0);
+
+    MOS_OS_CHK_NULL_RETURN(streamState);
+    auto perStreamParameters = (PMOS_CONTEXT)streamState->perStreamParameters;
+    MOS_OS_CHK_NULL_RETURN(perStreamParameters);
+    MOS_OS_CHK_NULL_RETURN(cmdBuffer);
+    MOS_OS_CHK_NULL_RETURN(m_patchLocationList);
+
+    MOS_GPU_NODE gpuNode  = OSKMGetGpuNode(m_gpuContext);
+    uint32_t     execFlag = gpuNode;
+    MOS_STATUS   eStatus  = MOS_STATUS_SUCCESS;
+    int32_t      ret      = 0;
+    bool         scalaEnabled = false;
+    auto         it           = m_secondaryCmdBufs.begin();
+
+    // Command buffer object DRM pointer
+    m_cmdBufFlushed = true;
+    auto cmd_bo     = cmdBuffer->OsResource.bo;
+
+    // Map Resource to Aux if needed
+    MapResourcesToAuxTable(cmd_bo);
+    for(auto it : m_secondaryCmdBufs)
+    {
+        MapResourcesToAuxTable(it.second->OsResource.bo);
+    }
+
+    if (m_secondaryCmdBufs.size() >= 2)
+    {
+        scalaEnabled = true;
+        cmdBuffer->iSubmissionType = SUBMISSION_TYPE_MULTI_PIPE_MASTER;
+    }
+
+    auto &mappedResList  = m_mappedResList;
+    auto &skipSyncBoList = m_skipSyncBoList;
+    mappedResList.clear();
+    skipSyncBoList.clear();
+
+    eStatus = PatchCommandBuffers(streamState, perStreamParameters, cmdBuffer, scalaEnabled);
+
+    // Nested batch buffers locked for patching are unlocked whether patching succeeded or not
     for(auto res: mappedResList)
     {
         res->pGfxResourceNext->Unlock(m_osContext);
     }
     mappedResList.clear();
+    MOS_OS_CHK_STATUS_RETURN(eStatus);
 
     if (scalaEnabled)
     {
@@ -1433,6 +1466,7 @@ if (streamState->dumpCommandBuffer)
     m_currentNumPatchLocations = 0;
     MosUtilities::MosZeroMemory(m_patchLocationList, sizeof(PATCHLOCATIONLIST) * m_maxNumAllocations);
     m_resCount = 0;
+    m_attachedResIndex.clear();
 
     MosUtilities::MosZeroMemory(m_writeModeList, sizeof(bool) * m_maxNumAllocations);
 finish:
@@ -1678,6 +1712,7 @@ void GpuContextSpecificNext::ResetGpuContextStatus()
 
     MosUtilities::MosZeroMemory(m_attachedResources, sizeof(MOS_RESOURCE) * ALLOCATIONLIST_SIZE);
     m_resCount = 0;
+    m_attachedResIndex.clear();
 
     MosUtilities::MosZeroMemory(m_writeModeList, sizeof(bool) * ALLOCATIONLIST_SIZE);
 
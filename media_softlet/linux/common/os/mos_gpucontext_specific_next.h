@@ -30,6 +30,7 @@
 #include "mos_gpucontext_next.h"
 #include "mos_graphicsresource_specific_next.h"
 #include "mos_oca_interface_specific.h"
+#include <unordered_map>
 
 #define ENGINE_INSTANCE_SELECT_ENABLE_MASK                   0xFF
 #define ENGINE_INSTANCE_SELECT_COMPUTE_INSTANCE_SHIFT        16
@@ -208,6 +209,27 @@ protected:
     //!
     MOS_STATUS MapResourcesToAuxTable(mos_linux_bo *cmd_bo);
 
+    //!
+    //! \brief    Patch the command buffer and nested batch buffers with the resource offsets
+    //! \details  Nested batch buffers locked for patching are added to m_mappedResList,
+    //!           the caller unlocks them whether patching succeeded or not
+    //! \param    [in] streamState
+    //!           Os stream state
+    //! \param    [in] perStreamParameters
+    //!           Os context of the stream
+    //! \param    [in] cmdBuffer
+    //!           Primary command buffer to submit
+    //! \param    [in] scalaEnabled
+    //!           Whether the submission uses multiple pipes
+    //! \return   MOS_STATUS
+    //!           Return MOS_STATUS_SUCCESS if successful, otherwise failed
+    //!
+    MOS_STATUS PatchCommandBuffers(
+        MOS_STREAM_HANDLE   streamState,
+        PMOS_CONTEXT        perStreamParameters,
+        PMOS_COMMAND_BUFFER cmdBuffer,
+        bool                scalaEnabled);
+
     MOS_VDBOX_NODE_IND GetVdboxNodeId(
         PMOS_COMMAND_BUFFER cmdBuffer);
 
@@ -299,6 +321,12 @@ private:
     uint32_t      m_resCount = 0;  //!< number of resources registered
     PMOS_RESOURCE m_attachedResources = nullptr;  //!< Pointer to resources list
     bool         *m_writeModeList     = nullptr;  //!< Write mode
+    std::unordered_map<MOS_LINUX_BO *, uint32_t> m_attachedResIndex;  //!< bo to allocation list index
+
+    //! \brief    Per submission scratch lists, kept to reuse their storage
+    std::vector<PMOS_RESOURCE>  m_mappedResList;
+    std::vector<MOS_LINUX_BO *> m_skipSyncBoList;
+    std::unordered_map<MOS_LINUX_BO *, uint64_t> m_contextOffsets;  //!< Relocated offset of non softpin bos for this context
 
     //! \brief    GPU Status tag
     uint32_t m_GPUStatusTag = 0;
@@ -2177,6 +2177,22 @@ MOS_STATUS MosInterface::LockSyncCallback(
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS MosInterface::WaitForResourceIdle(
+    MOS_STREAM_HANDLE   streamState,
+    MOS_RESOURCE_HANDLE resource)
+{
+    MOS_OS_FUNCTION_ENTER;
+
+    MOS_OS_CHK_NULL_RETURN(streamState);
+    MOS_OS_CHK_NULL_RETURN(resource);
+    MOS_OS_CHK_NULL_RETURN(resource->bo);
+
+    // mapping a userptr or an already mapped bo returns without waiting for the gpu
+    mos_bo_wait_rendering(resource->bo);
+
+    return MOS_STATUS_SUCCESS;
+}
+
 MOS_STATUS MosInterface::WaitForCmdCompletion(
     MOS_STREAM_HANDLE  streamState,
     GPU_CONTEXT_HANDLE gpuCtx)
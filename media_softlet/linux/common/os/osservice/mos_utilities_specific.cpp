@@ -40,6 +40,7 @@
 #include <sys/types.h>
 #include <sys/sem.h>
 #include <sys/mman.h>
+#include <sys/syscall.h>  // SYS_gettid
 #include "mos_compat.h" // libc variative definitions: backtrace
 #include "mos_user_setting.h"
 #include "mos_utilities_specific.h"
@@ -70,12 +71,19 @@ double MosUtilities::MosGetTime()
 //!
 #define TRACE_SETTING_PATH             "/dev/shm/GFX_MEDIA_TRACE"
 #define TRACE_SETTING_SIZE             sizeof(MtControlData)
+#define TRACE_ASYNC_RING_MIN_SIZE      (16 * 1024)         // Min per-thread ring buffer size of the asynchronous trace sink
+#define TRACE_ASYNC_RING_MAX_SIZE      (16 * 1024 * 1024)  // Max per-thread ring buffer size of the asynchronous trace sink
+#define TRACE_ASYNC_RING_DEFAULT_SIZE  (512 * 1024)        // Per-thread ring buffer size if GFX_MEDIA_TRACE_ASYNC is 0
+#define TRACE_ASYNC_BATCH_TAG          0x494D5442          // IMTB (IntelMediaTraceBatch) as ftrace raw marker tag of asynchronous batches
 
 //!
 //! \brief Linux specific trace entry path and file description.
 //!
 const char *const MosUtilitiesSpecificNext::m_mosTracePath  = "/sys/kernel/debug/tracing/trace_marker_raw";
 int32_t           MosUtilitiesSpecificNext::m_mosTraceFd    = -1;
+int32_t           MosUtilitiesSpecificNext::m_mosTraceFileFd = -1;
+std::atomic<MosTraceAsyncSink *> MosUtilitiesSpecificNext::m_mosTraceSink {nullptr};
+std::atomic<int32_t> MosUtilitiesSpecificNext::m_mosTraceWriters {0};
 uint64_t          MosUtilitiesSpecificNext::m_filterEnv     = 0;
 uint32_t          MosUtilitiesSpecificNext::m_levelEnv      = 0;
 
@@ -87,6 +95,7 @@ MosMutex          MosUtilitiesSpecificNext::m_userSettingMutex;
 #define TRACE_EVENT_MAX_SIZE           (3072)
 #define TRACE_EVENT_HEADER_SIZE        (sizeof(uint32_t)*3)
 #define TRACE_EVENT_MAX_DATA_SIZE      (TRACE_EVENT_MAX_SIZE - TRACE_EVENT_HEADER_SIZE - sizeof(uint16_t)) // Trace info data size section is in uint16_t
+#define TRACE_CALL_STACK_BUF_SIZE      (256)
 
 //!
 //! \brief for int64_t/uint64_t format print warning
@@ -291,6 +300,47 @@ MOS_STATUS MosUtilities::MosCreateDirectory(
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS MosUtilities::MosCreatePrivateDirectory(
+    char * const       lpPathName)
+{
+    struct stat dirStat;
+
+    MOS_OS_CHK_NULL_RETURN(lpPathName);
+
+    if (mkdir(lpPathName, S_IRWXU) < 0 &&
+        errno != EEXIST)
+    {
+        MOS_OS_NORMALMESSAGE("Failed to create the directory '%s'. Error = %s", lpPathName, strerror(errno));
+        return MOS_STATUS_DIR_CREATE_FAILED;
+    }
+
+    // An existing directory may have been created by someone else, or with a looser mode
+    if (stat(lpPathName, &dirStat) != 0 ||
+        !S_ISDIR(dirStat.st_mode) ||
+        dirStat.st_uid != geteuid() ||
+        (dirStat.st_mode & (S_IRWXG | S_IRWXO)) != 0)
+    {
+        return MOS_STATUS_INVALID_PARAMETER;
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+bool MosUtilities::MosIsFileOwnedByCurrentUser(
+    HANDLE              hFile)
+{
+    struct stat fileStat;
+
+    if (hFile == nullptr)
+    {
+        return false;
+    }
+
+    return fstat((intptr_t)hFile, &fileStat) == 0 &&
+           S_ISREG(fileStat.st_mode) &&
+           fileStat.st_uid == geteuid();
+}
+
 MOS_STATUS MosUtilities::MosCreateFile(
     PHANDLE             pHandle,
     char * const        lpFileName,
@@ -2371,6 +2421,322 @@ MOS_STATUS MosUtilities::MosGetLocalTime(
     return eStatus;
 }
 
+void MosTraceRing::CopyToRing(uint64_t pos, const void *data, uint32_t size)
+{
+    uint32_t offset = (uint32_t)(pos % m_ring.size());
+    uint32_t first  = MOS_MIN(size, (uint32_t)m_ring.size() - offset);
+
+    memcpy(&m_ring[offset], data, first);
+    memcpy(&m_ring[0], (const uint8_t *)data + first, size - first);
+}
+
+void MosTraceRing::CopyFromRing(uint64_t pos, void *data, uint32_t size)
+{
+    uint32_t offset = (uint32_t)(pos % m_ring.size());
+    uint32_t first  = MOS_MIN(size, (uint32_t)m_ring.size() - offset);
+
+    memcpy(data, &m_ring[offset], first);
+    memcpy((uint8_t *)data + first, &m_ring[0], size - first);
+}
+
+bool MosTraceRing::Push(const MosTraceFileRecord &record, const void *data)
+{
+    uint64_t head = m_head.load(std::memory_order_relaxed);
+    uint64_t tail = m_tail.load(std::memory_order_acquire);
+
+    if (m_ring.size() - (head - tail) < sizeof(record) + record.size)
+    {
+        return false;
+    }
+    CopyToRing(head, &record, sizeof(record));
+    CopyToRing(head + sizeof(record), data, record.size);
+
+    // publish the event to the writer thread
+    m_head.store(head + sizeof(record) + record.size, std::memory_order_release);
+    return true;
+}
+
+bool MosTraceRing::Pop(uint8_t *batch, uint32_t batchSize, uint32_t &used)
+{
+    uint64_t head = m_head.load(std::memory_order_acquire);
+    uint64_t tail = m_tail.load(std::memory_order_relaxed);
+    bool     full = false;
+
+    while (tail != head)
+    {
+        MosTraceFileRecord record = {};
+
+        CopyFromRing(tail, &record, sizeof(record));
+        if (used + sizeof(record) + record.size > batchSize)
+        {
+            full = true;    // leave event for next batch
+            break;
+        }
+        record.tid = m_tid;
+        MOS_SecureMemcpy(batch + used, sizeof(record), &record, sizeof(record));
+        CopyFromRing(tail + sizeof(record), batch + used + sizeof(record), record.size);
+        used += sizeof(record) + record.size;
+        tail += sizeof(record) + record.size;
+    }
+
+    // hand the space back to the tracing thread
+    m_tail.store(tail, std::memory_order_release);
+    return full;
+}
+
+std::atomic<uint64_t> MosTraceAsyncSink::m_nextSinkId {1};
+
+MosTraceAsyncSink::MosTraceAsyncSink(int32_t fileFd, int32_t markerFd, uint32_t ringSize) :
+    m_batch(m_batchSize),
+    m_sinkId(m_nextSinkId++),
+    m_ringSize(ringSize),
+    m_fileFd(fileFd),
+    m_markerFd(markerFd)
+{
+    m_thread = std::thread(&MosTraceAsyncSink::WriterThread, this);
+}
+
+MosTraceAsyncSink::~MosTraceAsyncSink()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_exit = true;
+    }
+    m_cond.notify_one();
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+MosTraceRing *MosTraceAsyncSink::GetRing()
+{
+    // The ring is shared with the sink, so neither a thread exit nor a sink re-init
+    // frees it under the other side. A ring of a previous sink is simply replaced.
+    static thread_local std::shared_ptr<MosTraceRing> ring;
+
+    if (ring && ring->m_sinkId == m_sinkId)
+    {
+        return ring.get();
+    }
+
+    std::shared_ptr<MosTraceRing> newRing = std::make_shared<MosTraceRing>(m_ringSize, (uint32_t)syscall(SYS_gettid), m_sinkId);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_exit)
+    {
+        return nullptr;
+    }
+    m_rings.push_back(newRing);
+    ring = newRing;
+    return ring.get();
+}
+
+bool MosTraceAsyncSink::Write(const void *data, uint32_t size)
+{
+    MosTraceFileRecord record = {};
+    struct timespec    ts     = {};
+
+    if (data == nullptr || size == 0 || sizeof(record) + size > m_ringSize / 2)
+    {
+        return false;
+    }
+
+    MosTraceRing *ring = GetRing();
+    if (ring == nullptr)
+    {
+        return false;
+    }
+
+    // time of the event, not of the writer thread which flushes it; the thread id is
+    // filled in from the ring by the writer thread
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    record.timestamp = (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+    record.size      = size;
+
+    if (!ring->Push(record, data))
+    {
+        // never block the tracing thread
+        m_dropped++;
+        return false;
+    }
+    if (ring->GetUsedSize() >= m_ringSize / 2 && !m_wakeup.exchange(true))
+    {
+        m_cond.notify_one();
+    }
+    return true;
+}
+
+void MosTraceAsyncSink::WriteFile(const uint8_t *data, uint32_t size, uint32_t events)
+{
+    if (m_fileFd >= 0 && write(m_fileFd, data, size) != (ssize_t)size)
+    {
+        m_dropped += events;
+    }
+}
+
+void MosTraceAsyncSink::WriteMarker(const uint8_t *data, uint32_t size)
+{
+    // room for the tag and one event of maximum size with its record
+    uint8_t  buf[TRACE_EVENT_MAX_SIZE + sizeof(uint32_t) + sizeof(MosTraceFileRecord)];
+    uint32_t used   = sizeof(uint32_t);
+    uint32_t queued = 0;
+
+    if (m_markerFd < 0)
+    {
+        return;
+    }
+
+    // one marker write per batch, ftrace limits the size of a single marker write
+    *(uint32_t *)buf = TRACE_ASYNC_BATCH_TAG;
+    while (size > 0)
+    {
+        MosTraceFileRecord record = {};
+        MOS_SecureMemcpy(&record, sizeof(record), data, sizeof(record));
+
+        uint32_t eventSize = sizeof(record) + record.size;
+        if (used + eventSize > sizeof(buf) && queued > 0)
+        {
+            if (write(m_markerFd, buf, used) != (ssize_t)used)
+            {
+                m_dropped += queued;
+            }
+            used   = sizeof(uint32_t);
+            queued = 0;
+        }
+        if (used + eventSize <= sizeof(buf))
+        {
+            MOS_SecureMemcpy(buf + used, sizeof(buf) - used, data, eventSize);
+            used += eventSize;
+            queued++;
+        }
+        else
+        {
+            m_dropped++;
+        }
+        data += eventSize;
+        size -= eventSize;
+    }
+    if (queued > 0 && write(m_markerFd, buf, used) != (ssize_t)used)
+    {
+        m_dropped += queued;
+    }
+}
+
+bool MosTraceAsyncSink::Drain()
+{
+    std::vector<std::shared_ptr<MosTraceRing>> rings;
+    bool                                       pending = false;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        rings = m_rings;
+    }
+
+    for (auto &ring : rings)
+    {
+        bool full = true;
+        while (full)
+        {
+            uint32_t used = 0;
+            full = ring->Pop(m_batch.data(), m_batchSize, used);
+            if (used == 0)
+            {
+                break;
+            }
+
+            uint32_t events = 0;
+            for (uint32_t offset = 0; offset < used; events++)
+            {
+                offset += sizeof(MosTraceFileRecord) + ((MosTraceFileRecord *)(m_batch.data() + offset))->size;
+            }
+            WriteFile(m_batch.data(), used, events);
+            WriteMarker(m_batch.data(), used);
+        }
+        pending |= !ring->IsEmpty();
+    }
+
+    {
+        // rings of exited threads are only referenced from here, drop them once drained
+        std::lock_guard<std::mutex> lock(m_mutex);
+        rings.clear();
+        m_rings.erase(std::remove_if(m_rings.begin(), m_rings.end(), [](const std::shared_ptr<MosTraceRing> &ring) {
+            return ring.use_count() == 1 && ring->IsEmpty();
+        }), m_rings.end());
+    }
+
+    return pending;
+}
+
+void MosTraceAsyncSink::WriterThread()
+{
+    while (true)
+    {
+        bool exit = false;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cond.wait_for(lock, std::chrono::milliseconds(10), [this] {
+                return m_exit || m_wakeup.load();
+            });
+            exit = m_exit;
+        }
+        m_wakeup = false;
+
+        // drain until empty on exit, events queued before the sink was unpublished are flushed
+        while (Drain() && exit)
+        {
+        }
+
+        if (exit)
+        {
+            break;
+        }
+    }
+}
+
+bool MosUtilitiesSpecificNext::MosTraceWrite(const void *data, uint32_t size)
+{
+    bool written = false;
+
+    // MosTraceSinkDestroy waits for m_mosTraceWriters to drop to 0 after unpublishing the sink,
+    // so the sink loaded here stays valid until the counter is decremented.
+    m_mosTraceWriters++;
+    MosTraceAsyncSink *sink = m_mosTraceSink.load();
+    if (sink)
+    {
+        written = sink->Write(data, size);
+    }
+    else if (m_mosTraceFd >= 0)
+    {
+        written = (write(m_mosTraceFd, data, size) == (ssize_t)size);
+    }
+    m_mosTraceWriters--;
+
+    return written;
+}
+
+void MosUtilitiesSpecificNext::MosTraceSinkDestroy()
+{
+    MosTraceAsyncSink *sink = m_mosTraceSink.exchange(nullptr);
+    if (sink == nullptr)
+    {
+        return;
+    }
+
+    // let threads which picked up the sink before it was unpublished finish their write
+    while (m_mosTraceWriters.load() > 0)
+    {
+        std::this_thread::yield();
+    }
+
+    uint64_t dropped = sink->GetDroppedCount();
+    if (dropped > 0)
+    {
+        MOS_OS_NORMALMESSAGE("%" PRIu64 " trace events dropped", dropped);
+    }
+    // flushes pending events before the file descriptor is closed
+    MOS_Delete(sink);
+}
+
 void MosUtilities::MosTraceEventInit()
 {
     char *val = getenv("GFX_MEDIA_TRACE");
@@ -2409,12 +2775,42 @@ void MosUtilities::MosTraceEventInit()
     }
 
     // close first, if already opened.
+    MosUtilitiesSpecificNext::MosTraceSinkDestroy();
+    if (MosUtilitiesSpecificNext::m_mosTraceFileFd >= 0)
+    {
+        close(MosUtilitiesSpecificNext::m_mosTraceFileFd);
+        MosUtilitiesSpecificNext::m_mosTraceFileFd = -1;
+    }
     if (MosUtilitiesSpecificNext::m_mosTraceFd >= 0)
     {
         close(MosUtilitiesSpecificNext::m_mosTraceFd);
         MosUtilitiesSpecificNext::m_mosTraceFd = -1;
     }
     MosUtilitiesSpecificNext::m_mosTraceFd = open(MosUtilitiesSpecificNext::m_mosTracePath, O_WRONLY);
+
+    // Optional asynchronous sink, the marker write then moves off the tracing thread:
+    // GFX_MEDIA_TRACE_ASYNC - per-thread ring buffer size in KB (0 for default size)
+    // GFX_MEDIA_TRACE_FILE  - also append events to this file, implies GFX_MEDIA_TRACE_ASYNC
+    // Both sinks receive MosTraceFileRecord prefixed events, the marker in IMTB tagged batches.
+    val = getenv("GFX_MEDIA_TRACE_FILE");
+    if (val)
+    {
+        MosUtilitiesSpecificNext::m_mosTraceFileFd = open(val, O_WRONLY | O_CREAT | O_APPEND, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+    }
+    val = getenv("GFX_MEDIA_TRACE_ASYNC");
+    if (val || MosUtilitiesSpecificNext::m_mosTraceFileFd >= 0)
+    {
+        uint32_t ringSize = val ? static_cast<uint32_t>(strtoul(val, nullptr, 0)) * 1024 : 0;
+        if (ringSize == 0)
+        {
+            ringSize = TRACE_ASYNC_RING_DEFAULT_SIZE;
+        }
+        ringSize = MOS_MIN(MOS_MAX(ringSize, TRACE_ASYNC_RING_MIN_SIZE), TRACE_ASYNC_RING_MAX_SIZE);
+        MosUtilitiesSpecificNext::m_mosTraceSink = MOS_New(MosTraceAsyncSink,
+            MosUtilitiesSpecificNext::m_mosTraceFileFd,
+            MosUtilitiesSpecificNext::m_mosTraceFd,
+            ringSize);
+    }
     return;
 }
 
@@ -2428,6 +2824,12 @@ void MosUtilities::MosTraceEventClose()
         munmap((void *)m_mosTraceControlData, TRACE_SETTING_SIZE);
         m_mosTraceControlData = nullptr;
     }
+    MosUtilitiesSpecificNext::MosTraceSinkDestroy();
+    if (MosUtilitiesSpecificNext::m_mosTraceFileFd >= 0)
+    {
+        close(MosUtilitiesSpecificNext::m_mosTraceFileFd);
+        MosUtilitiesSpecificNext::m_mosTraceFileFd = -1;
+    }
     if (MosUtilitiesSpecificNext::m_mosTraceFd >= 0)
     {
         close(MosUtilitiesSpecificNext::m_mosTraceFd);
@@ -2456,10 +2858,10 @@ void MosUtilities::MosTraceEvent(
         return; // skip if trace not enabled from share memory
     }
 
-    if (MosUtilitiesSpecificNext::m_mosTraceFd >= 0 &&
+    if ((MosUtilitiesSpecificNext::m_mosTraceFd >= 0 || MosUtilitiesSpecificNext::m_mosTraceSink.load()) &&
         TRACE_EVENT_MAX_SIZE > dwSize1 + dwSize2 + TRACE_EVENT_HEADER_SIZE)
     {
-        uint8_t traceBuf[256];
+        uint8_t traceBuf[TRACE_EVENT_MAX_SIZE];
         uint8_t *pTraceBuf = traceBuf;
 
         // special handling for media runtime log, filter by component
@@ -2475,37 +2877,25 @@ void MosUtilities::MosTraceEvent(
             }
         }
 
-        if (dwSize1 + dwSize2 + TRACE_EVENT_HEADER_SIZE > sizeof(traceBuf))
+        // trace header
+        uint32_t *header = (uint32_t *)pTraceBuf;
+        uint32_t    nLen = TRACE_EVENT_HEADER_SIZE;
+
+        header[0] = 0x494D5445; // IMTE (IntelMediaTraceEvent) as ftrace raw marker tag
+        header[1] = (usId << 16) | (dwSize1 + dwSize2);
+        header[2] = ucType;
+
+        if (pArg1 && dwSize1 > 0)
         {
-            pTraceBuf = (uint8_t *)MOS_AllocAndZeroMemory(TRACE_EVENT_MAX_SIZE);
+            MOS_SecureMemcpy(pTraceBuf+nLen, dwSize1, pArg1, dwSize1);
+            nLen += dwSize1;
         }
-
-        if (pTraceBuf)
+        if (pArg2 && dwSize2 > 0)
         {
-            // trace header
-            uint32_t *header = (uint32_t *)pTraceBuf;
-            uint32_t    nLen = TRACE_EVENT_HEADER_SIZE;
-
-            header[0] = 0x494D5445; // IMTE (IntelMediaTraceEvent) as ftrace raw marker tag
-            header[1] = (usId << 16) | (dwSize1 + dwSize2);
-            header[2] = ucType;
-
-            if (pArg1 && dwSize1 > 0)
-            {
-                MOS_SecureMemcpy(pTraceBuf+nLen, dwSize1, pArg1, dwSize1);
-                nLen += dwSize1;
-            }
-            if (pArg2 && dwSize2 > 0)
-            {
-                MOS_SecureMemcpy(pTraceBuf+nLen, dwSize2, pArg2, dwSize2);
-                nLen += dwSize2;
-            }
-            size_t writeSize = write(MosUtilitiesSpecificNext::m_mosTraceFd, pTraceBuf, nLen);
-            if (traceBuf != pTraceBuf)
-            {
-                MOS_FreeMemory(pTraceBuf);
-            }
+            MOS_SecureMemcpy(pTraceBuf+nLen, dwSize2, pArg2, dwSize2);
+            nLen += dwSize2;
         }
+        MosUtilitiesSpecificNext::MosTraceWrite(pTraceBuf, nLen);
 #if Backtrace_FOUND
         if (m_mosTraceFilter(TR_KEY_CALL_STACK))
         {
@@ -2513,7 +2903,7 @@ void MosUtilities::MosTraceEvent(
             // max 32-2=30 layers call stack in 64bit driver.
             uint32_t nLen = 4*sizeof(uint32_t);
             void **stack = (void **)(traceBuf + nLen);
-            int num = backtrace(stack, ((sizeof(traceBuf)-nLen)/sizeof(void *)));
+            int num = backtrace(stack, ((TRACE_CALL_STACK_BUF_SIZE-nLen)/sizeof(void *)));
             if (num > 0)
             {
                 uint32_t *header = (uint32_t *)traceBuf;
@@ -2523,7 +2913,7 @@ void MosUtilities::MosTraceEvent(
                 header[2] = 0;
                 header[3] = (uint32_t)num;
                 nLen += num*sizeof(void *);
-                size_t ret = write(MosUtilitiesSpecificNext::m_mosTraceFd, traceBuf, nLen);
+                MosUtilitiesSpecificNext::MosTraceWrite(traceBuf, nLen);
             }
         }
 #endif
@@ -2553,10 +2943,9 @@ void MosUtilities::MosTraceDataDump(
     const void *pBuf,
     uint32_t    dwSize)
 {
-    if (MosUtilitiesSpecificNext::m_mosTraceFd >= 0 && pBuf && pcName)
+    if ((MosUtilitiesSpecificNext::m_mosTraceFd >= 0 || MosUtilitiesSpecificNext::m_mosTraceSink.load()) && pBuf && pcName)
     {
         uint8_t *pTraceBuf = (uint8_t *)MOS_AllocAndZeroMemory(TRACE_EVENT_MAX_SIZE);
-        size_t writeSize = 0;
 
         if (pTraceBuf)
         {
@@ -2571,7 +2960,7 @@ void MosUtilities::MosTraceDataDump(
             header[4] = flags;
             memcpy(&header[5], pcName, nLen);
             nLen += TRACE_EVENT_HEADER_SIZE + 8 + 1;
-            writeSize = write(MosUtilitiesSpecificNext::m_mosTraceFd, pTraceBuf, nLen);
+            MosUtilitiesSpecificNext::MosTraceWrite(pTraceBuf, nLen);
             // send dump data
             header[2] = EVENT_TYPE_INFO;
             const uint8_t *pData = static_cast<const uint8_t *>(pBuf);
@@ -2589,14 +2978,14 @@ void MosUtilities::MosTraceDataDump(
                 memcpy(pDst, &len, sizeof(len));
                 memcpy(pDst+sizeof(len), pData, size);
                 nLen = TRACE_EVENT_HEADER_SIZE + size + sizeof(len);
-                writeSize = write(MosUtilitiesSpecificNext::m_mosTraceFd, pTraceBuf, nLen);
+                MosUtilitiesSpecificNext::MosTraceWrite(pTraceBuf, nLen);
                 dwSize -= size;
                 pData += size;
             }
             // send dump end
             header[1] = EVENT_DATA_DUMP << 16;
             header[2] = EVENT_TYPE_END;
-            writeSize = write(MosUtilitiesSpecificNext::m_mosTraceFd, pTraceBuf, TRACE_EVENT_HEADER_SIZE);
+            MosUtilitiesSpecificNext::MosTraceWrite(pTraceBuf, TRACE_EVENT_HEADER_SIZE);
 
             MOS_FreeMemory(pTraceBuf);
         }
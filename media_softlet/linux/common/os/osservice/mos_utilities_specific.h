@@ -27,6 +27,12 @@
 #define __MOS_UTILITIES_SPECIFIC_H__
 
 #include <map>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <condition_variable>
 #include <malloc.h>
 #include "mos_defs.h"
 #include "media_class_trace.h"
@@ -143,6 +149,142 @@ typedef struct _MOS_UF_KEY_NODE_T
 
 typedef MOS_UF_KEYNODE* MOS_PUF_KEYLIST;
 
+//!
+//! \brief   Asynchronous trace record
+//! \details Each event handed to the asynchronous trace sink is preceded by this record,
+//!          in the trace file as well as in the batches written to the ftrace marker.
+//!          It holds the time and thread id of the event, since the records are written
+//!          later by the sink's writer thread.
+//!
+struct MosTraceFileRecord
+{
+    uint64_t timestamp;     //!< CLOCK_MONOTONIC time in ns when the event was queued
+    uint32_t tid;           //!< Thread id of the tracing thread
+    uint32_t size;          //!< Size of the event following this record
+};
+
+//!
+//! \brief   Single producer single consumer trace ring
+//! \details Owned by one tracing thread, which only advances m_head, and drained by
+//!          the writer thread of MosTraceAsyncSink, which only advances m_tail.
+//!
+class MosTraceRing
+{
+public:
+    MosTraceRing(uint32_t size, uint32_t tid, uint64_t sinkId) :
+        m_tid(tid),
+        m_sinkId(sinkId),
+        m_ring(size)
+    {
+    }
+
+    //!
+    //! \brief   Queue one record and event, called by the owning thread only
+    //! \return  bool
+    //!          true if queued, false if the ring is full
+    //!
+    bool Push(const MosTraceFileRecord &record, const void *data);
+
+    //!
+    //! \brief   Move queued records to batch, called by the writer thread only
+    //! \param   [in] batch
+    //!          Batch buffer
+    //! \param   [in] batchSize
+    //!          Batch buffer size
+    //! \param   [in, out] used
+    //!          Bytes used in batch buffer
+    //! \return  bool
+    //!          true if records are left in the ring because the batch is full
+    //!
+    bool Pop(uint8_t *batch, uint32_t batchSize, uint32_t &used);
+
+    bool IsEmpty() const { return GetUsedSize() == 0; }
+
+    uint64_t GetUsedSize() const { return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire); }
+
+    const uint32_t        m_tid;
+    const uint64_t        m_sinkId;
+
+private:
+    void CopyToRing(uint64_t pos, const void *data, uint32_t size);
+    void CopyFromRing(uint64_t pos, void *data, uint32_t size);
+
+    std::vector<uint8_t>  m_ring;
+    std::atomic<uint64_t> m_head {0};   //!< Total bytes queued
+    std::atomic<uint64_t> m_tail {0};   //!< Total bytes consumed by writer thread
+MEDIA_CLASS_DEFINE_END(MosTraceRing)
+};
+
+//!
+//! \brief   Asynchronous trace sink
+//! \details Every tracing thread queues its events into its own MosTraceRing, without
+//!          locks or syscalls, and a background thread drains all rings in batches to
+//!          the trace file and the ftrace marker. Events are dropped (and counted) when
+//!          the ring of a thread is full.
+//!          ftrace stamps each marker write with the writer's pid and time, so batches
+//!          written to the marker are tagged with TRACE_ASYNC_BATCH_TAG instead of the
+//!          IMTE tag, and each event carries its MosTraceFileRecord.
+//!
+class MosTraceAsyncSink
+{
+public:
+    //!
+    //! \brief   Constructor
+    //! \param   [in] fileFd
+    //!          Trace file descriptor, -1 if not used
+    //! \param   [in] markerFd
+    //!          ftrace marker file descriptor, -1 if not used
+    //! \param   [in] ringSize
+    //!          Ring buffer size per tracing thread in bytes
+    //!
+    MosTraceAsyncSink(int32_t fileFd, int32_t markerFd, uint32_t ringSize);
+
+    //!
+    //! \brief   Destructor, flushes pending events and stops writer thread
+    //!
+    ~MosTraceAsyncSink();
+
+    //!
+    //! \brief   Queue one trace event into the ring of the calling thread
+    //! \param   [in] data
+    //!          Event data, starting with the trace event header
+    //! \param   [in] size
+    //!          Event size in bytes
+    //! \return  bool
+    //!          true if queued, false if dropped
+    //!
+    bool Write(const void *data, uint32_t size);
+
+    //!
+    //! \brief   Get number of dropped events
+    //!
+    uint64_t GetDroppedCount() const { return m_dropped.load(); }
+
+private:
+    MosTraceRing *GetRing();
+    void WriterThread();
+    bool Drain();
+    void WriteFile(const uint8_t *data, uint32_t size, uint32_t events);
+    void WriteMarker(const uint8_t *data, uint32_t size);
+
+    static const uint32_t   m_batchSize = 64 * 1024;    //!< Max bytes written to trace file at once
+    static std::atomic<uint64_t> m_nextSinkId;
+
+    std::mutex              m_mutex;                    //!< Protects m_rings and m_exit
+    std::condition_variable m_cond;
+    std::thread             m_thread;
+    std::vector<std::shared_ptr<MosTraceRing>> m_rings;
+    std::vector<uint8_t>    m_batch;
+    bool                    m_exit     = false;
+    std::atomic<bool>       m_wakeup   {false};
+    std::atomic<uint64_t>   m_dropped  {0};
+    const uint64_t          m_sinkId;
+    const uint32_t          m_ringSize;
+    int32_t                 m_fileFd   = -1;
+    int32_t                 m_markerFd = -1;
+MEDIA_CLASS_DEFINE_END(MosTraceAsyncSink)
+};
+
 class MosUtilitiesSpecificNext
 {
 public:
@@ -402,9 +544,33 @@ private:
     static MOS_STATUS UserFeatureGetKeyNamebyId(void  *UFKey, char  *pcKeyName);
 
 public:
+    /*----------------------------------------------------------------------------
+    | Name      : MosTraceWrite
+    | Purpose   : Write one trace event to the trace sink
+    | Arguments : data         [in] Trace event, starting with the event header
+    |             size         [in] Trace event size in bytes
+    | Returns   : true if the event was written or queued, else false
+    | Comments  : Events go to the asynchronous sink if enabled, else
+    |             directly to the ftrace marker.
+    \---------------------------------------------------------------------------*/
+    static bool MosTraceWrite(const void *data, uint32_t size);
+
+    /*----------------------------------------------------------------------------
+    | Name      : MosTraceSinkDestroy
+    | Purpose   : Unpublish and free the asynchronous trace sink
+    | Arguments : None
+    | Returns   : None
+    | Comments  : Waits until no thread is inside MosTraceWrite with the old
+    |             sink before it is deleted.
+    \---------------------------------------------------------------------------*/
+    static void MosTraceSinkDestroy();
+
     static const char*          m_szUserFeatureFile;
     static MOS_PUF_KEYLIST      m_ufKeyList;
     static int32_t              m_mosTraceFd;
+    static int32_t              m_mosTraceFileFd;
+    static std::atomic<MosTraceAsyncSink *> m_mosTraceSink;
+    static std::atomic<int32_t> m_mosTraceWriters;      //!< Threads currently inside MosTraceWrite
     static uint64_t             m_filterEnv;
     static uint32_t             m_levelEnv;
     static const char* const    m_mosTracePath;